@@ -0,0 +1,171 @@
+/**
+ * @file adpcm.h
+ * @brief Formato IMA-ADPCM de 4 bits por muestra para el banco de sonidos, con puntos de búsqueda.
+ * @details La muestra se guarda en bloques de ADPCM_BLOCK_SAMPLES muestras. Cada
+ * bloque empieza con una cabecera de ADPCM_HEADER_BYTES bytes (predictor de 16
+ * bits en little endian, índice de paso y un byte de relleno) con el estado del
+ * decodificador antes de su primera muestra, y sigue con dos muestras por byte
+ * (la primera en el nibble bajo). Las cabeceras son los puntos de búsqueda:
+ * empezar en cualquier muestra cuesta como mucho decodificar un bloque.
+ *
+ * Las muestras de 12 bits sin signo se codifican desplazadas a 16 bits con
+ * signo, que es la escala del algoritmo IMA, y se devuelven en el mismo
+ * formato que el banco PCM (centro en 2048). El codificador solo se usa en el
+ * host (ver tools/bank_gen.c). No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ADPCM_BLOCK_SAMPLES 256 ///< Muestras por bloque: distancia entre puntos de búsqueda.
+#define ADPCM_HEADER_BYTES 4
+#define ADPCM_BLOCK_BYTES (ADPCM_HEADER_BYTES + ADPCM_BLOCK_SAMPLES / 2)
+/// Bytes que ocupan @p samples muestras (el último bloque va completo).
+#define ADPCM_BANK_BYTES(samples) \
+    ((((samples) + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES)
+#define ADPCM_INPUT_SHIFT 4 ///< De 12 a 16 bits.
+
+static const int16_t adpcm_step_table[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t adpcm_index_table[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+/**
+ * @brief Estado de una lectura secuencial del banco; avanza de bloque en bloque solo.
+ */
+typedef struct {
+    const uint8_t *next;  ///< Próximo byte de datos del bloque en curso.
+    int32_t predictor;    ///< Última muestra decodificada (16 bits con signo).
+    uint8_t index;        ///< Índice en adpcm_step_table.
+    uint8_t high;         ///< 1 si la próxima muestra está en el nibble alto de *next.
+    uint16_t left;        ///< Muestras que quedan en el bloque en curso.
+} AdpcmDecoder;
+
+/// Aplica un código de 4 bits al estado del decodificador.
+static inline void adpcm_step(int32_t *predictor, uint8_t *index, uint8_t code) {
+    int32_t step = adpcm_step_table[*index];
+    int32_t diff = step >> 3;
+    if (code & 1) diff += step >> 2;
+    if (code & 2) diff += step >> 1;
+    if (code & 4) diff += step;
+    int32_t p = (code & 8) ? *predictor - diff : *predictor + diff;
+    *predictor = p > 32767 ? 32767 : (p < -32768 ? -32768 : p);
+    int32_t i = *index + adpcm_index_table[code];
+    *index = (uint8_t)(i < 0 ? 0 : (i > 88 ? 88 : i));
+}
+
+/// Muestra de 12 bits sin signo a partir del predictor.
+static inline uint16_t adpcm_output(int32_t predictor) {
+    int32_t x = (predictor + (2048 << ADPCM_INPUT_SHIFT) + (1 << (ADPCM_INPUT_SHIFT - 1))) >> ADPCM_INPUT_SHIFT;
+    return (uint16_t)(x > 4095 ? 4095 : x);
+}
+
+/**
+ * @brief Sitúa @p dec al inicio del bloque @p block de @p bank.
+ */
+static inline void adpcm_seek_block(AdpcmDecoder *dec, const uint8_t *bank, uint32_t block) {
+    const uint8_t *header = bank + block * ADPCM_BLOCK_BYTES;
+    dec->predictor = (int16_t)(header[0] | (header[1] << 8));
+    dec->index = header[2] > 88 ? 88 : header[2];
+    dec->next = header + ADPCM_HEADER_BYTES;
+    dec->high = 0;
+    dec->left = ADPCM_BLOCK_SAMPLES;
+}
+
+/**
+ * @brief Decodifica @p n muestras consecutivas en @p out; @p out puede ser NULL para saltarlas.
+ * @details Dentro de un bloque procesa un byte (dos muestras) por iteración;
+ * al llegar al final del bloque resincroniza el estado con la cabecera del
+ * siguiente, que es el mismo que dejó el codificador.
+ */
+static void adpcm_decode(AdpcmDecoder *dec, uint16_t *out, size_t n) {
+    int32_t predictor = dec->predictor;
+    uint8_t index = dec->index;
+    const uint8_t *src = dec->next;
+    while (n > 0) {
+        if (dec->left == 0) {
+            const uint8_t *header = src; // El bloque siguiente empieza justo después
+            predictor = (int16_t)(header[0] | (header[1] << 8));
+            index = header[2] > 88 ? 88 : header[2];
+            src = header + ADPCM_HEADER_BYTES;
+            dec->left = ADPCM_BLOCK_SAMPLES;
+        }
+        size_t run = n < dec->left ? n : dec->left;
+        dec->left -= (uint16_t)run;
+        n -= run;
+        if (dec->high && run > 0) { // Termina el byte empezado
+            adpcm_step(&predictor, &index, *src++ >> 4);
+            if (out) *out++ = adpcm_output(predictor);
+            dec->high = 0;
+            --run;
+        }
+        for (; run >= 2; run -= 2) {
+            uint8_t byte = *src++;
+            adpcm_step(&predictor, &index, byte & 0x0F);
+            if (out) *out++ = adpcm_output(predictor);
+            adpcm_step(&predictor, &index, byte >> 4);
+            if (out) *out++ = adpcm_output(predictor);
+        }
+        if (run) { // Queda el nibble alto para la próxima llamada
+            adpcm_step(&predictor, &index, *src & 0x0F);
+            if (out) *out++ = adpcm_output(predictor);
+            dec->high = 1;
+        }
+    }
+    dec->predictor = predictor;
+    dec->index = index;
+    dec->next = src;
+}
+
+/**
+ * @brief Sitúa @p dec en la muestra @p sample de @p bank usando el punto de búsqueda anterior.
+ */
+static inline void adpcm_seek(AdpcmDecoder *dec, const uint8_t *bank, uint32_t sample) {
+    adpcm_seek_block(dec, bank, sample / ADPCM_BLOCK_SAMPLES);
+    adpcm_decode(dec, NULL, sample % ADPCM_BLOCK_SAMPLES);
+}
+
+/**
+ * @brief Codifica @p n muestras de 12 bits en @p out (ADPCM_BANK_BYTES(n) bytes). Solo en el host.
+ * @details Cada código se elige con la búsqueda binaria estándar de IMA sobre el
+ * estado que reconstruye el decodificador, así el error no se acumula. El
+ * último bloque se completa repitiendo la última muestra.
+ */
+static inline void adpcm_encode(const uint16_t *in, size_t n, uint8_t *out) {
+    int32_t predictor = n ? ((int32_t)in[0] - 2048) * (1 << ADPCM_INPUT_SHIFT) : 0;
+    uint8_t index = 0;
+    for (size_t base = 0; base < n; base += ADPCM_BLOCK_SAMPLES) {
+        out[0] = (uint8_t)(predictor & 0xFF);
+        out[1] = (uint8_t)((predictor >> 8) & 0xFF);
+        out[2] = index;
+        out[3] = 0;
+        uint8_t *data = out + ADPCM_HEADER_BYTES;
+        for (size_t i = 0; i < ADPCM_BLOCK_SAMPLES; ++i) {
+            size_t k = base + i < n ? base + i : n - 1;
+            int32_t diff = ((int32_t)in[k] - 2048) * (1 << ADPCM_INPUT_SHIFT) - predictor;
+            int32_t step = adpcm_step_table[index];
+            uint8_t code = 0;
+            if (diff < 0) {
+                code = 8;
+                diff = -diff;
+            }
+            if (diff >= step) { code |= 4; diff -= step; }
+            if (diff >= step >> 1) { code |= 2; diff -= step >> 1; }
+            if (diff >= step >> 2) code |= 1;
+            adpcm_step(&predictor, &index, code);
+            if (i & 1) {
+                data[i >> 1] |= (uint8_t)(code << 4);
+            } else {
+                data[i >> 1] = code;
+            }
+        }
+        out += ADPCM_BLOCK_BYTES;
+    }
+}
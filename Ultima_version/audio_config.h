@@ -0,0 +1,89 @@
+/**
+ * @file audio_config.h
+ * @brief Frecuencia de salida del motor de audio, fijada al compilar.
+ * @details OUTPUT_SAMPLE_RATE se elige con -DOUTPUT_SAMPLE_RATE=... entre las
+ * frecuencias soportadas. A partir de ella se derivan en tiempo de compilación:
+ *  - el wrap del PWM para el reloj nominal, el mayor que permite un divisor
+ *    >= 1 (hasta 12 bits). Es el valor por defecto: al arrancar, el
+ *    planificador de reloj (clock_planner.h) elige reloj, wrap y divisor
+ *    exactos y lo reemplaza;
+ *  - el incremento 16.16 que reproduce el banco de muestras a su velocidad
+ *    original cuando su frecuencia (AUDIO_SAMPLE_RATE) no coincide con la de
+ *    salida. Si coinciden, las voces usan el bucle sin interpolar.
+ * Con -DAUDIO_ADPCM=1 el banco es el IMA-ADPCM de audio_table_adpcm.h, y con
+ * -DAUDIO_PACKED12=1 el empaquetado sin pérdida de audio_table_packed.h; cada
+ * voz los decodifica en una ventana propia. Con -DAUDIO_LZ=1 el banco LZ de
+ * audio_table_lz.h se descomprime entero a SRAM al arrancar y suena como el PCM.
+ * Los tres se generan con tools/bank_gen.c. Con el banco PCM,
+ * -DAUDIO_PREFIX_CACHE=N copia a SRAM las N primeras muestras de cada sonido
+ * para que los ataques no esperen a la flash; el resto se precarga por DMA y
+ * -DAUDIO_XIP_STREAM=1 lo carga por el flujo XIP sin pasar por su caché. Un
+ * trozo que no llegó a precargarse se carga al leerlo y el mezclador espera al
+ * DMA (se cuenta como carga tardía): las colas no se leen por la caché XIP.
+ * La caché cubre solo el comienzo del sonido: las partes que empiezan más
+ * adelante y los sonidos al revés arrancan leyendo la flash, como sin caché.
+ * Debe incluirse después del banco de muestras (audio_table.h) para que la
+ * comprobación de frecuencias sea efectiva. No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifndef OUTPUT_SAMPLE_RATE
+#define OUTPUT_SAMPLE_RATE 24000 ///< Frecuencia de salida en Hz.
+#endif
+
+#ifndef AUDIO_SYS_CLOCK_HZ
+#define AUDIO_SYS_CLOCK_HZ 125000000u ///< Reloj del sistema con el que se calcula el PWM.
+#endif
+
+_Static_assert(OUTPUT_SAMPLE_RATE == 16000 || OUTPUT_SAMPLE_RATE == 24000 || OUTPUT_SAMPLE_RATE == 32000 ||
+                   OUTPUT_SAMPLE_RATE == 44100 || OUTPUT_SAMPLE_RATE == 48000,
+               "OUTPUT_SAMPLE_RATE debe ser 16000, 24000, 32000, 44100 o 48000");
+
+// --- PWM ---
+#define PWM_MAX_WRAP 4095 ///< Un ciclo de 12 bits, la resolución de las muestras.
+#define PWM_WRAP ((AUDIO_SYS_CLOCK_HZ / OUTPUT_SAMPLE_RATE - 1) < PWM_MAX_WRAP \
+                      ? (AUDIO_SYS_CLOCK_HZ / OUTPUT_SAMPLE_RATE - 1)           \
+                      : PWM_MAX_WRAP)
+_Static_assert(PWM_WRAP >= 1023, "El reloj del sistema no alcanza 10 bits de PWM a esta frecuencia");
+
+// --- Banco de muestras ---
+#ifdef AUDIO_SAMPLE_RATE
+#define BANK_SAMPLE_RATE AUDIO_SAMPLE_RATE
+#else
+#define BANK_SAMPLE_RATE OUTPUT_SAMPLE_RATE // Sin banco (pruebas en el host): sin remuestreo
+#endif
+
+// El banco se reproduce con un incremento fijo; se admite hasta una octava de diferencia
+// para que la transposición de pitch.h siga cabiendo en 16.16 sin perder calidad
+_Static_assert(BANK_SAMPLE_RATE * 2 >= OUTPUT_SAMPLE_RATE && BANK_SAMPLE_RATE <= OUTPUT_SAMPLE_RATE * 2,
+               "La frecuencia del banco de muestras difiere más de una octava de OUTPUT_SAMPLE_RATE");
+
+#ifndef AUDIO_ADPCM
+#define AUDIO_ADPCM 0 ///< 1: banco IMA-ADPCM de 4 bits por muestra (ver adpcm.h).
+#endif
+#ifndef AUDIO_PACKED12
+#define AUDIO_PACKED12 0 ///< 1: banco de 12 bits empaquetados, dos muestras en 3 bytes (ver packed12.h).
+#endif
+#ifndef AUDIO_LZ
+#define AUDIO_LZ 0 ///< 1: banco comprimido sin pérdida que se descomprime a SRAM al arrancar (ver lz_bank.h).
+#endif
+_Static_assert(AUDIO_ADPCM + AUDIO_PACKED12 + AUDIO_LZ <= 1, "Elegir un solo formato de banco");
+#ifndef AUDIO_PREFIX_CACHE
+#define AUDIO_PREFIX_CACHE 0 ///< Muestras del inicio de cada sonido PCM copiadas a SRAM al arrancar (0 = sin caché).
+#endif
+_Static_assert(AUDIO_PREFIX_CACHE == 0 || AUDIO_ADPCM + AUDIO_PACKED12 + AUDIO_LZ == 0,
+               "La caché de prefijo es para el banco PCM en flash");
+/// Las voces PCM leen de la ventana con trozos precargados por DMA (ver voice_stream.h).
+#define VOICE_STREAM_PREFETCH (AUDIO_PREFIX_CACHE > 0)
+#ifndef AUDIO_XIP_STREAM
+#define AUDIO_XIP_STREAM 0 ///< 1: los trozos se cargan por el flujo XIP (SSI) en lugar de leer la flash por la caché.
+#endif
+_Static_assert(!AUDIO_XIP_STREAM || VOICE_STREAM_PREFETCH, "AUDIO_XIP_STREAM necesita AUDIO_PREFIX_CACHE");
+/// Las voces pueden leer de una ventana en SRAM por voz (ver voice_stream.h).
+#define VOICE_STREAMS (AUDIO_ADPCM || AUDIO_PACKED12 || VOICE_STREAM_PREFETCH)
+
+#define BANK_RESAMPLE (BANK_SAMPLE_RATE != OUTPUT_SAMPLE_RATE)
+/// Avance 16.16 por muestra de salida que reproduce el banco a su velocidad original.
+#define BANK_INCREMENT ((uint32_t)(((uint64_t)BANK_SAMPLE_RATE << 16) / OUTPUT_SAMPLE_RATE))
@@ -0,0 +1,356 @@
+// Generado por tools/bank_gen.c a partir de audio_table.h; no editar.
+// Bloques IMA-ADPCM de 256 muestras (ver adpcm.h).
+
+#define AUDIO_SAMPLE_RATE 24000
+#define SNARE_SIZE 3600
+#define KICK_SIZE 3600
+#define HIHAT_SIZE 2694
+#define AUDIO_BITS_PER_SAMPLE 12
+
+const uint8_t kick_adpcm[1980] = {
+48, 0, 0, 0, 240, 246, 247, 167, 125, 138, 2, 10, 113, 168, 42, 242, 
+41, 0, 32, 31, 160, 19, 248, 32, 129, 9, 26, 153, 156, 97, 18, 154, 
+217, 135, 40, 144, 185, 51, 47, 193, 147, 25, 145, 47, 17, 27, 129, 128, 
+216, 136, 146, 132, 242, 41, 130, 92, 136, 144, 137, 40, 145, 175, 97, 209, 
+139, 36, 184, 120, 21, 136, 168, 187, 8, 136, 8, 152, 139, 8, 88, 165, 
+176, 57, 7, 153, 33, 40, 83, 136, 42, 52, 134, 168, 0, 16, 1, 136, 
+153, 137, 169, 170, 188, 188, 172, 202, 203, 203, 170, 187, 156, 187, 156, 172, 
+216, 128, 155, 170, 227, 24, 148, 30, 8, 16, 184, 137, 33, 138, 121, 200, 
+135, 16, 168, 169, 199, 153, 59, 0, 20, 59, 87, 129, 153, 138, 137, 136, 
+1, 34, 35, 36, 52, 52, 52, 52, 67, 67, 50, 67, 50, 51, 51, 51, 
+35, 34, 34, 17, 16, 16, 0, 0, 0, 24, 136, 185, 195, 249, 184, 236, 
+186, 248, 171, 219, 26, 172, 63, 203, 1, 202, 16, 136, 185, 242, 9, 170, 
+26, 174, 154, 172, 138, 200, 240, 172, 160, 12, 153, 141, 168, 202, 138, 128, 
+185, 171, 186, 203, 203, 188, 187, 173, 187, 188, 186, 172, 187, 170, 170, 153, 
+153, 137, 137, 152, 144, 136, 136, 8, 0, 24, 65, 50, 86, 67, 67, 83, 
+67, 67, 52, 67, 67, 36, 36, 36, 36, 52, 21, 18, 39, 106, 17, 32, 
+35, 41, 133, 144, 133, 16, 128, 48, 154, 225, 50, 0, 1, 56, 68, 91, 
+16, 72, 147, 66, 150, 33, 3, 65, 36, 65, 32, 49, 83, 65, 19, 35, 
+51, 52, 35, 18, 4, 32, 36, 50, 67, 33, 67, 51, 51, 51, 67, 34, 
+50, 50, 34, 33, 18, 17, 2, 16, 129, 128, 9, 170, 207, 189, 220, 203, 
+219, 203, 219, 187, 188, 188, 173, 203, 187, 204, 202, 171, 188, 218, 186, 188, 
+186, 173, 187, 204, 201, 186, 235, 154, 169, 203, 153, 140, 9, 26, 152, 143, 
+144, 171, 180, 170, 180, 142, 137, 170, 154, 156, 172, 157, 153, 171, 248, 153, 
+200, 154, 187, 155, 186, 203, 172, 171, 171, 188, 185, 168, 159, 170, 144, 153, 
+153, 154, 137, 153, 153, 154, 155, 12, 144, 152, 168, 153, 146, 131, 21, 0, 
+145, 8, 81, 25, 41, 40, 66, 119, 67, 34, 37, 52, 52, 83, 52, 50, 
+53, 67, 52, 50, 52, 68, 51, 67, 52, 36, 36, 51, 36, 50, 68, 51, 
+115, 17, 50, 50, 38, 130, 20, 2, 51, 99, 17, 51, 99, 32, 1, 16, 
+135, 16, 2, 32, 18, 96, 18, 32, 67, 34, 17, 49, 6, 49, 51, 53, 
+50, 67, 34, 66, 18, 21, 34, 56, 69, 17, 17, 51, 68, 19, 136, 160, 
+32, 55, 83, 16, 129, 8, 82, 17, 152, 185, 144, 25, 176, 205, 24, 140, 
+48, 41, 178, 220, 232, 25, 140, 129, 1, 201, 153, 138, 17, 169, 204, 190, 
+156, 185, 201, 8, 169, 156, 188, 219, 172, 189, 170, 171, 185, 218, 218, 203, 
+216, 69, 45, 0, 202, 187, 203, 157, 170, 187, 139, 175, 168, 203, 186, 187, 
+185, 219, 187, 157, 153, 171, 188, 173, 202, 152, 169, 203, 172, 169, 153, 154, 
+220, 154, 154, 152, 144, 168, 171, 153, 185, 188, 158, 153, 24, 17, 187, 203, 
+172, 172, 10, 173, 0, 202, 194, 170, 185, 203, 1, 255, 156, 139, 16, 170, 
+138, 153, 216, 202, 184, 140, 152, 11, 218, 187, 169, 204, 173, 172, 184, 186, 
+201, 203, 187, 186, 186, 191, 203, 173, 170, 170, 171, 188, 185, 219, 203, 154, 
+203, 169, 171, 204, 154, 172, 154, 203, 186, 153, 156, 169, 187, 220, 9, 152, 
+154, 188, 11, 138, 128, 144, 130, 115, 50, 20, 66, 50, 50, 67, 68, 51, 
+33, 50, 83, 51, 120, 154, 23, 0, 52, 52, 52, 52, 83, 83, 52, 52, 
+83, 66, 67, 51, 52, 52, 52, 52, 67, 67, 67, 67, 51, 83, 51, 67, 
+36, 67, 50, 52, 51, 52, 52, 51, 52, 52, 51, 52, 67, 51, 52, 51, 
+52, 52, 51, 52, 51, 52, 67, 51, 51, 35, 36, 50, 66, 36, 34, 17, 
+49, 68, 52, 34, 50, 66, 67, 67, 36, 67, 66, 51, 67, 35, 36, 51, 
+52, 51, 67, 51, 67, 51, 67, 35, 36, 35, 50, 49, 35, 52, 49, 50, 
+34, 49, 51, 50, 16, 35, 48, 48, 64, 128, 133, 48, 12, 60, 139, 208, 
+192, 176, 191, 234, 187, 236, 170, 187, 189, 189, 189, 188, 189, 188, 187, 188, 
+189, 188, 188, 203, 187, 204, 202, 187, 53, 88, 43, 0, 188, 203, 203, 203, 
+187, 188, 203, 188, 187, 203, 171, 188, 187, 173, 172, 203, 187, 187, 187, 204, 
+203, 187, 187, 188, 187, 204, 202, 186, 187, 188, 203, 187, 188, 187, 188, 203, 
+186, 172, 187, 172, 187, 188, 202, 186, 203, 186, 187, 203, 187, 203, 186, 172, 
+187, 187, 203, 171, 187, 187, 187, 219, 187, 187, 201, 169, 186, 155, 137, 153, 
+10, 138, 138, 67, 51, 72, 115, 67, 69, 51, 83, 35, 52, 83, 53, 68, 
+51, 52, 51, 67, 66, 52, 52, 51, 52, 53, 67, 67, 50, 67, 67, 67, 
+67, 50, 52, 67, 67, 51, 67, 51, 52, 52, 52, 67, 51, 52, 51, 52, 
+52, 67, 51, 67, 36, 51, 52, 51, 67, 67, 67, 51, 111, 248, 41, 0, 
+67, 51, 36, 36, 51, 67, 51, 67, 51, 52, 67, 51, 67, 50, 67, 67, 
+50, 67, 50, 51, 52, 51, 36, 35, 51, 68, 50, 51, 67, 51, 36, 51, 
+51, 36, 66, 50, 36, 35, 34, 3, 18, 49, 51, 130, 176, 8, 12, 192, 
+190, 235, 203, 185, 204, 172, 187, 203, 218, 186, 188, 219, 187, 203, 203, 202, 
+187, 204, 170, 203, 186, 188, 203, 203, 171, 188, 203, 187, 172, 172, 187, 173, 
+203, 186, 187, 204, 202, 170, 187, 202, 203, 171, 188, 187, 188, 203, 187, 203, 
+186, 188, 203, 202, 186, 203, 186, 186, 187, 204, 187, 172, 156, 170, 187, 188, 
+186, 202, 186, 188, 186, 203, 187, 203, 187, 171, 141, 153, 171, 203, 186, 188, 
+172, 250, 17, 0, 153, 168, 176, 128, 192, 128, 188, 139, 112, 35, 51, 51, 
+4, 3, 120, 83, 33, 40, 82, 50, 50, 50, 38, 35, 83, 33, 36, 83, 
+51, 65, 19, 52, 68, 33, 33, 67, 51, 52, 67, 35, 83, 17, 36, 50, 
+34, 34, 22, 50, 35, 56, 38, 35, 32, 48, 36, 48, 0, 4, 88, 3, 
+3, 8, 8, 143, 128, 12, 188, 172, 203, 187, 203, 159, 201, 186, 202, 187, 
+188, 169, 172, 219, 172, 203, 170, 219, 186, 203, 187, 172, 203, 202, 186, 188, 
+187, 188, 203, 172, 202, 170, 172, 201, 155, 188, 171, 172, 171, 219, 186, 187, 
+187, 188, 203, 187, 188, 172, 154, 156, 186, 186, 186, 192, 128, 203, 187, 188, 
+184, 8, 141, 75, 0, 244, 9, 0, 139, 64, 128, 128, 128, 128, 112, 65, 
+48, 64, 52, 48, 64, 52, 67, 67, 114, 19, 67, 65, 19, 33, 82, 17, 
+66, 132, 50, 66, 65, 35, 33, 50, 51, 115, 66, 19, 52, 50, 50, 98, 
+33, 35, 35, 51, 36, 115, 130, 20, 18, 50, 50, 23, 33, 1, 50, 120, 
+56, 34, 34, 50, 23, 33, 81, 49, 35, 82, 17, 66, 50, 35, 21, 36, 
+65, 19, 66, 18, 50, 21, 66, 50, 50, 21, 36, 35, 20, 20, 50, 21, 
+51, 34, 53, 67, 65, 49, 35, 36, 35, 83, 65, 50, 20, 35, 68, 49, 
+33, 82, 19, 66, 18, 36, 81, 17, 20, 51, 66, 35, 36, 83, 49, 65, 
+50, 18, 35, 22, 50, 35, 50, 3, 209, 7, 8, 0, 83, 22, 18, 36, 
+33, 5, 33, 130, 51, 56, 52, 36, 115, 18, 66, 16, 133, 18, 34, 34, 
+51, 36, 48, 64, 36, 48, 0, 88, 3, 64, 128, 53, 128, 4, 8, 133, 
+48, 0, 104, 8, 88, 8, 8, 8, 8, 248, 128, 12, 192, 128, 12, 192, 
+192, 187, 192, 187, 200, 184, 189, 187, 188, 203, 203, 186, 188, 187, 188, 175, 
+201, 169, 171, 171, 158, 156, 155, 156, 156, 185, 170, 157, 186, 218, 171, 171, 
+219, 201, 186, 202, 201, 201, 153, 171, 170, 158, 201, 185, 169, 172, 219, 185, 
+171, 172, 171, 219, 201, 169, 156, 171, 218, 169, 171, 157, 156, 155, 170, 157, 
+154, 172, 169, 219, 169, 218, 169, 171, 157, 170, 156, 170, 15, 255, 13, 0, 
+157, 169, 170, 158, 169, 169, 171, 187, 203, 203, 138, 143, 169, 170, 186, 203, 
+176, 188, 176, 188, 172, 139, 188, 139, 140, 139, 13, 12, 139, 139, 13, 184, 
+8, 141, 128, 128, 128, 15, 8, 136, 128, 128, 144, 23, 8, 8, 8, 7, 
+8, 4, 8, 133, 64, 128, 64, 64, 128, 4, 3, 128, 134, 128, 133, 3, 
+132, 48, 128, 5, 8, 88, 128, 64, 128, 128, 96, 8, 8, 133, 128, 133, 
+48, 0, 8, 134, 64, 128, 128, 80, 128, 128, 128, 7, 8, 136, 5, 8, 
+88, 128, 4, 8, 133, 48, 0, 8, 134, 128, 133, 128, 133, 128, 128, 133, 
+128, 0, 8, 120, 128, 128, 8, 8, 8, 121, 129, 128, 128, 112, 128, 128, 
+240, 253, 5, 0, 128, 112, 59, 128, 8, 104, 128, 64, 128, 80, 8, 8, 
+104, 8, 88, 8, 8, 4, 8, 4, 8, 133, 128, 128, 128, 112, 128, 64, 
+128, 128, 134, 128, 80, 8, 8, 128, 128, 7, 8, 136, 128, 128, 112, 129, 
+8, 8, 8, 9, 112, 129, 128, 128, 128, 0, 0, 112, 129, 128, 128, 128, 
+0, 0, 0, 0, 0, 240, 9, 128, 128, 128, 0, 240, 9, 128, 128, 240, 
+8, 136, 128, 240, 8, 8, 128, 14, 8, 8, 232, 128, 128, 128, 14, 8, 
+8, 8, 15, 8, 8, 128, 128, 15, 8, 136, 128, 128, 240, 9, 8, 8, 
+8, 9, 0, 0, 240, 9, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 80, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 112, 129, 128, 128, 128, 0, 0, 0, 0, 112, 129, 128, 128, 
+128, 0, 0, 23, 8, 8, 8, 8, 112, 129, 128, 128, 128, 112, 129, 128, 
+128, 128, 112, 129, 128, 128, 112, 128, 128, 128, 112, 8, 8, 128, 96, 8, 
+8, 8, 120, 128, 128, 8, 5, 8, 8, 120, 128, 128, 8, 104, 128, 128, 
+128, 6, 8, 8, 8, 135, 128, 0, 8, 134, 128, 128, 128, 7, 8, 136, 
+128, 112, 8, 8, 128, 128, 7, 8, 136, 128, 112, 8, 8, 128, 128, 112, 
+128, 128, 128, 128, 7, 8, 128, 128, 128, 112, 129, 128, 128, 128, 112, 129, 
+128, 128, 128, 0, 23, 8, 8, 8, 225, 255, 1, 0, 8, 112, 129, 128, 
+128, 128, 0, 112, 129, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const uint8_t snare_adpcm[1980] = {
+176, 255, 0, 0, 112, 255, 255, 255, 29, 177, 139, 0, 129, 92, 233, 69, 
+187, 71, 128, 154, 0, 17, 16, 10, 195, 123, 3, 220, 33, 160, 25, 131, 
+172, 17, 1, 160, 170, 32, 162, 65, 251, 56, 161, 44, 147, 234, 73, 177, 
+155, 144, 9, 200, 27, 147, 156, 209, 25, 155, 3, 223, 49, 145, 8, 148, 
+17, 18, 172, 96, 2, 32, 0, 66, 162, 136, 40, 17, 67, 22, 33, 27, 
+20, 19, 83, 49, 87, 160, 129, 40, 49, 178, 175, 10, 32, 18, 168, 154, 
+250, 12, 2, 203, 137, 153, 234, 43, 192, 172, 168, 48, 147, 174, 0, 187, 
+185, 11, 51, 144, 80, 129, 190, 16, 186, 37, 128, 89, 130, 52, 176, 141, 
+131, 113, 130, 18, 145, 245, 52, 0, 41, 180, 24, 115, 133, 24, 0, 129, 
+136, 115, 25, 160, 128, 83, 17, 206, 81, 130, 153, 139, 133, 32, 154, 73, 
+146, 233, 25, 26, 147, 185, 139, 173, 139, 227, 43, 153, 25, 252, 10, 145, 
+57, 169, 177, 44, 49, 185, 33, 39, 143, 18, 42, 128, 24, 68, 130, 171, 
+24, 22, 153, 57, 21, 35, 207, 66, 144, 58, 17, 130, 137, 164, 24, 65, 
+140, 50, 147, 26, 137, 50, 184, 39, 3, 17, 221, 9, 185, 166, 43, 15, 
+128, 192, 19, 31, 168, 161, 90, 201, 2, 152, 16, 138, 203, 137, 67, 9, 
+144, 171, 153, 121, 188, 7, 9, 144, 2, 0, 3, 31, 34, 184, 2, 92, 
+168, 4, 128, 16, 44, 177, 115, 0, 83, 10, 58, 0, 26, 24, 179, 6, 
+10, 145, 209, 58, 34, 186, 128, 151, 88, 17, 57, 170, 41, 249, 136, 227, 
+42, 146, 136, 18, 227, 137, 171, 58, 138, 156, 177, 23, 154, 9, 186, 160, 
+124, 138, 162, 66, 184, 143, 137, 179, 9, 72, 131, 205, 49, 194, 0, 163, 
+134, 29, 0, 49, 136, 40, 80, 136, 97, 10, 145, 2, 1, 160, 55, 168, 
+1, 203, 82, 1, 153, 130, 123, 58, 249, 0, 128, 0, 137, 243, 0, 25, 
+9, 25, 157, 179, 136, 5, 30, 145, 168, 49, 8, 201, 160, 76, 154, 25, 
+129, 251, 153, 75, 179, 43, 10, 80, 144, 235, 37, 8, 1, 88, 201, 41, 
+131, 30, 24, 165, 145, 33, 138, 6, 9, 88, 176, 41, 217, 4, 56, 0, 
+48, 8, 138, 84, 203, 21, 137, 128, 10, 67, 226, 43, 17, 178, 155, 20, 
+193, 14, 1, 169, 163, 61, 152, 161, 92, 154, 164, 9, 0, 177, 9, 138, 
+35, 16, 12, 251, 47, 144, 193, 24, 57, 235, 32, 153, 43, 72, 163, 144, 
+181, 154, 39, 25, 129, 24, 106, 41, 136, 49, 64, 198, 40, 0, 72, 194, 
+16, 184, 18, 52, 143, 2, 152, 179, 97, 152, 156, 33, 170, 148, 170, 130, 
+227, 106, 137, 137, 160, 33, 34, 205, 0, 64, 187, 28, 193, 147, 32, 200, 
+11, 169, 61, 151, 26, 137, 40, 129, 10, 208, 18, 185, 121, 128, 104, 169, 
+32, 20, 186, 36, 201, 67, 184, 180, 123, 129, 137, 132, 11, 33, 152, 40, 
+245, 5, 50, 0, 91, 151, 12, 130, 0, 2, 25, 168, 48, 159, 144, 161, 
+33, 123, 176, 186, 16, 3, 62, 134, 156, 128, 2, 8, 28, 130, 175, 32, 
+192, 2, 156, 64, 0, 177, 24, 186, 114, 169, 16, 192, 107, 128, 129, 49, 
+203, 4, 9, 2, 140, 145, 104, 170, 3, 1, 1, 90, 9, 88, 235, 50, 
+146, 210, 136, 52, 10, 28, 40, 16, 58, 244, 60, 162, 12, 146, 41, 17, 
+201, 41, 145, 216, 40, 185, 4, 11, 133, 13, 130, 149, 141, 56, 25, 10, 
+194, 16, 128, 58, 131, 207, 177, 81, 161, 26, 161, 3, 190, 97, 153, 0, 
+33, 43, 74, 195, 131, 27, 82, 176, 6, 144, 138, 21, 136, 225, 9, 64, 
+27, 164, 31, 163, 228, 2, 58, 0, 26, 56, 184, 240, 32, 2, 12, 145, 
+56, 178, 208, 48, 82, 171, 9, 150, 8, 146, 187, 123, 136, 19, 191, 82, 
+170, 1, 153, 35, 144, 152, 0, 29, 33, 241, 3, 139, 19, 8, 15, 129, 
+128, 27, 180, 137, 57, 184, 6, 43, 3, 153, 205, 20, 65, 157, 24, 22, 
+13, 17, 145, 170, 179, 96, 153, 128, 146, 76, 136, 216, 16, 144, 0, 115, 
+202, 16, 17, 140, 130, 178, 50, 139, 88, 154, 134, 9, 40, 153, 136, 188, 
+39, 161, 40, 144, 25, 122, 216, 57, 216, 35, 185, 154, 48, 57, 250, 65, 
+170, 19, 216, 41, 24, 74, 170, 24, 135, 0, 160, 73, 137, 133, 156, 130, 
+152, 59, 120, 144, 17, 179, 172, 24, 168, 253, 46, 0, 121, 210, 9, 1, 
+168, 19, 56, 210, 27, 17, 24, 159, 5, 186, 99, 17, 188, 34, 234, 17, 
+146, 60, 2, 141, 2, 168, 18, 142, 50, 202, 36, 27, 193, 0, 27, 35, 
+249, 9, 34, 189, 20, 170, 4, 136, 128, 27, 16, 11, 7, 147, 143, 130, 
+168, 64, 200, 48, 129, 138, 194, 120, 152, 25, 131, 10, 168, 39, 140, 128, 
+25, 133, 27, 129, 173, 148, 24, 185, 89, 129, 129, 140, 162, 122, 3, 9, 
+232, 73, 177, 168, 17, 57, 194, 123, 160, 145, 65, 156, 1, 128, 50, 139, 
+148, 45, 82, 216, 89, 176, 8, 129, 137, 184, 100, 169, 136, 72, 200, 26, 
+178, 48, 2, 203, 80, 152, 156, 132, 48, 137, 129, 25, 139, 255, 43, 0, 
+159, 66, 168, 40, 180, 73, 160, 28, 19, 135, 171, 17, 202, 44, 33, 3, 
+202, 49, 170, 184, 3, 157, 90, 71, 192, 9, 128, 24, 1, 209, 80, 160, 
+168, 81, 169, 57, 160, 147, 163, 137, 115, 189, 34, 156, 106, 144, 129, 0, 
+168, 112, 153, 1, 153, 137, 4, 195, 33, 175, 149, 10, 161, 41, 177, 35, 
+26, 62, 161, 168, 226, 64, 0, 168, 133, 156, 130, 57, 17, 14, 21, 169, 
+1, 136, 152, 128, 8, 15, 3, 143, 148, 9, 72, 8, 130, 9, 160, 179, 
+24, 115, 34, 0, 177, 152, 31, 33, 189, 152, 51, 159, 129, 136, 11, 166, 
+1, 24, 27, 168, 31, 225, 20, 139, 9, 177, 33, 24, 49, 168, 168, 10, 
+24, 252, 38, 0, 183, 160, 115, 160, 34, 0, 137, 57, 232, 1, 132, 188, 
+115, 129, 14, 176, 17, 0, 131, 27, 155, 154, 69, 212, 73, 168, 56, 146, 
+8, 8, 144, 251, 88, 18, 172, 51, 173, 131, 129, 168, 27, 34, 168, 76, 
+25, 176, 19, 249, 208, 49, 177, 44, 160, 92, 136, 186, 135, 32, 186, 34, 
+186, 88, 153, 178, 122, 147, 138, 33, 160, 0, 5, 74, 35, 172, 165, 91, 
+193, 57, 138, 163, 170, 89, 179, 61, 164, 11, 196, 96, 136, 160, 128, 0, 
+42, 158, 0, 134, 27, 2, 1, 139, 179, 6, 45, 169, 6, 152, 153, 16, 
+46, 16, 160, 144, 74, 184, 132, 178, 136, 0, 45, 40, 240, 1, 201, 90, 
+19, 26, 129, 224, 9, 255, 49, 0, 41, 144, 0, 16, 40, 204, 90, 195, 
+162, 140, 131, 24, 207, 33, 162, 26, 131, 9, 7, 32, 9, 49, 234, 67, 
+153, 200, 64, 177, 129, 97, 155, 16, 145, 77, 192, 33, 1, 14, 130, 136, 
+160, 202, 120, 176, 40, 8, 177, 88, 184, 0, 179, 139, 41, 210, 159, 32, 
+9, 0, 146, 7, 24, 26, 209, 137, 40, 137, 37, 171, 96, 185, 18, 161, 
+36, 234, 52, 139, 26, 51, 189, 216, 49, 144, 49, 188, 132, 73, 49, 56, 
+156, 11, 215, 41, 41, 178, 48, 201, 21, 168, 91, 0, 193, 169, 97, 17, 
+173, 130, 137, 17, 185, 17, 34, 143, 2, 8, 140, 211, 137, 8, 145, 130, 
+113, 209, 160, 49, 160, 10, 57, 15, 241, 252, 46, 0, 24, 168, 180, 43, 
+35, 45, 151, 10, 4, 170, 80, 160, 0, 41, 243, 24, 33, 40, 155, 121, 
+152, 32, 34, 232, 130, 149, 15, 8, 128, 9, 130, 56, 161, 9, 128, 220, 
+26, 131, 2, 164, 2, 47, 209, 26, 130, 58, 177, 193, 72, 11, 6, 172, 
+3, 10, 145, 28, 8, 192, 18, 164, 72, 170, 155, 151, 219, 96, 145, 26, 
+24, 161, 24, 7, 169, 48, 146, 9, 13, 181, 11, 23, 137, 16, 11, 19, 
+26, 17, 25, 160, 176, 166, 159, 133, 26, 144, 34, 157, 138, 18, 131, 43, 
+217, 33, 90, 21, 190, 17, 32, 162, 8, 187, 129, 184, 104, 134, 140, 64, 
+203, 131, 153, 193, 41, 128, 48, 137, 5, 141, 16, 160, 231, 252, 40, 0, 
+73, 192, 1, 65, 218, 2, 18, 42, 45, 150, 90, 184, 145, 98, 152, 129, 
+0, 75, 131, 185, 145, 54, 170, 41, 45, 226, 60, 194, 40, 8, 168, 33, 
+233, 17, 60, 160, 171, 0, 5, 13, 1, 10, 25, 177, 131, 45, 34, 163, 
+250, 40, 16, 93, 176, 10, 16, 200, 7, 42, 162, 44, 12, 130, 43, 178, 
+147, 0, 146, 9, 1, 178, 112, 55, 10, 136, 114, 152, 8, 25, 192, 194, 
+136, 10, 74, 211, 113, 137, 163, 155, 41, 41, 252, 66, 144, 58, 152, 146, 
+195, 26, 37, 141, 132, 140, 19, 155, 48, 232, 0, 0, 137, 30, 20, 169, 
+168, 26, 176, 40, 148, 146, 76, 7, 45, 144, 160, 26, 0, 1, 0, 10, 
+35, 254, 36, 0, 163, 226, 48, 178, 63, 19, 17, 211, 18, 155, 69, 44, 
+154, 161, 186, 7, 26, 16, 176, 89, 161, 233, 32, 171, 5, 10, 3, 158, 
+1, 41, 128, 11, 167, 56, 160, 59, 184, 158, 5, 138, 146, 34, 58, 161, 
+70, 185, 115, 185, 168, 37, 10, 184, 156, 32, 56, 160, 193, 91, 18, 201, 
+20, 58, 218, 134, 10, 129, 1, 137, 178, 123, 210, 60, 130, 10, 161, 31, 
+2, 8, 160, 137, 19, 177, 206, 73, 17, 160, 3, 232, 89, 144, 145, 41, 
+129, 16, 178, 11, 41, 39, 155, 250, 64, 128, 185, 144, 65, 9, 65, 152, 
+68, 176, 8, 41, 33, 207, 32, 3, 236, 49, 216, 41, 163, 41, 156, 9, 
+36, 144, 26, 146, 174, 255, 36, 0, 1, 29, 226, 10, 34, 146, 16, 8, 
+112, 152, 30, 145, 18, 27, 65, 206, 19, 169, 132, 10, 136, 139, 115, 184, 
+26, 1, 162, 78, 0, 208, 17, 8, 10, 17, 10, 7, 136, 240, 17, 1, 
+11, 0, 50, 90, 152, 154, 128, 202, 196, 120, 192, 18, 42, 160, 28, 147, 
+193, 12, 17, 201, 50, 161, 75, 217, 130, 40, 171, 113, 185, 34, 139, 18, 
+213, 58, 130, 129, 65, 249, 73, 169, 16, 137, 1, 153, 20, 44, 5, 176, 
+44, 130, 56, 22, 189, 18, 1, 234, 48, 154, 4, 177, 12, 33, 216, 49, 
+25, 128, 161, 129, 47, 147, 11, 32, 159, 136, 17, 242, 138, 73, 132, 8, 
+10, 130, 217, 18, 144, 73, 132, 90, 21, 1, 39, 0, 185, 88, 137, 209, 
+144, 33, 50, 176, 128, 128, 0, 8, 136, 0, 136, 0, 136, 0, 8, 8, 
+8, 136, 128, 128, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const uint8_t hihat_adpcm[1452] = {
+80, 0, 0, 0, 240, 127, 39, 112, 141, 77, 120, 252, 82, 153, 176, 120, 
+152, 8, 162, 95, 168, 130, 193, 64, 201, 34, 10, 41, 152, 16, 9, 24, 
+184, 113, 204, 135, 75, 209, 33, 154, 32, 137, 145, 161, 88, 168, 24, 161, 
+64, 31, 178, 163, 58, 228, 40, 193, 64, 185, 52, 15, 195, 40, 176, 34, 
+31, 162, 57, 240, 18, 138, 2, 139, 167, 74, 160, 73, 184, 49, 186, 20, 
+28, 145, 24, 153, 131, 26, 178, 124, 137, 72, 202, 133, 152, 88, 170, 132, 
+26, 145, 24, 138, 132, 11, 34, 15, 163, 90, 169, 149, 42, 226, 33, 169, 
+33, 44, 136, 25, 16, 217, 4, 216, 132, 58, 26, 144, 144, 17, 46, 178, 
+58, 198, 73, 192, 215, 224, 82, 0, 33, 28, 178, 56, 169, 19, 14, 147, 
+43, 195, 56, 184, 146, 180, 124, 138, 181, 56, 184, 48, 216, 18, 168, 104, 
+170, 132, 152, 72, 26, 216, 133, 43, 194, 16, 144, 57, 192, 96, 155, 19, 
+29, 210, 49, 140, 147, 9, 146, 108, 153, 163, 8, 177, 2, 136, 8, 146, 
+79, 176, 80, 12, 130, 11, 166, 41, 209, 33, 185, 4, 44, 0, 44, 161, 
+40, 137, 162, 145, 198, 89, 168, 32, 11, 18, 31, 146, 91, 208, 2, 184, 
+149, 41, 160, 48, 30, 129, 42, 193, 17, 137, 161, 181, 122, 153, 33, 140, 
+131, 10, 179, 0, 193, 49, 139, 65, 31, 129, 138, 147, 33, 143, 181, 1, 
+152, 1, 0, 46, 178, 56, 11, 195, 155, 247, 69, 0, 130, 40, 63, 152, 
+145, 24, 40, 250, 20, 171, 167, 57, 176, 32, 152, 179, 108, 160, 73, 10, 
+16, 10, 177, 148, 177, 120, 170, 133, 27, 130, 28, 164, 74, 208, 130, 40, 
+44, 8, 144, 73, 43, 57, 251, 150, 176, 19, 28, 162, 74, 192, 49, 140, 
+131, 44, 178, 73, 208, 33, 138, 17, 27, 129, 73, 219, 21, 155, 3, 185, 
+135, 44, 178, 89, 200, 3, 44, 161, 73, 184, 49, 171, 4, 43, 40, 171, 
+151, 41, 224, 50, 30, 194, 16, 144, 57, 192, 80, 139, 164, 41, 193, 48, 
+201, 132, 9, 128, 89, 29, 162, 128, 0, 25, 41, 169, 182, 88, 185, 19, 
+233, 132, 58, 153, 130, 137, 17, 75, 28, 195, 72, 170, 141, 246, 64, 0, 
+3, 168, 163, 121, 233, 4, 27, 129, 137, 180, 121, 154, 131, 27, 163, 91, 
+168, 2, 201, 134, 43, 178, 40, 24, 45, 210, 17, 152, 72, 140, 148, 26, 
+17, 29, 178, 146, 152, 5, 29, 162, 74, 209, 33, 201, 19, 12, 180, 73, 
+137, 56, 11, 32, 202, 5, 28, 211, 33, 170, 132, 43, 162, 92, 192, 17, 
+176, 64, 201, 19, 28, 129, 91, 200, 19, 12, 2, 12, 164, 58, 209, 33, 
+185, 133, 59, 209, 48, 185, 51, 142, 131, 44, 129, 27, 196, 17, 154, 132, 
+11, 183, 40, 177, 89, 137, 40, 46, 145, 41, 208, 3, 185, 134, 26, 0, 
+43, 40, 12, 164, 41, 152, 145, 178, 199, 88, 184, 33, 170, 149, 91, 176, 
+92, 250, 64, 0, 64, 28, 0, 10, 146, 8, 40, 248, 149, 42, 161, 73, 
+184, 49, 12, 195, 72, 200, 49, 12, 1, 200, 132, 26, 227, 48, 154, 18, 
+45, 0, 27, 212, 48, 170, 19, 12, 164, 91, 184, 34, 155, 20, 30, 211, 
+1, 136, 24, 57, 155, 149, 57, 30, 179, 73, 184, 49, 217, 19, 12, 180, 
+73, 9, 26, 243, 2, 152, 130, 78, 168, 33, 170, 132, 26, 1, 45, 193, 
+33, 154, 147, 24, 241, 33, 153, 72, 27, 56, 30, 226, 18, 138, 17, 200, 
+34, 171, 5, 28, 146, 76, 176, 49, 187, 151, 41, 160, 73, 208, 18, 27, 
+16, 139, 166, 90, 184, 18, 170, 167, 24, 0, 43, 178, 73, 184, 131, 94, 
+184, 2, 144, 24, 130, 0, 53, 0, 160, 1, 226, 88, 9, 26, 8, 162, 
+75, 242, 2, 43, 178, 123, 168, 48, 201, 131, 128, 106, 139, 164, 56, 170, 
+50, 188, 134, 42, 226, 48, 138, 178, 32, 25, 184, 112, 11, 196, 56, 184, 
+34, 11, 40, 216, 50, 46, 208, 34, 171, 134, 43, 195, 73, 137, 16, 44, 
+209, 131, 25, 25, 176, 2, 184, 52, 143, 164, 58, 194, 105, 169, 131, 10, 
+2, 29, 179, 57, 9, 25, 243, 33, 140, 181, 56, 208, 33, 11, 34, 31, 
+161, 73, 192, 33, 170, 133, 27, 179, 121, 11, 1, 169, 133, 43, 177, 17, 
+225, 17, 192, 50, 14, 130, 59, 209, 49, 29, 144, 129, 24, 26, 242, 164, 
+24, 24, 27, 2, 30, 163, 91, 208, 214, 252, 55, 0, 131, 26, 129, 43, 
+194, 32, 225, 2, 10, 179, 57, 145, 62, 128, 9, 121, 155, 150, 25, 152, 
+147, 75, 176, 32, 225, 2, 26, 129, 28, 180, 41, 195, 123, 138, 164, 8, 
+1, 61, 176, 130, 194, 146, 105, 139, 147, 42, 56, 188, 135, 10, 147, 44, 
+195, 56, 138, 56, 233, 150, 58, 193, 48, 170, 35, 15, 162, 56, 10, 40, 
+217, 150, 42, 0, 138, 132, 61, 176, 80, 170, 165, 24, 194, 56, 200, 34, 
+45, 0, 28, 129, 184, 150, 41, 176, 49, 155, 165, 91, 160, 56, 200, 65, 
+171, 167, 24, 177, 72, 169, 132, 60, 136, 73, 170, 19, 201, 4, 11, 164, 
+74, 168, 72, 185, 20, 171, 151, 58, 136, 41, 152, 177, 71, 255, 37, 0, 
+19, 169, 164, 110, 152, 24, 25, 226, 64, 139, 131, 44, 194, 16, 160, 104, 
+27, 176, 131, 194, 89, 10, 162, 41, 152, 64, 140, 147, 0, 29, 212, 131, 
+43, 17, 31, 178, 48, 155, 164, 32, 154, 146, 212, 129, 179, 124, 154, 132, 
+26, 161, 40, 225, 2, 137, 131, 46, 161, 56, 138, 56, 241, 130, 144, 129, 
+76, 152, 32, 43, 26, 230, 32, 208, 131, 59, 8, 41, 201, 20, 12, 130, 
+59, 209, 17, 192, 34, 171, 5, 45, 177, 80, 155, 149, 59, 194, 40, 209, 
+33, 27, 178, 41, 162, 109, 168, 32, 200, 50, 141, 148, 43, 195, 56, 153, 
+64, 187, 151, 25, 194, 16, 145, 76, 160, 48, 140, 164, 58, 210, 72, 169, 
+118, 255, 37, 0, 3, 12, 131, 28, 163, 58, 241, 18, 60, 184, 50, 14, 
+162, 32, 11, 211, 17, 209, 17, 26, 243, 17, 10, 17, 29, 1, 27, 145, 
+128, 211, 32, 168, 49, 250, 149, 74, 153, 48, 171, 36, 141, 164, 57, 184, 
+131, 137, 164, 90, 10, 177, 130, 0, 58, 42, 225, 104, 154, 81, 172, 167, 
+40, 168, 17, 137, 17, 44, 8, 152, 129, 210, 3, 28, 161, 163, 59, 195, 
+120, 171, 134, 43, 161, 145, 17, 11, 146, 128, 8, 32, 63, 242, 40, 243, 
+48, 171, 134, 43, 161, 0, 194, 32, 153, 81, 15, 163, 74, 184, 50, 187, 
+36, 29, 177, 33, 185, 132, 152, 33, 29, 178, 17, 11, 20, 31, 243, 32, 
+152, 24, 161, 57, 19, 0, 23, 0, 168, 104, 170, 19, 185, 49, 59, 224, 
+181, 16, 1, 47, 161, 73, 153, 1, 168, 180, 73, 226, 16, 177, 89, 184, 
+65, 12, 1, 42, 152, 1, 26, 128, 10, 199, 16, 212, 40, 194, 57, 177, 
+90, 137, 32, 12, 164, 57, 200, 49, 139, 147, 42, 216, 151, 58, 169, 35, 
+14, 146, 41, 152, 1, 42, 176, 72, 184, 3, 215, 57, 24, 139, 50, 158, 
+151, 42, 8, 25, 8, 42, 8, 123, 185, 165, 24, 144, 1, 168, 51, 143, 
+164, 75, 177, 72, 139, 180, 145, 34, 14, 163, 107, 153, 1, 8, 42, 176, 
+3, 60, 192, 67, 14, 1, 42, 128, 59, 208, 3, 12, 3, 60, 192, 3, 
+128, 61, 139, 133, 59, 192, 72, 184, 241, 255, 8, 0, 3, 13, 179, 88, 
+184, 88, 184, 3, 140, 132, 59, 60, 11, 4, 61, 192, 48, 139, 4, 200, 
+179, 64, 208, 3, 12, 179, 72, 59, 0, 232, 48, 208, 3, 60, 128, 60, 
+0, 61, 59, 139, 80, 184, 4, 200, 179, 180, 3, 61, 59, 60, 75, 192, 
+3, 60, 75, 139, 180, 195, 179, 180, 195, 179, 180, 195, 179, 180, 131, 0, 
+8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
@@ -0,0 +1,797 @@
+// Generado por tools/bank_gen.c a partir de audio_table.h; no editar.
+// Bloques LZ de 512 muestras, descomprimidos a SRAM al arrancar (ver lz_bank.h).
+
+#define AUDIO_SAMPLE_RATE 24000
+#define SNARE_SIZE 3600
+#define KICK_SIZE 3600
+#define HIHAT_SIZE 2694
+#define AUDIO_BITS_PER_SAMPLE 12
+
+const uint8_t kick_lz[4015] = {
+29, 3, 241, 255, 244, 3, 252, 4, 252, 10, 231, 30, 0, 207, 93, 244, 
+237, 20, 32, 244, 253, 22, 117, 103, 31, 237, 28, 81, 8, 150, 239, 239, 
+19, 13, 74, 91, 250, 23, 175, 22, 73, 67, 91, 178, 37, 109, 71, 14, 
+32, 200, 2, 228, 185, 84, 54, 90, 228, 70, 119, 33, 253, 202, 87, 126, 
+65, 14, 179, 212, 126, 57, 176, 25, 175, 139, 87, 177, 207, 158, 46, 6, 
+68, 162, 96, 24, 233, 101, 179, 0, 73, 133, 141, 146, 128, 127, 199, 176, 
+134, 236, 191, 69, 74, 164, 171, 74, 230, 113, 92, 104, 171, 133, 83, 148, 
+60, 208, 170, 184, 2, 64, 29, 46, 120, 200, 60, 198, 7, 10, 178, 168, 
+250, 230, 98, 23, 74, 245, 140, 113, 215, 131, 195, 53, 252, 71, 226, 175, 
+86, 229, 97, 57, 165, 197, 166, 129, 119, 100, 98, 216, 225, 31, 250, 121, 
+97, 253, 135, 214, 50, 111, 145, 102, 231, 200, 245, 243, 161, 31, 202, 156, 
+184, 29, 39, 212, 18, 51, 46, 75, 177, 22, 58, 19, 236, 181, 128, 96, 
+65, 28, 237, 186, 124, 50, 218, 134, 60, 212, 151, 68, 230, 136, 32, 175, 
+78, 246, 166, 82, 238, 154, 95, 17, 200, 116, 70, 226, 173, 157, 41, 44, 
+33, 188, 147, 111, 56, 120, 8, 252, 45, 136, 87, 185, 248, 218, 247, 13, 
+70, 37, 215, 170, 170, 196, 242, 194, 187, 174, 46, 245, 144, 106, 67, 126, 
+185, 171, 61, 254, 166, 57, 119, 225, 93, 87, 134, 1, 10, 157, 31, 153, 
+75, 24, 251, 221, 215, 247, 33, 99, 164, 238, 51, 129, 206, 43, 136, 242, 
+95, 213, 75, 199, 68, 195, 66, 191, 60, 183, 45, 160, 16, 124, 226, 66, 
+158, 242, 66, 139, 201, 2, 48, 84, 115, 140, 161, 174, 189, 197, 205, 208, 
+214, 217, 221, 222, 225, 226, 228, 228, 230, 229, 230, 227, 219, 225, 218, 215, 
+201, 201, 189, 176, 154, 140, 115, 117, 71, 39, 23, 245, 207, 174, 188, 150, 
+119, 33, 112, 48, 225, 12, 4, 231, 151, 167, 176, 175, 169, 142, 104, 129, 
+33, 17, 34, 250, 208, 160, 183, 101, 53, 5, 221, 157, 102, 59, 48, 43, 
+232, 243, 107, 242, 130, 147, 98, 210, 229, 181, 118, 247, 230, 210, 137, 42, 
+185, 110, 77, 100, 101, 63, 249, 190, 142, 96, 58, 16, 212, 170, 110, 47, 
+244, 184, 121, 53, 248, 188, 128, 69, 12, 211, 159, 105, 56, 10, 222, 182, 
+154, 132, 114, 99, 86, 75, 66, 60, 54, 50, 46, 43, 40, 39, 36, 35, 
+33, 33, 32, 31, 31, 31, 32, 32, 34, 35, 39, 42, 46, 52, 61, 69, 
+79, 89, 100, 111, 124, 139, 156, 169, 188, 207, 228, 248, 12, 34, 59, 84, 
+106, 137, 160, 192, 215, 0, 24, 70, 105, 161, 180, 224, 235, 67, 124, 72, 
+201, 10, 54, 57, 134, 203, 14, 240, 28, 118, 116, 107, 81, 186, 164, 196, 
+215, 224, 217, 234, 21, 8, 7, 2, 0, 0, 5, 0, 0, 6, 0, 48, 
+7, 8, 8, 12, 0, 49, 8, 7, 7, 11, 0, 17, 7, 28, 0, 3, 
+23, 0, 1, 36, 0, 5, 25, 0, 2, 19, 0, 2, 45, 0, 1, 3, 
+0, 1, 13, 0, 4, 22, 0, 2, 66, 0, 5, 42, 0, 3, 64, 0, 
+2, 17, 0, 240, 6, 6, 6, 8, 8, 7, 5, 4, 6, 7, 7, 6, 
+6, 9, 12, 14, 14, 13, 13, 11, 9, 6, 1, 0, 80, 5, 6, 6, 
+5, 4, 1, 0, 64, 5, 6, 5, 6, 6, 0, 64, 7, 6, 6, 6, 
+53, 0, 16, 9, 1, 0, 81, 10, 11, 13, 13, 12, 1, 0, 20, 13, 
+9, 0, 161, 11, 11, 11, 11, 10, 10, 10, 9, 9, 9, 94, 0, 0, 
+67, 0, 32, 5, 5, 67, 0, 17, 3, 1, 0, 17, 2, 1, 0, 16, 
+1, 4, 0, 36, 1, 1, 7, 0, 1, 11, 0, 1, 14, 0, 1, 17, 
+0, 0, 32, 0, 32, 3, 4, 53, 0, 3, 49, 0, 0, 57, 0, 0, 
+131, 0, 32, 5, 5, 124, 0, 130, 8, 8, 9, 9, 10, 10, 11, 11, 
+118, 0, 79, 14, 14, 14, 15, 1, 0, 18, 20, 14, 1, 0, 16, 13, 
+223, 0, 6, 1, 0, 2, 183, 0, 1, 184, 0, 4, 186, 0, 0, 187, 
+0, 2, 45, 1, 1, 4, 1, 1, 194, 0, 1, 196, 0, 1, 197, 0, 
+3, 166, 0, 79, 1, 1, 1, 0, 1, 0, 26, 4, 234, 0, 3, 232, 
+0, 5, 215, 0, 48, 4, 4, 5, 219, 0, 5, 1, 0, 16, 6, 177, 
+2, 246, 255, 243, 47, 53, 51, 82, 120, 172, 121, 192, 211, 234, 226, 30, 
+86, 67, 103, 152, 250, 213, 252, 49, 117, 122, 151, 215, 47, 106, 121, 214, 
+233, 7, 50, 101, 153, 224, 255, 82, 155, 197, 254, 43, 89, 145, 201, 251, 
+47, 69, 98, 117, 158, 166, 174, 197, 227, 255, 21, 51, 81, 110, 125, 147, 
+170, 195, 221, 249, 15, 38, 56, 72, 87, 102, 114, 126, 138, 148, 158, 166, 
+173, 179, 184, 188, 192, 195, 198, 200, 202, 203, 204, 205, 206, 206, 206, 206, 
+205, 205, 204, 203, 200, 196, 191, 185, 179, 171, 162, 151, 141, 129, 115, 101, 
+86, 69, 52, 35, 15, 251, 230, 207, 183, 161, 135, 108, 82, 54, 25, 252, 
+223, 190, 156, 125, 91, 59, 27, 244, 207, 170, 128, 86, 46, 11, 220, 181, 
+139, 102, 52, 6, 232, 178, 135, 77, 37, 212, 154, 123, 98, 49, 254, 201, 
+173, 149, 88, 79, 57, 58, 32, 50, 39, 28, 217, 209, 223, 197, 155, 123, 
+173, 116, 92, 67, 109, 59, 250, 238, 214, 197, 160, 129, 95, 80, 40, 20, 
+226, 188, 114, 94, 74, 43, 253, 217, 215, 143, 110, 74, 63, 248, 191, 164, 
+118, 68, 13, 254, 222, 191, 150, 115, 74, 34, 254, 227, 199, 172, 138, 109, 
+98, 70, 64, 49, 5, 241, 217, 192, 197, 180, 168, 160, 151, 140, 125, 121, 
+115, 110, 108, 102, 97, 93, 87, 83, 77, 75, 67, 67, 68, 66, 65, 63, 
+63, 60, 58, 57, 58, 57, 57, 57, 58, 61, 60, 61, 60, 61, 61, 62, 
+63, 65, 69, 76, 84, 92, 98, 104, 116, 124, 134, 146, 160, 173, 185, 201, 
+218, 236, 250, 11, 29, 49, 67, 92, 114, 138, 154, 175, 200, 221, 252, 27, 
+56, 78, 103, 133, 170, 206, 242, 14, 53, 84, 113, 149, 184, 210, 238, 7, 
+43, 85, 128, 163, 193, 7, 23, 55, 90, 136, 167, 207, 23, 73, 105, 108, 
+160, 190, 221, 238, 17, 60, 93, 151, 180, 209, 253, 36, 74, 145, 154, 192, 
+220, 223, 231, 252, 68, 59, 70, 86, 128, 136, 149, 185, 213, 227, 226, 31, 
+65, 87, 91, 124, 161, 198, 229, 252, 7, 23, 35, 59, 103, 106, 127, 152, 
+182, 214, 252, 27, 54, 79, 109, 140, 161, 181, 198, 228, 246, 1, 34, 54, 
+70, 93, 91, 110, 143, 179, 199, 207, 224, 236, 0, 26, 49, 84, 114, 127, 
+122, 116, 118, 108, 110, 119, 163, 178, 204, 248, 246, 10, 24, 20, 14, 17, 
+31, 58, 74, 79, 78, 71, 64, 45, 48, 42, 38, 40, 43, 34, 19, 4, 
+1, 8, 246, 244, 246, 3, 0, 5, 14, 4, 250, 235, 232, 211, 201, 208, 
+185, 184, 193, 187, 196, 196, 193, 175, 168, 165, 154, 153, 157, 162, 158, 152, 
+144, 131, 112, 92, 73, 63, 54, 38, 31, 17, 11, 15, 8, 255, 242, 235, 
+221, 206, 191, 171, 150, 133, 97, 74, 52, 32, 10, 251, 247, 229, 216, 196, 
+182, 150, 123, 94, 6, 1, 0, 19, 7, 1, 0, 16, 8, 1, 0, 16, 
+9, 1, 0, 17, 10, 1, 0, 80, 11, 11, 11, 11, 12, 1, 0, 21, 
+13, 1, 0, 21, 14, 1, 0, 31, 15, 1, 0, 29, 6, 59, 0, 4, 
+77, 0, 1, 92, 0, 32, 12, 12, 103, 0, 33, 11, 11, 114, 0, 1, 
+125, 0, 1, 135, 0, 3, 1, 0, 4, 155, 0, 0, 1, 0, 6, 177, 
+0, 17, 5, 1, 0, 18, 4, 1, 0, 17, 3, 1, 0, 18, 2, 1, 
+0, 22, 1, 1, 0, 31, 0, 1, 0, 42, 7, 73, 0, 19, 1, 92, 
+0, 18, 2, 106, 0, 34, 3, 3, 120, 0, 2, 133, 0, 27, 5, 69, 
+1, 5, 186, 0, 1, 203, 0, 2, 1, 0, 2, 78, 1, 3, 81, 1, 
+3, 1, 0, 3, 252, 0, 9, 93, 1, 9, 96, 1, 15, 103, 1, 11, 
+4, 26, 0, 13, 48, 0, 14, 1, 0, 9, 96, 0, 4, 116, 1, 32, 
+12, 12, 110, 2, 243, 255, 246, 70, 37, 6, 229, 204, 170, 125, 104, 80, 
+54, 24, 251, 223, 214, 166, 140, 125, 96, 61, 19, 249, 209, 179, 153, 141, 
+116, 94, 62, 36, 2, 223, 209, 190, 176, 153, 133, 108, 82, 45, 17, 249, 
+212, 204, 195, 182, 163, 136, 106, 70, 51, 34, 16, 9, 254, 238, 229, 207, 
+179, 158, 141, 127, 114, 111, 108, 106, 102, 99, 92, 80, 73, 69, 65, 61, 
+55, 46, 38, 26, 18, 14, 9, 10, 13, 17, 18, 13, 7, 2, 251, 244, 
+239, 231, 226, 220, 221, 212, 205, 207, 207, 203, 195, 200, 192, 186, 183, 180, 
+173, 169, 162, 165, 165, 149, 127, 107, 92, 71, 66, 69, 77, 64, 52, 42, 
+41, 38, 31, 32, 18, 9, 250, 248, 234, 220, 220, 218, 213, 201, 202, 196, 
+185, 174, 164, 159, 152, 143, 131, 114, 103, 83, 69, 67, 50, 40, 30, 25, 
+11, 253, 239, 226, 214, 204, 194, 188, 180, 163, 148, 130, 112, 86, 67, 52, 
+39, 27, 16, 0, 243, 228, 212, 208, 194, 183, 167, 152, 136, 122, 118, 102, 
+88, 80, 69, 59, 49, 35, 22, 11, 2, 244, 232, 223, 217, 206, 193, 183, 
+173, 169, 165, 154, 149, 145, 138, 131, 123, 115, 104, 100, 99, 99, 95, 90, 
+86, 79, 71, 64, 64, 61, 60, 60, 60, 60, 59, 61, 61, 63, 71, 72, 
+77, 83, 85, 89, 94, 98, 102, 106, 110, 113, 117, 122, 129, 135, 139, 142, 
+145, 148, 151, 155, 159, 163, 168, 172, 177, 182, 187, 192, 198, 204, 209, 215, 
+222, 230, 240, 252, 8, 20, 33, 45, 59, 73, 89, 106, 124, 142, 160, 179, 
+198, 219, 240, 7, 30, 55, 80, 105, 131, 156, 183, 211, 241, 14, 45, 77, 
+108, 141, 175, 209, 243, 21, 56, 91, 126, 162, 198, 234, 15, 52, 88, 126, 
+163, 199, 237, 18, 57, 95, 132, 169, 207, 244, 27, 64, 100, 135, 168, 202, 
+238, 18, 54, 91, 126, 159, 194, 227, 5, 40, 75, 108, 141, 177, 205, 233, 
+10, 37, 67, 96, 124, 154, 181, 207, 230, 249, 10, 27, 43, 58, 73, 85, 
+102, 121, 136, 152, 161, 169, 177, 182, 192, 206, 223, 240, 1, 13, 26, 37, 
+48, 58, 70, 83, 96, 112, 127, 147, 162, 177, 194, 210, 229, 249, 12, 32, 
+51, 66, 81, 98, 114, 128, 145, 162, 177, 193, 208, 220, 234, 248, 6, 16, 
+30, 43, 53, 65, 75, 86, 96, 106, 115, 124, 132, 139, 145, 149, 155, 160, 
+165, 171, 176, 179, 183, 186, 190, 193, 195, 197, 199, 202, 204, 205, 207, 207, 
+208, 209, 210, 210, 211, 211, 212, 212, 213, 213, 213, 214, 214, 214, 215, 214, 
+214, 213, 214, 213, 213, 213, 212, 212, 211, 211, 210, 208, 206, 205, 202, 199, 
+196, 193, 188, 184, 180, 176, 172, 167, 161, 154, 146, 136, 126, 116, 105, 92, 
+77, 62, 48, 34, 20, 5, 246, 229, 209, 187, 165, 142, 120, 99, 77, 55, 
+33, 10, 242, 217, 190, 162, 132, 12, 12, 12, 11, 1, 0, 20, 10, 1, 
+0, 21, 9, 1, 0, 21, 8, 1, 0, 24, 7, 1, 0, 31, 6, 1, 
+0, 14, 31, 5, 1, 0, 20, 31, 4, 1, 0, 7, 30, 3, 1, 0, 
+31, 2, 1, 0, 1, 31, 1, 1, 0, 55, 11, 90, 0, 6, 121, 0, 
+4, 148, 0, 3, 182, 0, 3, 229, 0, 3, 14, 1, 3, 34, 1, 3, 
+51, 1, 4, 69, 1, 4, 86, 1, 61, 11, 11, 12, 1, 0, 29, 13, 
+1, 0, 27, 14, 1, 0, 31, 15, 1, 0, 68, 8, 100, 0, 1, 121, 
+0, 0, 153, 2, 242, 255, 247, 103, 73, 44, 13, 237, 204, 169, 135, 99, 
+62, 26, 247, 211, 171, 130, 89, 48, 10, 229, 195, 163, 132, 100, 65, 30, 
+252, 216, 179, 141, 103, 64, 22, 236, 198, 162, 128, 97, 67, 35, 0, 217, 
+177, 140, 104, 69, 37, 6, 232, 201, 170, 138, 104, 72, 37, 2, 225, 194, 
+163, 131, 97, 63, 31, 254, 223, 191, 160, 130, 100, 70, 39, 9, 238, 212, 
+186, 159, 133, 107, 82, 58, 35, 12, 245, 222, 198, 177, 154, 133, 112, 92, 
+71, 52, 34, 17, 0, 239, 222, 206, 191, 175, 161, 147, 134, 120, 107, 95, 
+82, 72, 61, 50, 40, 31, 22, 15, 7, 0, 250, 244, 238, 233, 227, 221, 
+215, 209, 205, 202, 198, 195, 192, 189, 186, 183, 181, 180, 180, 179, 178, 177, 
+177, 176, 176, 175, 175, 176, 177, 178, 179, 179, 180, 181, 183, 185, 187, 191, 
+195, 199, 202, 206, 210, 215, 218, 222, 226, 231, 236, 244, 252, 5, 16, 27, 
+37, 47, 57, 66, 75, 83, 91, 99, 109, 120, 132, 144, 156, 167, 179, 191, 
+204, 219, 234, 249, 8, 23, 39, 53, 67, 81, 96, 112, 130, 149, 168, 187, 
+205, 223, 241, 3, 23, 44, 65, 87, 108, 129, 151, 171, 191, 211, 230, 251, 
+16, 38, 61, 85, 110, 136, 161, 186, 209, 233, 0, 23, 45, 67, 90, 115, 
+139, 164, 189, 213, 236, 3, 26, 50, 73, 96, 119, 143, 167, 190, 211, 231, 
+251, 16, 38, 63, 87, 112, 134, 157, 179, 200, 222, 243, 8, 29, 49, 69, 
+90, 111, 131, 150, 168, 186, 204, 223, 242, 4, 23, 41, 60, 78, 95, 111, 
+126, 141, 155, 169, 184, 200, 215, 230, 245, 3, 17, 30, 43, 55, 67, 79, 
+91, 103, 114, 125, 134, 143, 151, 159, 168, 177, 186, 196, 205, 213, 220, 228, 
+236, 244, 251, 2, 9, 15, 22, 28, 33, 38, 43, 47, 52, 56, 62, 68, 
+73, 77, 81, 84, 87, 90, 91, 93, 94, 95, 97, 99, 101, 102, 102, 102, 
+101, 101, 101, 100, 100, 100, 99, 97, 95, 93, 90, 87, 84, 82, 79, 76, 
+72, 67, 63, 59, 55, 51, 47, 44, 39, 35, 30, 25, 20, 14, 8, 2, 
+252, 246, 240, 234, 228, 223, 216, 209, 201, 194, 186, 180, 173, 167, 159, 152, 
+145, 137, 130, 123, 115, 106, 98, 90, 83, 75, 67, 58, 49, 41, 33, 25, 
+17, 9, 1, 249, 240, 231, 222, 212, 203, 195, 186, 178, 169, 160, 150, 141, 
+131, 122, 114, 105, 97, 90, 81, 73, 64, 55, 47, 38, 29, 20, 11, 3, 
+250, 242, 234, 226, 218, 210, 203, 196, 189, 182, 174, 167, 159, 152, 144, 137, 
+130, 122, 115, 109, 103, 97, 92, 87, 82, 76, 70, 63, 57, 51, 45, 39, 
+35, 30, 26, 21, 16, 11, 6, 2, 254, 251, 247, 243, 239, 235, 231, 228, 
+224, 221, 217, 213, 210, 207, 204, 201, 198, 195, 193, 190, 189, 188, 187, 185, 
+183, 181, 179, 177, 175, 173, 171, 13, 13, 13, 13, 12, 1, 0, 18, 11, 
+1, 0, 18, 10, 1, 0, 18, 9, 1, 0, 19, 8, 1, 0, 18, 7, 
+1, 0, 19, 6, 1, 0, 18, 5, 1, 0, 20, 4, 1, 0, 21, 3, 
+1, 0, 24, 2, 1, 0, 31, 1, 1, 0, 1, 31, 0, 1, 0, 31, 
+15, 72, 0, 2, 41, 1, 1, 108, 0, 38, 2, 2, 133, 0, 53, 3, 
+3, 3, 155, 0, 19, 4, 172, 0, 0, 1, 0, 4, 191, 0, 0, 1, 
+0, 3, 210, 0, 0, 1, 0, 4, 229, 0, 1, 1, 0, 3, 249, 0, 
+5, 1, 0, 3, 16, 1, 15, 1, 0, 0, 3, 49, 1, 15, 1, 0, 
+35, 15, 87, 0, 7, 5, 1, 0, 12, 138, 0, 9, 1, 0, 9, 180, 
+0, 15, 1, 0, 8, 7, 231, 0, 15, 1, 0, 1, 0, 10, 2, 241, 
+106, 170, 169, 169, 168, 168, 167, 167, 167, 167, 166, 166, 166, 165, 164, 163, 
+163, 163, 165, 166, 167, 168, 169, 170, 171, 172, 172, 173, 173, 173, 175, 176, 
+178, 179, 180, 180, 181, 182, 184, 185, 187, 188, 189, 190, 191, 193, 194, 196, 
+197, 198, 200, 201, 202, 204, 205, 207, 209, 211, 213, 214, 216, 218, 219, 221, 
+223, 225, 228, 229, 231, 232, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 
+252, 254, 0, 1, 2, 4, 6, 7, 9, 10, 11, 12, 13, 15, 16, 17, 
+19, 20, 21, 21, 22, 24, 25, 27, 28, 28, 29, 29, 30, 31, 32, 32, 
+33, 33, 33, 34, 34, 34, 35, 36, 36, 37, 1, 0, 245, 119, 36, 36, 
+36, 36, 35, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 23, 22, 
+21, 19, 17, 15, 14, 12, 10, 8, 6, 4, 3, 2, 0, 255, 253, 251, 
+248, 246, 244, 241, 239, 237, 235, 232, 230, 227, 225, 222, 219, 217, 214, 212, 
+210, 207, 205, 202, 200, 197, 194, 191, 188, 186, 183, 180, 178, 175, 172, 169, 
+167, 164, 161, 159, 156, 154, 152, 149, 146, 144, 141, 138, 135, 133, 130, 128, 
+125, 123, 121, 118, 116, 113, 111, 109, 107, 105, 103, 101, 99, 97, 95, 93, 
+91, 89, 87, 85, 84, 83, 81, 80, 79, 77, 76, 75, 74, 73, 73, 72, 
+72, 72, 71, 70, 69, 68, 67, 66, 66, 65, 65, 65, 64, 64, 63, 64, 
+63, 63, 63, 64, 1, 0, 241, 69, 65, 65, 66, 66, 67, 67, 68, 69, 
+70, 70, 71, 71, 72, 73, 74, 75, 76, 77, 78, 79, 81, 83, 84, 86, 
+88, 89, 91, 93, 94, 95, 96, 97, 99, 100, 101, 102, 104, 106, 106, 107, 
+109, 110, 112, 113, 115, 117, 118, 119, 120, 121, 122, 123, 124, 125, 127, 128, 
+130, 132, 133, 135, 137, 138, 140, 141, 142, 143, 145, 146, 147, 149, 150, 151, 
+152, 153, 154, 155, 156, 157, 159, 160, 160, 162, 163, 164, 80, 1, 242, 10, 
+171, 172, 173, 174, 175, 175, 176, 177, 177, 179, 179, 181, 182, 183, 184, 185, 
+186, 187, 189, 190, 191, 192, 193, 195, 196, 79, 1, 240, 3, 206, 207, 209, 
+210, 212, 213, 214, 216, 217, 219, 220, 221, 223, 225, 226, 227, 229, 230, 84, 
+1, 245, 53, 236, 237, 239, 240, 242, 243, 244, 246, 247, 249, 250, 252, 253, 
+255, 0, 2, 3, 4, 6, 8, 9, 11, 13, 14, 15, 17, 19, 21, 23, 
+24, 26, 27, 29, 31, 32, 34, 35, 37, 38, 39, 41, 42, 44, 45, 47, 
+49, 50, 52, 53, 55, 57, 58, 60, 61, 62, 63, 65, 67, 68, 69, 71, 
+72, 73, 75, 76, 77, 79, 80, 190, 0, 242, 2, 96, 97, 99, 101, 102, 
+104, 105, 107, 108, 110, 111, 112, 113, 114, 116, 117, 118, 188, 0, 47, 125, 
+7, 1, 0, 61, 31, 8, 1, 0, 56, 15, 157, 0, 62, 15, 1, 0, 
+168, 15, 88, 1, 57, 7, 1, 0, 0, 213, 1, 245, 67, 126, 127, 129, 
+130, 131, 132, 134, 135, 136, 137, 139, 139, 140, 141, 142, 142, 143, 144, 144, 
+145, 146, 147, 148, 149, 150, 152, 153, 154, 155, 157, 157, 158, 160, 160, 161, 
+162, 163, 164, 165, 166, 167, 168, 169, 170, 170, 171, 171, 172, 173, 174, 174, 
+175, 175, 175, 175, 176, 177, 177, 177, 178, 178, 178, 179, 180, 180, 180, 181, 
+181, 181, 181, 182, 182, 182, 183, 183, 183, 183, 184, 184, 184, 184, 185, 1, 
+0, 243, 217, 184, 184, 184, 183, 183, 183, 182, 182, 182, 181, 181, 181, 180, 
+180, 179, 178, 177, 177, 176, 175, 174, 174, 173, 173, 172, 171, 170, 169, 168, 
+167, 166, 165, 164, 163, 162, 161, 160, 159, 158, 157, 156, 155, 154, 152, 151, 
+150, 148, 147, 146, 144, 143, 142, 141, 139, 138, 136, 135, 133, 132, 130, 129, 
+127, 126, 125, 123, 122, 121, 119, 118, 117, 115, 114, 112, 110, 109, 107, 106, 
+105, 103, 102, 100, 99, 97, 96, 94, 93, 91, 90, 88, 87, 86, 84, 83, 
+82, 81, 79, 78, 77, 75, 74, 72, 71, 70, 68, 67, 65, 63, 62, 60, 
+58, 57, 55, 54, 52, 51, 50, 48, 47, 45, 44, 43, 41, 40, 38, 37, 
+36, 34, 33, 32, 30, 29, 27, 26, 24, 23, 21, 20, 19, 18, 16, 15, 
+14, 13, 11, 10, 9, 8, 7, 5, 4, 3, 2, 0, 255, 254, 252, 251, 
+249, 248, 247, 246, 244, 243, 242, 241, 239, 238, 237, 236, 235, 234, 232, 231, 
+230, 229, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 218, 216, 216, 
+215, 214, 213, 212, 211, 210, 209, 208, 208, 207, 206, 205, 205, 204, 203, 202, 
+201, 200, 199, 199, 198, 197, 196, 196, 195, 195, 194, 194, 193, 193, 192, 192, 
+191, 191, 190, 190, 189, 189, 189, 188, 188, 188, 187, 1, 0, 23, 186, 1, 
+0, 4, 20, 0, 240, 26, 188, 188, 188, 188, 189, 189, 189, 189, 190, 190, 
+190, 191, 191, 191, 191, 192, 192, 193, 193, 193, 194, 194, 195, 195, 195, 195, 
+196, 196, 196, 196, 197, 197, 198, 198, 199, 199, 199, 200, 200, 200, 201, 1, 
+0, 81, 202, 202, 202, 202, 203, 1, 0, 16, 204, 1, 0, 128, 205, 205, 
+205, 205, 206, 206, 206, 207, 1, 0, 65, 208, 208, 208, 209, 1, 0, 18, 
+210, 1, 0, 17, 211, 1, 0, 16, 212, 1, 0, 176, 213, 213, 213, 214, 
+214, 214, 214, 215, 215, 215, 216, 1, 0, 145, 217, 217, 217, 217, 218, 218, 
+218, 218, 219, 1, 0, 20, 220, 1, 0, 23, 221, 1, 0, 19, 222, 1, 
+0, 16, 223, 1, 0, 31, 8, 1, 0, 224, 31, 7, 1, 0, 248, 0, 
+221, 0, 97, 223, 223, 223, 224, 223, 224, 1, 0, 145, 225, 225, 225, 225, 
+226, 226, 226, 226, 227, 1, 0, 80, 228, 228, 228, 228, 229, 1, 0, 148, 
+230, 230, 230, 230, 231, 231, 231, 231, 232, 1, 0, 80, 233, 233, 233, 233, 
+234, 1, 0, 16, 235, 1, 0, 20, 236, 1, 0, 22, 237, 1, 0, 23, 
+238, 1, 0, 25, 239, 1, 0, 31, 240, 1, 0, 0, 8, 32, 0, 4, 
+54, 0, 4, 74, 0, 3, 92, 0, 1, 106, 0, 33, 235, 235, 118, 0, 
+32, 234, 234, 129, 0, 0, 1, 0, 5, 146, 0, 16, 232, 160, 0, 3, 
+1, 0, 0, 175, 0, 8, 1, 0, 1, 196, 0, 15, 1, 0, 30, 12, 
+70, 0, 2, 3, 1, 5, 1, 0, 6, 122, 0, 1, 14, 1, 2, 1, 
+0, 3, 158, 0, 4, 25, 1, 7, 28, 1, 12, 24, 1, 10, 13, 1, 
+19, 241, 1, 0, 18, 242, 1, 0, 19, 243, 1, 0, 19, 244, 1, 0, 
+19, 245, 1, 0, 20, 246, 1, 0, 20, 247, 1, 0, 20, 248, 1, 0, 
+21, 249, 1, 0, 20, 250, 1, 0, 22, 251, 1, 0, 21, 252, 1, 0, 
+22, 253, 1, 0, 19, 254, 1, 0, 31, 7, 1, 0, 255, 237, 0, 14, 
+0, 71, 254, 254, 254, 255, 1, 0, 42, 0, 7, 1, 0, 16, 8
+};
+
+const uint8_t snare_lz[4834] = {
+1, 3, 245, 255, 254, 251, 0, 114, 207, 207, 18, 48, 14, 229, 14, 63, 
+227, 128, 105, 132, 131, 151, 145, 90, 180, 144, 237, 239, 6, 238, 22, 225, 
+242, 199, 6, 197, 110, 150, 171, 32, 143, 239, 76, 156, 200, 110, 151, 187, 
+76, 166, 215, 67, 20, 247, 114, 132, 130, 169, 117, 157, 95, 62, 103, 188, 
+67, 132, 197, 201, 104, 208, 132, 142, 240, 54, 227, 32, 127, 30, 92, 80, 
+251, 40, 182, 34, 163, 34, 235, 132, 183, 109, 90, 180, 244, 39, 235, 255, 
+198, 160, 163, 143, 35, 185, 218, 43, 25, 176, 124, 173, 60, 8, 35, 212, 
+162, 250, 8, 51, 182, 248, 192, 242, 191, 145, 177, 55, 0, 47, 119, 181, 
+230, 112, 28, 56, 216, 68, 86, 110, 196, 199, 206, 13, 122, 170, 125, 104, 
+90, 89, 126, 157, 171, 222, 15, 107, 139, 179, 221, 164, 188, 255, 17, 74, 
+107, 152, 222, 241, 46, 183, 74, 93, 9, 42, 36, 30, 86, 132, 213, 22, 
+209, 57, 211, 144, 156, 168, 237, 33, 66, 61, 21, 236, 218, 181, 52, 223, 
+237, 61, 65, 246, 132, 90, 88, 51, 13, 228, 119, 26, 86, 101, 2, 144, 
+58, 32, 242, 239, 69, 131, 115, 2, 181, 195, 203, 131, 66, 38, 229, 185, 
+193, 236, 9, 15, 3, 13, 53, 72, 64, 0, 195, 202, 226, 195, 163, 220, 
+4, 255, 249, 237, 39, 74, 72, 129, 177, 179, 141, 80, 66, 125, 117, 131, 
+245, 13, 19, 54, 89, 69, 106, 158, 101, 96, 114, 160, 22, 128, 124, 104, 
+122, 154, 164, 200, 185, 168, 165, 224, 74, 35, 62, 63, 22, 19, 20, 82, 
+154, 190, 231, 111, 212, 32, 202, 61, 61, 8, 201, 65, 53, 210, 203, 223, 
+31, 218, 172, 152, 249, 68, 20, 251, 98, 42, 85, 2, 46, 149, 115, 80, 
+18, 199, 197, 122, 50, 247, 232, 39, 199, 112, 157, 142, 98, 69, 104, 26, 
+93, 34, 66, 134, 82, 26, 110, 90, 33, 66, 10, 202, 234, 2, 59, 39, 
+255, 9, 37, 197, 151, 6, 1, 108, 150, 82, 140, 140, 129, 119, 147, 226, 
+57, 119, 114, 50, 254, 245, 15, 104, 125, 111, 63, 48, 95, 179, 213, 40, 
+84, 215, 65, 176, 90, 90, 26, 208, 78, 126, 153, 209, 210, 166, 162, 251, 
+197, 189, 217, 238, 46, 228, 217, 14, 62, 121, 100, 68, 87, 69, 67, 93, 
+120, 112, 94, 154, 169, 216, 221, 237, 248, 201, 134, 110, 121, 102, 44, 132, 
+79, 4, 52, 149, 187, 201, 209, 218, 107, 208, 237, 26, 133, 132, 250, 73, 
+249, 172, 70, 4, 78, 199, 230, 203, 135, 159, 190, 147, 130, 52, 214, 182, 
+166, 234, 54, 26, 43, 50, 24, 223, 191, 172, 154, 139, 242, 113, 31, 233, 
+227, 154, 184, 199, 155, 221, 233, 255, 2, 82, 91, 199, 24, 87, 165, 157, 
+72, 132, 126, 50, 165, 156, 95, 211, 206, 242, 227, 233, 2, 178, 225, 15, 
+192, 16, 137, 136, 163, 7, 8, 7, 6, 6, 7, 7, 7, 6, 7, 7, 
+6, 1, 0, 240, 2, 5, 6, 8, 6, 6, 7, 9, 10, 10, 8, 8, 
+8, 8, 9, 9, 9, 10, 3, 0, 192, 8, 10, 11, 11, 10, 8, 8, 
+10, 10, 9, 8, 9, 5, 0, 0, 25, 0, 33, 9, 9, 34, 0, 0, 
+11, 0, 1, 8, 0, 1, 4, 0, 32, 7, 7, 4, 0, 4, 75, 0, 
+16, 5, 4, 0, 0, 1, 0, 128, 4, 4, 4, 5, 4, 3, 3, 4, 
+1, 0, 2, 18, 0, 0, 1, 0, 2, 38, 0, 22, 7, 1, 0, 0, 
+81, 0, 3, 119, 0, 0, 122, 0, 36, 10, 11, 1, 0, 64, 12, 11, 
+11, 10, 1, 0, 0, 12, 0, 0, 8, 0, 0, 29, 0, 2, 37, 0, 
+2, 49, 0, 0, 197, 0, 1, 73, 0, 4, 121, 0, 4, 93, 0, 4, 
+129, 0, 0, 7, 0, 6, 228, 0, 15, 118, 0, 3, 6, 122, 0, 3, 
+91, 0, 0, 102, 0, 3, 103, 0, 1, 7, 0, 4, 13, 0, 4, 120, 
+0, 32, 7, 7, 121, 0, 1, 1, 0, 7, 90, 0, 1, 105, 0, 10, 
+109, 0, 4, 156, 0, 7, 115, 0, 2, 120, 0, 10, 124, 0, 10, 127, 
+0, 12, 1, 0, 7, 42, 0, 0, 120, 0, 1, 67, 0, 7, 126, 0, 
+12, 135, 0, 5, 120, 0, 8, 235, 0, 2, 125, 0, 0, 3, 0, 0, 
+71, 0, 0, 170, 2, 241, 255, 243, 89, 135, 112, 142, 226, 165, 10, 33, 
+214, 215, 1, 228, 252, 159, 114, 181, 226, 21, 230, 191, 187, 183, 8, 245, 
+231, 85, 128, 157, 116, 209, 150, 97, 78, 120, 100, 251, 235, 239, 50, 183, 
+92, 173, 245, 214, 195, 176, 241, 12, 63, 223, 170, 166, 93, 42, 255, 62, 
+12, 15, 207, 190, 206, 168, 11, 27, 236, 193, 175, 175, 145, 90, 102, 77, 
+25, 124, 68, 36, 104, 39, 88, 173, 153, 89, 195, 215, 174, 155, 234, 156, 
+116, 130, 113, 200, 6, 251, 160, 59, 94, 186, 243, 164, 161, 184, 252, 200, 
+69, 53, 152, 206, 236, 234, 53, 160, 119, 112, 114, 158, 177, 252, 250, 231, 
+14, 121, 58, 66, 107, 67, 130, 128, 156, 170, 174, 138, 251, 58, 56, 13, 
+24, 33, 234, 179, 218, 49, 81, 111, 74, 47, 88, 71, 26, 124, 59, 140, 
+111, 160, 224, 5, 14, 1, 9, 41, 237, 244, 46, 178, 179, 207, 162, 216, 
+176, 179, 152, 178, 81, 36, 119, 34, 38, 22, 111, 133, 246, 21, 93, 58, 
+27, 206, 246, 80, 65, 75, 56, 237, 252, 214, 134, 216, 169, 134, 103, 134, 
+155, 148, 101, 188, 252, 209, 140, 218, 36, 219, 160, 206, 159, 179, 181, 237, 
+252, 221, 177, 96, 229, 41, 18, 35, 84, 88, 83, 183, 134, 24, 254, 60, 
+131, 127, 1, 37, 29, 86, 222, 133, 190, 137, 174, 0, 183, 169, 46, 73, 
+30, 31, 22, 140, 177, 41, 13, 80, 95, 174, 159, 160, 120, 110, 175, 9, 
+190, 81, 228, 19, 255, 230, 228, 229, 163, 175, 239, 69, 126, 248, 129, 214, 
+5, 31, 86, 25, 206, 180, 251, 27, 48, 230, 103, 128, 174, 193, 150, 73, 
+157, 107, 6, 109, 87, 69, 83, 40, 228, 81, 15, 224, 63, 247, 214, 224, 
+249, 250, 26, 216, 198, 201, 175, 169, 202, 228, 231, 246, 209, 219, 192, 83, 
+24, 98, 125, 85, 114, 13, 1, 31, 254, 68, 11, 168, 167, 229, 196, 169, 
+106, 151, 140, 201, 17, 223, 233, 217, 33, 221, 173, 161, 73, 77, 29, 64, 
+97, 103, 92, 108, 75, 160, 134, 186, 174, 163, 189, 240, 243, 47, 151, 24, 
+1, 71, 91, 116, 105, 193, 251, 138, 168, 210, 186, 126, 158, 194, 251, 58, 
+191, 179, 242, 14, 249, 226, 35, 239, 248, 111, 91, 49, 206, 154, 189, 251, 
+193, 145, 228, 196, 150, 114, 149, 142, 184, 110, 47, 182, 121, 109, 60, 47, 
+75, 6, 39, 84, 137, 162, 92, 1, 11, 21, 34, 107, 29, 226, 148, 181, 
+208, 121, 199, 172, 182, 225, 214, 149, 102, 104, 85, 56, 243, 46, 152, 102, 
+48, 69, 46, 28, 26, 62, 96, 79, 52, 54, 61, 6, 42, 57, 40, 7, 
+246, 54, 65, 66, 54, 147, 103, 59, 70, 104, 195, 214, 167, 110, 178, 234, 
+213, 139, 201, 37, 13, 199, 26, 206, 133, 37, 78, 51, 6, 3, 123, 100, 
+249, 6, 47, 103, 89, 66, 50, 100, 8, 1, 0, 83, 9, 9, 8, 8, 
+9, 11, 0, 3, 5, 0, 21, 9, 1, 0, 4, 21, 0, 4, 41, 0, 
+64, 8, 8, 8, 7, 4, 0, 50, 7, 7, 7, 6, 0, 10, 1, 0, 
+21, 6, 1, 0, 7, 11, 0, 18, 6, 24, 0, 6, 38, 0, 4, 81, 
+0, 3, 86, 0, 3, 103, 0, 7, 1, 0, 5, 22, 0, 5, 124, 0, 
+5, 1, 0, 1, 61, 0, 2, 67, 0, 13, 121, 0, 8, 116, 0, 6, 
+111, 0, 7, 121, 0, 35, 7, 7, 59, 0, 10, 130, 0, 7, 229, 0, 
+5, 139, 0, 6, 240, 0, 9, 124, 0, 0, 65, 0, 2, 71, 0, 15, 
+1, 0, 0, 3, 233, 0, 5, 140, 0, 1, 4, 0, 12, 1, 0, 13, 
+127, 0, 4, 128, 0, 2, 246, 0, 14, 31, 0, 12, 133, 0, 13, 116, 
+0, 15, 136, 0, 1, 14, 118, 0, 7, 251, 0, 4, 8, 0, 0, 150, 
+2, 255, 255, 246, 52, 116, 2, 197, 48, 65, 172, 126, 138, 173, 240, 243, 
+217, 251, 232, 187, 194, 245, 151, 105, 131, 85, 127, 86, 95, 146, 86, 184, 
+211, 115, 58, 238, 253, 21, 75, 88, 255, 74, 212, 200, 52, 229, 253, 252, 
+63, 64, 62, 66, 238, 11, 85, 68, 179, 89, 94, 187, 186, 85, 161, 162, 
+55, 250, 21, 154, 160, 168, 216, 123, 113, 145, 98, 35, 82, 189, 146, 80, 
+88, 125, 133, 44, 234, 90, 119, 88, 133, 137, 171, 234, 184, 101, 202, 202, 
+179, 187, 224, 246, 162, 160, 184, 150, 156, 237, 167, 122, 201, 206, 221, 236, 
+4, 0, 234, 28, 5, 21, 15, 72, 23, 174, 234, 76, 133, 98, 147, 54, 
+47, 29, 108, 198, 141, 154, 80, 100, 106, 136, 146, 167, 139, 181, 233, 65, 
+2, 112, 216, 126, 13, 38, 93, 62, 29, 82, 111, 132, 116, 39, 12, 62, 
+76, 57, 50, 249, 233, 25, 2, 212, 7, 17, 229, 233, 30, 23, 206, 217, 
+6, 252, 75, 44, 200, 169, 162, 238, 213, 236, 196, 213, 249, 183, 192, 215, 
+223, 210, 188, 225, 255, 251, 187, 126, 147, 78, 109, 191, 221, 186, 125, 152, 
+176, 151, 193, 190, 130, 57, 87, 180, 147, 110, 120, 136, 154, 199, 147, 178, 
+149, 198, 253, 194, 247, 243, 190, 214, 241, 28, 35, 249, 70, 84, 93, 62, 
+19, 13, 82, 120, 103, 103, 119, 37, 252, 14, 31, 102, 31, 48, 130, 72, 
+188, 17, 131, 44, 241, 26, 9, 71, 71, 3, 8, 156, 185, 3, 44, 70, 
+225, 247, 13, 231, 236, 39, 77, 32, 41, 220, 231, 37, 67, 142, 71, 39, 
+8, 7, 101, 65, 62, 55, 117, 85, 34, 240, 194, 27, 7, 1, 67, 97, 
+234, 118, 198, 100, 224, 138, 188, 202, 168, 140, 214, 7, 21, 254, 241, 220, 
+231, 231, 179, 204, 216, 254, 19, 180, 21, 36, 212, 207, 1, 29, 18, 29, 
+203, 216, 248, 236, 239, 234, 178, 204, 9, 205, 181, 179, 169, 195, 200, 168, 
+214, 217, 185, 210, 248, 251, 234, 226, 184, 136, 193, 211, 231, 41, 214, 182, 
+174, 191, 48, 94, 212, 221, 26, 57, 97, 74, 255, 200, 32, 213, 218, 62, 
+20, 246, 7, 245, 42, 17, 207, 25, 11, 255, 243, 158, 170, 216, 221, 187, 
+195, 203, 1, 85, 13, 179, 188, 217, 251, 31, 210, 188, 238, 244, 17, 219, 
+254, 60, 7, 4, 2, 46, 11, 3, 69, 68, 29, 35, 39, 67, 55, 33, 
+33, 20, 242, 208, 68, 78, 104, 59, 51, 88, 84, 67, 53, 74, 52, 132, 
+94, 10, 232, 51, 44, 216, 42, 94, 69, 249, 220, 196, 197, 239, 227, 7, 
+238, 163, 206, 12, 225, 173, 236, 252, 246, 188, 153, 198, 186, 206, 182, 233, 
+203, 166, 160, 174, 7, 237, 247, 254, 10, 225, 206, 6, 232, 229, 40, 34, 
+219, 188, 239, 220, 217, 200, 163, 196, 193, 9, 9, 247, 11, 21, 75, 25, 
+242, 210, 202, 215, 8, 8, 9, 8, 1, 0, 8, 32, 7, 7, 5, 0, 
+2, 10, 0, 2, 7, 0, 2, 11, 0, 2, 1, 0, 21, 6, 10, 0, 
+15, 19, 0, 9, 5, 1, 0, 3, 74, 0, 3, 86, 0, 15, 1, 0, 
+18, 3, 53, 0, 1, 7, 0, 18, 7, 10, 0, 15, 1, 0, 32, 5, 
+121, 0, 3, 85, 0, 7, 8, 0, 8, 146, 0, 0, 98, 0, 3, 236, 
+0, 15, 6, 1, 0, 2, 3, 1, 6, 82, 0, 5, 93, 0, 3, 160, 
+0, 6, 19, 0, 15, 165, 0, 2, 1, 21, 0, 6, 42, 0, 3, 218, 
+0, 4, 223, 0, 5, 87, 0, 2, 39, 0, 3, 5, 0, 15, 143, 1, 
+3, 10, 202, 0, 6, 145, 1, 8, 160, 0, 9, 119, 0, 5, 111, 0, 
+11, 16, 1, 0, 11, 0, 0, 172, 2, 243, 255, 246, 206, 63, 61, 228, 
+178, 206, 229, 232, 235, 198, 240, 2, 1, 27, 57, 11, 222, 237, 254, 7, 
+5, 15, 204, 196, 24, 32, 233, 181, 236, 64, 100, 135, 55, 217, 7, 66, 
+25, 176, 217, 9, 50, 33, 190, 8, 84, 82, 242, 216, 23, 37, 38, 238, 
+26, 58, 223, 204, 15, 73, 25, 209, 47, 109, 19, 56, 80, 14, 15, 28, 
+235, 247, 45, 79, 55, 230, 208, 222, 7, 46, 220, 129, 222, 19, 211, 162, 
+234, 5, 248, 237, 240, 234, 194, 211, 211, 228, 192, 195, 3, 14, 55, 47, 
+186, 203, 1, 243, 240, 183, 186, 11, 3, 171, 184, 1, 16, 17, 238, 227, 
+5, 211, 209, 43, 15, 234, 207, 236, 44, 28, 7, 6, 4, 230, 55, 95, 
+19, 13, 21, 254, 238, 0, 82, 69, 1, 32, 43, 42, 236, 194, 11, 238, 
+225, 250, 217, 172, 161, 223, 242, 230, 255, 248, 202, 194, 224, 200, 170, 2, 
+45, 67, 41, 47, 39, 212, 176, 8, 56, 222, 213, 167, 200, 215, 207, 246, 
+15, 229, 187, 24, 26, 232, 2, 222, 0, 69, 245, 217, 243, 239, 5, 245, 
+30, 72, 27, 26, 69, 52, 250, 22, 68, 127, 128, 35, 241, 114, 118, 31, 
+28, 18, 68, 54, 23, 12, 13, 217, 13, 116, 64, 18, 1, 243, 237, 53, 
+52, 214, 175, 207, 251, 191, 191, 238, 19, 16, 241, 203, 203, 4, 4, 230, 
+179, 153, 213, 214, 220, 14, 247, 237, 2, 246, 236, 245, 190, 179, 212, 7, 
+249, 226, 216, 241, 35, 247, 232, 16, 26, 253, 207, 227, 10, 21, 113, 77, 
+23, 232, 255, 23, 244, 200, 141, 184, 201, 238, 16, 23, 3, 218, 227, 10, 
+241, 224, 221, 194, 216, 218, 192, 181, 161, 200, 34, 107, 103, 8, 220, 252, 
+248, 249, 243, 9, 23, 33, 49, 251, 250, 73, 85, 34, 29, 251, 7, 83, 
+63, 6, 238, 38, 46, 11, 58, 43, 78, 51, 40, 38, 59, 104, 36, 234, 
+18, 56, 245, 213, 186, 16, 23, 243, 20, 15, 29, 37, 29, 252, 3, 77, 
+36, 6, 47, 47, 19, 255, 238, 242, 25, 33, 78, 23, 45, 72, 196, 203, 
+42, 2, 188, 217, 246, 194, 159, 213, 222, 180, 228, 248, 226, 242, 186, 236, 
+3, 228, 217, 197, 218, 164, 171, 238, 240, 255, 246, 210, 14, 16, 202, 169, 
+211, 200, 182, 222, 240, 4, 195, 205, 33, 62, 28, 247, 13, 19, 13, 6, 
+7, 249, 252, 244, 239, 244, 200, 201, 250, 0, 172, 173, 1, 225, 192, 196, 
+195, 1, 250, 11, 38, 39, 24, 28, 32, 9, 41, 4, 1, 14, 33, 77, 
+114, 135, 147, 148, 163, 136, 128, 121, 75, 99, 116, 137, 88, 34, 32, 19, 
+49, 86, 20, 0, 25, 13, 254, 1, 218, 220, 27, 245, 9, 9, 10, 20, 
+245, 5, 253, 234, 177, 205, 226, 143, 246, 31, 203, 179, 148, 169, 187, 144, 
+153, 187, 182, 204, 212, 243, 236, 222, 216, 205, 191, 193, 7, 8, 8, 7, 
+1, 0, 16, 8, 1, 0, 2, 8, 0, 0, 5, 0, 3, 18, 0, 4, 
+15, 0, 9, 9, 0, 5, 17, 0, 3, 52, 0, 4, 57, 0, 0, 5, 
+0, 3, 4, 0, 7, 85, 0, 3, 17, 0, 5, 41, 0, 8, 95, 0, 
+3, 70, 0, 3, 13, 0, 5, 44, 0, 8, 1, 0, 6, 101, 0, 4, 
+17, 0, 1, 12, 0, 2, 136, 0, 0, 14, 0, 3, 33, 0, 7, 6, 
+0, 11, 90, 0, 5, 73, 0, 4, 5, 0, 3, 69, 0, 5, 10, 0, 
+12, 148, 0, 5, 27, 0, 11, 145, 0, 3, 34, 1, 5, 215, 0, 4, 
+102, 0, 7, 118, 0, 3, 32, 1, 1, 162, 0, 8, 27, 0, 15, 201, 
+0, 1, 6, 208, 0, 7, 98, 0, 8, 229, 0, 5, 196, 0, 10, 180, 
+0, 10, 112, 0, 15, 1, 0, 4, 2, 46, 0, 4, 10, 0, 13, 105, 
+0, 3, 1, 0, 0, 166, 2, 240, 255, 243, 235, 189, 194, 182, 204, 36, 
+255, 224, 255, 20, 25, 36, 25, 17, 9, 29, 25, 251, 4, 11, 43, 43, 
+6, 224, 0, 66, 81, 71, 243, 249, 9, 206, 222, 247, 3, 10, 49, 43, 
+9, 20, 248, 235, 219, 208, 242, 24, 76, 253, 227, 55, 46, 252, 250, 41, 
+67, 55, 52, 58, 45, 57, 56, 50, 26, 222, 234, 40, 71, 103, 46, 248, 
+45, 97, 26, 248, 39, 34, 57, 54, 49, 18, 243, 252, 21, 35, 30, 18, 
+251, 21, 8, 23, 23, 5, 20, 31, 24, 236, 252, 213, 223, 10, 19, 248, 
+215, 237, 245, 223, 191, 236, 229, 227, 195, 168, 230, 218, 231, 16, 234, 187, 
+222, 248, 225, 190, 188, 225, 206, 201, 216, 190, 171, 222, 14, 247, 220, 215, 
+227, 250, 2, 236, 239, 247, 20, 18, 7, 32, 56, 74, 48, 26, 70, 43, 
+6, 60, 69, 23, 2, 46, 14, 16, 47, 27, 9, 241, 235, 13, 43, 12, 
+232, 14, 48, 25, 249, 251, 30, 239, 252, 64, 62, 49, 55, 21, 18, 18, 
+23, 28, 4, 28, 233, 204, 215, 220, 30, 26, 219, 247, 25, 30, 45, 52, 
+17, 16, 43, 16, 58, 61, 12, 44, 23, 245, 69, 82, 75, 44, 17, 1, 
+4, 24, 215, 251, 15, 30, 38, 9, 11, 253, 233, 17, 5, 232, 11, 14, 
+32, 0, 253, 249, 254, 3, 229, 244, 241, 6, 8, 219, 238, 249, 229, 190, 
+163, 218, 15, 28, 6, 13, 28, 25, 30, 238, 224, 255, 3, 240, 242, 252, 
+250, 6, 6, 15, 249, 227, 210, 245, 15, 237, 4, 244, 203, 196, 232, 228, 
+224, 234, 140, 120, 154, 191, 221, 185, 163, 176, 204, 202, 188, 196, 248, 254, 
+4, 26, 8, 21, 31, 59, 37, 0, 43, 82, 64, 49, 41, 254, 6, 57, 
+70, 31, 51, 41, 58, 103, 52, 38, 50, 64, 78, 64, 22, 72, 71, 17, 
+46, 71, 97, 96, 33, 38, 79, 71, 70, 65, 70, 46, 23, 235, 235, 62, 
+63, 245, 234, 24, 14, 19, 40, 5, 252, 45, 37, 252, 2, 11, 43, 14, 
+243, 238, 233, 248, 1, 234, 171, 165, 175, 197, 184, 192, 190, 199, 213, 202, 
+12, 2, 250, 8, 244, 253, 8, 224, 209, 208, 202, 224, 209, 209, 239, 5, 
+234, 220, 222, 0, 241, 211, 228, 242, 253, 234, 7, 25, 8, 226, 21, 57, 
+16, 13, 252, 6, 31, 56, 21, 245, 240, 195, 212, 248, 0, 241, 1, 21, 
+252, 222, 0, 251, 241, 14, 25, 58, 51, 76, 49, 35, 17, 19, 56, 251, 
+234, 1, 246, 20, 42, 9, 19, 42, 30, 4, 51, 61, 64, 32, 5, 52, 
+51, 67, 72, 38, 23, 252, 8, 59, 77, 102, 32, 250, 40, 30, 1, 1, 
+17, 29, 13, 245, 253, 11, 26, 36, 2, 250, 20, 21, 17, 20, 246, 246, 
+11, 231, 216, 211, 207, 213, 223, 212, 230, 224, 230, 43, 24, 233, 234, 206, 
+225, 253, 8, 244, 224, 231, 222, 239, 201, 208, 7, 1, 0, 16, 8, 4, 
+0, 3, 1, 0, 2, 9, 0, 1, 6, 0, 8, 25, 0, 2, 40, 0, 
+0, 19, 0, 1, 4, 0, 5, 46, 0, 2, 41, 0, 5, 56, 0, 7, 
+17, 0, 5, 55, 0, 3, 61, 0, 5, 1, 0, 15, 15, 0, 2, 8, 
+131, 0, 9, 1, 0, 1, 23, 0, 1, 4, 0, 0, 36, 0, 9, 25, 
+0, 12, 141, 0, 10, 121, 0, 5, 7, 0, 3, 204, 0, 3, 99, 0, 
+4, 118, 0, 5, 69, 0, 3, 73, 0, 2, 7, 0, 12, 157, 0, 10, 
+46, 0, 11, 100, 0, 15, 1, 0, 4, 7, 151, 0, 7, 126, 0, 9, 
+90, 0, 0, 23, 0, 7, 18, 0, 5, 135, 0, 5, 237, 0, 6, 55, 
+0, 0, 148, 0, 12, 252, 0, 2, 21, 0, 13, 120, 0, 9, 158, 0, 
+7, 137, 1, 9, 124, 0, 5, 86, 0, 2, 1, 0, 0, 133, 2, 247, 
+255, 243, 206, 216, 215, 197, 221, 198, 173, 188, 208, 222, 196, 213, 14, 237, 
+205, 216, 5, 16, 241, 215, 215, 9, 15, 242, 250, 254, 237, 1, 24, 226, 
+234, 244, 6, 32, 31, 45, 24, 9, 5, 44, 36, 21, 28, 54, 69, 88, 
+86, 46, 74, 67, 119, 102, 13, 19, 9, 11, 27, 26, 246, 3, 43, 28, 
+26, 61, 78, 52, 39, 47, 50, 49, 21, 246, 224, 237, 1, 1, 16, 21, 
+41, 26, 44, 42, 255, 35, 46, 255, 225, 243, 9, 10, 245, 11, 25, 3, 
+9, 242, 241, 10, 243, 246, 24, 26, 246, 216, 250, 6, 235, 238, 247, 241, 
+215, 227, 223, 225, 226, 207, 221, 226, 250, 234, 233, 0, 240, 226, 208, 205, 
+233, 223, 191, 158, 165, 224, 238, 216, 187, 207, 199, 216, 229, 212, 209, 219, 
+6, 22, 251, 222, 233, 8, 25, 18, 9, 11, 231, 234, 26, 241, 208, 213, 
+30, 42, 18, 6, 14, 38, 253, 4, 32, 50, 29, 41, 51, 57, 49, 57, 
+57, 47, 51, 40, 57, 44, 0, 248, 46, 32, 13, 28, 26, 18, 39, 55, 
+16, 255, 239, 231, 247, 1, 27, 22, 7, 18, 11, 245, 253, 9, 254, 25, 
+59, 69, 20, 226, 234, 3, 11, 35, 56, 39, 32, 33, 15, 250, 2, 0, 
+255, 239, 237, 3, 39, 37, 246, 240, 245, 33, 250, 207, 247, 247, 225, 212, 
+225, 193, 178, 196, 199, 197, 202, 223, 216, 212, 237, 237, 207, 207, 209, 215, 
+220, 206, 197, 220, 225, 200, 211, 213, 222, 241, 226, 199, 219, 222, 239, 244, 
+230, 243, 218, 239, 15, 4, 236, 26, 14, 234, 253, 238, 3, 51, 43, 25, 
+44, 38, 44, 45, 19, 51, 81, 75, 70, 44, 53, 46, 78, 110, 91, 69, 
+62, 73, 47, 69, 82, 43, 249, 40, 75, 18, 17, 45, 43, 47, 38, 13, 
+32, 47, 39, 253, 13, 27, 246, 29, 35, 6, 241, 218, 223, 227, 2, 1, 
+222, 224, 240, 240, 228, 226, 220, 230, 235, 218, 232, 233, 214, 226, 235, 246, 
+4, 254, 245, 218, 218, 234, 238, 242, 221, 253, 4, 231, 209, 211, 217, 228, 
+224, 201, 21, 249, 225, 245, 13, 250, 214, 243, 200, 211, 231, 229, 197, 214, 
+232, 212, 229, 224, 223, 226, 234, 230, 225, 227, 231, 233, 238, 231, 232, 9, 
+44, 38, 19, 23, 23, 17, 29, 60, 54, 40, 38, 41, 36, 44, 43, 26, 
+40, 18, 13, 13, 1, 0, 247, 6, 21, 255, 12, 46, 27, 29, 59, 40, 
+9, 3, 246, 3, 0, 10, 248, 200, 233, 20, 28, 13, 243, 19, 19, 4, 
+22, 14, 32, 12, 252, 4, 31, 47, 13, 12, 47, 45, 2, 246, 35, 44, 
+11, 4, 5, 26, 23, 243, 253, 1, 4, 7, 248, 251, 212, 221, 12, 28, 
+13, 250, 243, 221, 208, 215, 216, 199, 199, 209, 224, 220, 230, 223, 206, 228, 
+9, 12, 220, 250, 8, 243, 251, 218, 197, 207, 217, 220, 224, 232, 235, 237, 
+225, 226, 7, 1, 0, 16, 8, 4, 0, 5, 5, 0, 4, 11, 0, 15, 
+1, 0, 5, 9, 27, 0, 7, 42, 0, 5, 67, 0, 2, 24, 0, 0, 
+3, 0, 1, 17, 0, 8, 106, 0, 15, 16, 0, 0, 2, 21, 0, 5, 
+73, 0, 4, 142, 0, 13, 106, 0, 10, 17, 0, 2, 53, 0, 4, 49, 
+0, 3, 8, 0, 11, 137, 0, 15, 126, 0, 1, 15, 1, 0, 8, 7, 
+57, 0, 15, 250, 0, 18, 2, 16, 0, 5, 190, 0, 15, 229, 0, 4, 
+4, 10, 0, 15, 141, 0, 10, 15, 112, 0, 7, 8, 213, 0, 4, 214, 
+0, 12, 142, 0, 5, 17, 0, 6, 144, 0, 13, 117, 1, 3, 88, 1, 
+6, 1, 0, 0, 154, 2, 245, 255, 243, 237, 232, 238, 221, 222, 237, 248, 
+237, 206, 238, 1, 9, 17, 26, 42, 18, 35, 40, 26, 16, 39, 64, 31, 
+52, 34, 28, 37, 19, 8, 248, 28, 27, 10, 18, 19, 30, 35, 14, 10, 
+34, 43, 27, 19, 246, 246, 16, 247, 230, 5, 6, 241, 245, 13, 20, 240, 
+223, 237, 245, 228, 248, 249, 247, 232, 234, 13, 240, 237, 3, 12, 248, 230, 
+250, 247, 232, 208, 201, 233, 238, 220, 211, 227, 222, 233, 244, 233, 250, 253, 
+247, 9, 31, 25, 4, 24, 71, 47, 11, 6, 239, 23, 47, 25, 27, 25, 
+4, 230, 221, 225, 236, 238, 254, 1, 245, 252, 235, 219, 240, 254, 6, 1, 
+239, 4, 17, 254, 18, 6, 240, 24, 16, 244, 1, 12, 7, 19, 21, 11, 
+11, 22, 7, 249, 21, 37, 255, 212, 249, 29, 17, 252, 253, 10, 252, 205, 
+224, 255, 1, 254, 2, 7, 244, 237, 230, 252, 1, 10, 250, 225, 196, 178, 
+216, 229, 246, 248, 232, 250, 254, 250, 221, 208, 252, 251, 239, 250, 243, 229, 
+247, 2, 0, 0, 9, 19, 4, 248, 251, 246, 251, 18, 25, 13, 5, 249, 
+216, 228, 4, 8, 5, 246, 225, 232, 219, 228, 249, 243, 244, 250, 10, 9, 
+3, 21, 42, 42, 27, 25, 25, 21, 28, 32, 40, 19, 253, 252, 13, 36, 
+37, 17, 232, 245, 27, 24, 233, 215, 249, 18, 253, 243, 3, 230, 223, 210, 
+215, 241, 254, 6, 253, 239, 244, 2, 249, 0, 2, 242, 246, 2, 235, 220, 
+224, 237, 245, 0, 253, 252, 1, 1, 2, 4, 19, 19, 10, 242, 249, 8, 
+253, 8, 17, 1, 6, 14, 27, 1, 227, 0, 14, 2, 241, 12, 10, 247, 
+248, 249, 244, 230, 230, 243, 9, 5, 238, 226, 235, 240, 244, 251, 244, 223, 
+247, 253, 252, 4, 227, 238, 252, 245, 251, 235, 240, 248, 251, 243, 246, 12, 
+14, 11, 7, 10, 234, 249, 8, 16, 18, 1, 2, 4, 6, 15, 32, 23, 
+39, 36, 32, 19, 15, 16, 16, 8, 255, 10, 252, 250, 21, 30, 251, 13, 
+31, 11, 23, 28, 16, 246, 1, 23, 12, 22, 3, 233, 236, 244, 254, 244, 
+228, 238, 255, 5, 254, 242, 254, 250, 231, 244, 240, 238, 249, 236, 226, 232, 
+2, 245, 224, 238, 249, 235, 231, 241, 246, 2, 236, 223, 242, 254, 253, 0, 
+254, 3, 17, 12, 238, 233, 4, 248, 231, 239, 245, 237, 233, 239, 242, 237, 
+232, 247, 251, 236, 247, 12, 14, 13, 1, 239, 252, 5, 2, 0, 13, 32, 
+39, 13, 244, 6, 16, 19, 23, 14, 245, 244, 13, 253, 247, 11, 17, 23, 
+5, 242, 246, 252, 6, 6, 243, 251, 9, 2, 10, 12, 9, 15, 9, 12, 
+10, 252, 4, 19, 14, 4, 4, 6, 12, 245, 244, 242, 239, 247, 250, 1, 
+233, 222, 221, 214, 234, 254, 251, 250, 253, 240, 243, 255, 253, 248, 229, 239, 
+246, 248, 243, 238, 251, 11, 9, 255, 18, 7, 1, 0, 30, 8, 1, 0, 
+10, 20, 0, 32, 7, 7, 3, 0, 3, 4, 0, 5, 54, 0, 10, 15, 
+0, 14, 78, 0, 3, 10, 0, 5, 46, 0, 2, 29, 0, 8, 3, 0, 
+6, 41, 0, 2, 27, 0, 2, 38, 0, 3, 16, 0, 15, 94, 0, 3, 
+4, 96, 0, 4, 10, 0, 2, 7, 0, 15, 203, 0, 4, 4, 35, 0, 
+2, 39, 0, 6, 133, 0, 5, 101, 0, 2, 17, 0, 3, 40, 0, 3, 
+233, 0, 7, 190, 0, 6, 131, 0, 9, 140, 0, 9, 12, 0, 6, 104, 
+0, 12, 66, 1, 3, 238, 0, 6, 11, 1, 15, 64, 0, 1, 6, 13, 
+0, 4, 140, 0, 4, 112, 1, 12, 244, 0, 6, 165, 0, 8, 148, 1, 
+6, 59, 1, 12, 187, 1, 15, 108, 0, 0, 7, 80, 0, 32, 7, 8, 
+32, 0, 240, 9, 8, 250, 250, 14, 7, 2, 7, 244, 245, 240, 245, 255, 
+9, 21, 24, 15, 8, 7, 7, 8, 8, 8, 8, 7, 1, 0, 0, 9, 
+0, 0
+};
+
+const uint8_t hihat_lz[3610] = {
+95, 3, 242, 255, 246, 5, 217, 164, 52, 20, 20, 23, 40, 12, 10, 235, 
+19, 8, 123, 247, 165, 211, 183, 125, 3, 52, 86, 84, 163, 109, 220, 218, 
+244, 150, 242, 111, 246, 196, 17, 33, 57, 189, 239, 63, 63, 161, 122, 223, 
+13, 218, 252, 136, 87, 32, 224, 188, 82, 247, 238, 229, 53, 28, 171, 205, 
+7, 163, 32, 20, 73, 29, 167, 212, 46, 101, 177, 25, 53, 59, 17, 245, 
+202, 77, 223, 67, 105, 44, 227, 125, 200, 150, 17, 94, 191, 220, 222, 178, 
+230, 2, 31, 3, 243, 243, 253, 138, 24, 29, 135, 73, 4, 8, 90, 100, 
+95, 239, 251, 13, 69, 116, 71, 253, 240, 48, 161, 17, 132, 98, 184, 214, 
+65, 43, 223, 44, 218, 97, 184, 12, 20, 13, 217, 99, 158, 60, 224, 37, 
+251, 71, 67, 113, 242, 88, 227, 141, 175, 30, 168, 231, 49, 22, 127, 31, 
+221, 92, 173, 223, 179, 180, 162, 52, 204, 46, 156, 61, 143, 95, 62, 128, 
+12, 63, 144, 130, 32, 204, 151, 51, 64, 204, 99, 144, 123, 82, 109, 84, 
+199, 189, 230, 104, 183, 109, 219, 11, 57, 39, 204, 108, 27, 39, 35, 89, 
+155, 195, 30, 8, 190, 51, 53, 116, 194, 96, 12, 153, 230, 1, 208, 79, 
+205, 144, 40, 249, 31, 85, 210, 7, 237, 240, 16, 204, 98, 82, 28, 13, 
+71, 70, 77, 181, 173, 49, 148, 106, 195, 112, 241, 202, 211, 61, 48, 183, 
+50, 214, 96, 16, 158, 169, 39, 34, 218, 96, 3, 96, 45, 96, 213, 135, 
+114, 113, 60, 77, 211, 77, 160, 190, 78, 9, 191, 160, 59, 46, 170, 0, 
+193, 41, 138, 203, 197, 189, 53, 42, 104, 247, 172, 37, 114, 16, 42, 194, 
+201, 212, 43, 194, 43, 210, 22, 36, 132, 69, 61, 220, 144, 152, 228, 48, 
+107, 210, 210, 39, 102, 211, 176, 58, 131, 190, 12, 120, 238, 252, 177, 14, 
+147, 153, 222, 252, 140, 51, 34, 42, 145, 184, 140, 216, 96, 114, 146, 38, 
+96, 106, 29, 96, 56, 42, 39, 225, 170, 28, 47, 50, 238, 211, 42, 83, 
+253, 153, 14, 194, 100, 154, 19, 93, 253, 12, 244, 254, 19, 40, 37, 192, 
+165, 123, 175, 50, 11, 164, 226, 198, 129, 39, 232, 77, 45, 232, 76, 242, 
+220, 245, 253, 147, 98, 78, 178, 15, 93, 126, 192, 45, 156, 182, 40, 30, 
+94, 198, 110, 106, 57, 80, 45, 197, 53, 30, 152, 199, 68, 213, 95, 87, 
+198, 40, 51, 138, 159, 165, 227, 238, 131, 229, 44, 135, 234, 230, 3, 111, 
+60, 77, 97, 88, 180, 197, 245, 171, 188, 142, 59, 146, 43, 73, 219, 96, 
+186, 201, 195, 36, 194, 14, 211, 225, 129, 13, 186, 233, 245, 147, 20, 215, 
+222, 177, 179, 13, 51, 118, 197, 231, 178, 88, 63, 142, 194, 77, 8, 248, 
+23, 201, 238, 219, 175, 62, 57, 218, 57, 134, 136, 154, 228, 84, 143, 99, 
+213, 128, 193, 159, 122, 8, 7, 7, 8, 1, 0, 0, 8, 0, 33, 7, 
+6, 14, 0, 0, 20, 0, 98, 7, 7, 7, 8, 7, 6, 23, 0, 48, 
+6, 7, 9, 4, 0, 0, 19, 0, 0, 28, 0, 3, 8, 0, 128, 9, 
+7, 6, 10, 8, 6, 8, 9, 30, 0, 0, 14, 0, 32, 7, 8, 27, 
+0, 4, 62, 0, 1, 49, 0, 33, 9, 7, 55, 0, 48, 8, 9, 7, 
+66, 0, 145, 8, 10, 4, 7, 11, 7, 5, 8, 9, 10, 0, 112, 10, 
+7, 6, 9, 10, 3, 8, 7, 0, 242, 4, 9, 6, 5, 12, 7, 4, 
+9, 10, 6, 5, 10, 9, 4, 7, 10, 8, 4, 8, 10, 56, 0, 1, 
+129, 0, 0, 70, 0, 0, 98, 0, 192, 10, 8, 4, 9, 9, 8, 6, 
+6, 11, 7, 5, 9, 117, 0, 1, 32, 0, 0, 25, 0, 0, 131, 0, 
+51, 10, 8, 6, 144, 0, 81, 10, 5, 7, 10, 8, 101, 0, 32, 8, 
+8, 4, 0, 0, 12, 0, 16, 8, 50, 0, 16, 9, 152, 0, 0, 208, 
+0, 0, 60, 0, 96, 6, 8, 10, 7, 5, 9, 44, 0, 17, 6, 138, 
+0, 4, 201, 0, 2, 88, 0, 0, 40, 0, 0, 79, 0, 34, 6, 6, 
+28, 0, 16, 7, 113, 0, 0, 31, 1, 1, 15, 0, 0, 119, 0, 67, 
+7, 8, 8, 5, 53, 0, 2, 104, 0, 0, 71, 0, 2, 219, 0, 0, 
+84, 0, 1, 152, 0, 49, 9, 8, 5, 151, 0, 1, 161, 0, 2, 24, 
+1, 1, 137, 0, 16, 7, 3, 0, 18, 9, 92, 0, 32, 9, 5, 39, 
+0, 48, 9, 9, 5, 28, 0, 5, 124, 0, 1, 126, 0, 4, 86, 1, 
+1, 152, 0, 1, 35, 0, 0, 7, 0, 3, 19, 1, 0, 13, 0, 2, 
+126, 0, 0, 7, 1, 1, 46, 0, 1, 215, 0, 5, 169, 1, 2, 3, 
+0, 4, 121, 0, 2, 70, 0, 5, 134, 0, 3, 62, 1, 48, 7, 8, 
+7, 212, 2, 240, 255, 247, 90, 5, 225, 190, 97, 168, 53, 219, 83, 249, 
+146, 58, 4, 167, 244, 154, 118, 32, 189, 155, 217, 192, 162, 151, 31, 27, 
+95, 134, 89, 166, 184, 203, 152, 177, 11, 140, 14, 191, 196, 224, 220, 183, 
+141, 194, 45, 116, 139, 225, 113, 161, 95, 0, 211, 232, 209, 158, 28, 170, 
+199, 144, 223, 160, 44, 214, 222, 192, 245, 144, 92, 10, 231, 180, 34, 55, 
+231, 4, 110, 188, 114, 171, 158, 25, 236, 181, 206, 118, 27, 62, 166, 109, 
+64, 17, 254, 215, 223, 9, 208, 169, 213, 249, 157, 83, 107, 21, 220, 159, 
+208, 222, 26, 130, 59, 154, 213, 226, 184, 239, 221, 142, 244, 143, 136, 208, 
+55, 26, 186, 161, 243, 162, 129, 23, 141, 50, 91, 112, 5, 37, 187, 85, 
+188, 46, 26, 163, 228, 226, 152, 175, 165, 182, 196, 15, 2, 163, 4, 174, 
+169, 13, 166, 255, 220, 53, 98, 95, 103, 251, 18, 130, 183, 101, 142, 12, 
+157, 43, 150, 240, 225, 79, 14, 191, 33, 66, 149, 54, 169, 174, 43, 162, 
+146, 35, 131, 107, 89, 95, 17, 226, 14, 124, 182, 49, 130, 242, 53, 208, 
+139, 63, 220, 230, 50, 242, 138, 240, 252, 176, 22, 161, 225, 224, 249, 83, 
+156, 24, 228, 77, 249, 153, 185, 127, 96, 220, 47, 57, 12, 131, 84, 223, 
+136, 92, 50, 165, 238, 137, 69, 59, 231, 182, 255, 97, 166, 92, 153, 203, 
+135, 177, 198, 154, 231, 120, 17, 49, 35, 191, 60, 224, 181, 147, 34, 204, 
+137, 175, 62, 216, 107, 36, 206, 197, 147, 170, 70, 35, 190, 45, 137, 126, 
+71, 197, 180, 2, 87, 91, 39, 164, 15, 88, 13, 34, 157, 87, 74, 232, 
+190, 176, 131, 49, 6, 113, 90, 241, 175, 102, 228, 74, 41, 209, 176, 163, 
+181, 86, 165, 54, 141, 226, 13, 135, 98, 246, 108, 193, 26, 251, 222, 145, 
+106, 99, 104, 223, 149, 224, 104, 63, 130, 130, 193, 147, 23, 73, 47, 139, 
+154, 148, 207, 204, 104, 85, 27, 247, 171, 108, 196, 212, 246, 103, 251, 103, 
+58, 108, 120, 240, 140, 101, 3, 123, 237, 96, 110, 78, 114, 227, 112, 3, 
+79, 86, 113, 114, 220, 70, 82, 136, 176, 135, 40, 78, 42, 122, 128, 226, 
+72, 37, 112, 94, 61, 85, 31, 164, 155, 162, 70, 84, 159, 163, 150, 3, 
+122, 46, 120, 122, 205, 142, 4, 79, 124, 62, 99, 49, 108, 139, 189, 120, 
+28, 110, 13, 157, 160, 161, 96, 80, 91, 25, 61, 55, 138, 222, 120, 167, 
+16, 80, 212, 143, 91, 76, 172, 172, 181, 174, 151, 47, 107, 201, 142, 105, 
+255, 254, 247, 101, 71, 241, 130, 243, 167, 51, 86, 76, 36, 88, 21, 78, 
+105, 73, 137, 247, 60, 68, 135, 22, 250, 89, 184, 192, 94, 254, 189, 32, 
+18, 235, 8, 223, 29, 216, 117, 168, 133, 122, 76, 132, 224, 103, 251, 144, 
+93, 25, 113, 63, 93, 160, 8, 8, 7, 8, 6, 5, 0, 193, 7, 7, 
+8, 8, 8, 7, 6, 8, 9, 7, 6, 9, 7, 0, 17, 7, 22, 0, 
+2, 10, 0, 17, 7, 4, 0, 0, 16, 0, 48, 8, 7, 7, 31, 0, 
+1, 47, 0, 18, 6, 11, 0, 2, 63, 0, 16, 8, 48, 0, 3, 35, 
+0, 32, 6, 9, 22, 0, 32, 9, 6, 36, 0, 2, 39, 0, 3, 46, 
+0, 1, 7, 0, 4, 78, 0, 6, 95, 0, 0, 11, 0, 0, 49, 0, 
+3, 78, 0, 4, 126, 0, 3, 38, 0, 4, 4, 0, 3, 67, 0, 4, 
+28, 0, 1, 138, 0, 6, 14, 0, 2, 148, 0, 34, 7, 7, 37, 0, 
+5, 173, 0, 4, 59, 0, 6, 229, 0, 3, 28, 0, 5, 29, 0, 3, 
+23, 0, 3, 212, 0, 1, 21, 0, 6, 99, 0, 2, 60, 0, 6, 141, 
+0, 7, 149, 0, 7, 156, 0, 2, 211, 0, 9, 21, 0, 10, 42, 0, 
+6, 11, 0, 9, 208, 0, 12, 11, 0, 15, 21, 0, 12, 5, 7, 0, 
+10, 74, 0, 10, 102, 0, 5, 35, 0, 4, 46, 0, 7, 22, 0, 3, 
+13, 0, 7, 39, 0, 16, 7, 153, 2, 240, 255, 247, 196, 150, 157, 239, 
+14, 77, 202, 182, 73, 250, 249, 4, 239, 35, 31, 76, 117, 56, 131, 17, 
+104, 207, 159, 91, 47, 166, 222, 89, 203, 224, 99, 209, 172, 84, 44, 160, 
+228, 128, 174, 201, 43, 46, 9, 129, 67, 48, 197, 233, 111, 158, 194, 100, 
+11, 180, 9, 89, 159, 249, 20, 66, 175, 243, 106, 156, 209, 98, 22, 141, 
+22, 89, 191, 201, 102, 1, 129, 65, 60, 164, 246, 87, 231, 173, 43, 83, 
+157, 219, 129, 164, 252, 16, 25, 239, 222, 23, 232, 74, 214, 181, 64, 10, 
+231, 78, 153, 215, 118, 234, 164, 61, 50, 181, 239, 61, 24, 157, 18, 74, 
+195, 217, 93, 244, 158, 50, 13, 37, 200, 233, 86, 154, 17, 35, 14, 206, 
+45, 29, 116, 79, 67, 164, 230, 86, 255, 161, 46, 58, 183, 237, 37, 58, 
+155, 13, 74, 182, 245, 51, 249, 207, 36, 4, 235, 10, 52, 165, 242, 42, 
+23, 233, 222, 56, 222, 6, 244, 51, 192, 0, 69, 151, 24, 67, 225, 217, 
+255, 37, 28, 183, 251, 71, 241, 184, 36, 61, 189, 225, 64, 17, 170, 33, 
+52, 193, 238, 69, 249, 168, 76, 4, 195, 21, 56, 223, 192, 52, 48, 177, 
+0, 63, 194, 6, 2, 47, 225, 209, 71, 247, 175, 62, 35, 175, 6, 60, 
+238, 186, 89, 238, 203, 6, 39, 23, 180, 12, 56, 231, 206, 38, 22, 220, 
+27, 10, 166, 73, 31, 183, 10, 11, 24, 242, 230, 16, 17, 224, 5, 5, 
+36, 220, 205, 44, 15, 13, 224, 3, 244, 248, 39, 252, 216, 9, 45, 194, 
+20, 36, 198, 1, 51, 246, 194, 40, 33, 212, 233, 48, 11, 200, 14, 9, 
+12, 1, 219, 59, 223, 216, 49, 233, 240, 41, 251, 218, 2, 50, 251, 195, 
+30, 25, 219, 0, 55, 211, 217, 53, 252, 237, 37, 221, 228, 22, 2, 12, 
+12, 225, 233, 45, 236, 238, 50, 228, 214, 39, 23, 216, 250, 29, 242, 250, 
+250, 15, 14, 223, 254, 30, 225, 19, 25, 202, 1, 44, 247, 203, 34, 30, 
+207, 246, 57, 235, 211, 35, 4, 246, 252, 29, 220, 4, 38, 198, 16, 12, 
+245, 7, 245, 11, 13, 231, 1, 6, 5, 236, 8, 37, 219, 232, 45, 2, 
+215, 5, 42, 243, 210, 49, 2, 212, 24, 16, 235, 239, 18, 27, 218, 245, 
+38, 248, 230, 17, 251, 3, 245, 5, 24, 223, 251, 29, 241, 235, 45, 225, 
+232, 25, 25, 215, 250, 35, 238, 239, 12, 39, 215, 247, 38, 245, 216, 26, 
+30, 219, 248, 41, 251, 214, 29, 22, 217, 246, 38, 238, 229, 55, 233, 230, 
+20, 24, 242, 220, 26, 25, 222, 5, 21, 231, 254, 10, 23, 221, 249, 16, 
+24, 218, 249, 43, 227, 239, 26, 17, 214, 9, 33, 227, 241, 50, 219, 250, 
+15, 243, 12, 252, 250, 16, 238, 5, 23, 198, 43, 252, 238, 7, 1, 20, 
+233, 246, 19, 21, 216, 249, 35, 1, 215, 29, 24, 206, 7, 8, 7, 7, 
+8, 4, 0, 0, 3, 0, 20, 8, 3, 0, 6, 19, 0, 5, 10, 0, 
+4, 25, 0, 1, 18, 0, 8, 35, 0, 5, 14, 0, 6, 17, 0, 6, 
+7, 0, 3, 26, 0, 6, 18, 0, 7, 39, 0, 3, 115, 0, 6, 116, 
+0, 14, 35, 0, 7, 105, 0, 1, 2, 0, 2, 17, 0, 15, 46, 0, 
+13, 1, 3, 0, 10, 21, 0, 7, 193, 0, 6, 231, 0, 4, 14, 0, 
+4, 30, 0, 7, 50, 0, 5, 120, 0, 1, 32, 0, 5, 28, 0, 13, 
+116, 0, 1, 58, 0, 12, 44, 1, 4, 178, 0, 12, 40, 1, 6, 98, 
+1, 4, 120, 0, 8, 78, 0, 11, 121, 1, 10, 100, 0, 15, 7, 0, 
+8, 10, 148, 0, 14, 153, 1, 4, 135, 1, 4, 137, 1, 9, 219, 0, 
+16, 7, 159, 2, 240, 255, 248, 18, 22, 228, 250, 15, 14, 225, 1, 22, 
+235, 245, 8, 22, 222, 7, 19, 236, 245, 28, 252, 233, 3, 14, 10, 223, 
+9, 8, 5, 254, 254, 246, 29, 241, 223, 35, 3, 238, 5, 5, 239, 20, 
+7, 227, 11, 19, 238, 245, 12, 16, 231, 5, 8, 245, 1, 12, 6, 233, 
+251, 23, 253, 238, 0, 19, 250, 228, 43, 244, 230, 27, 255, 241, 250, 12, 
+12, 228, 12, 20, 233, 1, 253, 16, 242, 5, 253, 243, 30, 247, 235, 19, 
+7, 238, 3, 253, 18, 251, 227, 15, 13, 241, 248, 21, 7, 226, 0, 23, 
+249, 241, 16, 254, 252, 249, 13, 4, 227, 28, 0, 230, 8, 27, 237, 243, 
+24, 255, 233, 11, 27, 235, 245, 24, 247, 243, 13, 248, 1, 254, 13, 2, 
+226, 25, 9, 231, 253, 6, 12, 247, 244, 19, 10, 227, 10, 17, 241, 240, 
+34, 251, 228, 29, 244, 243, 0, 26, 243, 236, 15, 15, 232, 1, 23, 227, 
+2, 9, 15, 228, 254, 11, 8, 4, 228, 17, 3, 242, 9, 11, 241, 250, 
+18, 250, 243, 22, 255, 230, 12, 15, 248, 243, 17, 11, 235, 251, 22, 251, 
+233, 25, 254, 237, 6, 22, 244, 238, 18, 6, 235, 14, 9, 228, 6, 8, 
+2, 241, 20, 252, 236, 6, 14, 2, 233, 11, 16, 241, 246, 20, 254, 241, 
+10, 8, 246, 246, 13, 6, 236, 4, 18, 249, 238, 21, 1, 238, 10, 7, 
+2, 247, 6, 3, 251, 5, 246, 3, 7, 4, 251, 8, 255, 237, 15, 5, 
+250, 252, 4, 253, 1, 15, 242, 249, 20, 250, 242, 10, 13, 239, 253, 21, 
+243, 248, 7, 10, 246, 246, 19, 247, 255, 9, 241, 3, 1, 13, 248, 244, 
+13, 250, 252, 10, 255, 246, 5, 1, 253, 254, 10, 249, 248, 6, 1, 3, 
+4, 245, 252, 10, 245, 11, 4, 243, 0, 5, 11, 240, 252, 12, 251, 250, 
+12, 254, 246, 7, 254, 253, 7, 255, 251, 2, 254, 8, 250, 253, 254, 11, 
+253, 241, 20, 251, 241, 10, 8, 242, 2, 9, 251, 250, 4, 10, 243, 0, 
+7, 252, 251, 9, 6, 240, 2, 11, 252, 247, 10, 254, 254, 252, 5, 8, 
+240, 2, 1, 3, 254, 5, 1, 245, 6, 4, 252, 253, 6, 252, 2, 253, 
+255, 12, 247, 247, 10, 8, 239, 7, 8, 242, 3, 3, 1, 254, 6, 0, 
+243, 4, 11, 250, 251, 6, 2, 248, 4, 6, 248, 254, 5, 4, 248, 255, 
+8, 254, 248, 6, 6, 245, 255, 9, 251, 250, 14, 251, 246, 10, 6, 242, 
+1, 12, 250, 249, 4, 10, 244, 255, 7, 251, 254, 9, 253, 249, 1, 7, 
+1, 245, 7, 4, 251, 251, 6, 5, 246, 255, 10, 251, 247, 12, 4, 243, 
+255, 12, 251, 248, 8, 0, 252, 253, 9, 255, 245, 9, 2, 247, 1, 11, 
+249, 250, 2, 6, 3, 243, 5, 5, 250, 254, 9, 253, 248, 11, 255, 247, 
+2, 10, 249, 249, 10, 0, 247, 8, 8, 7, 7, 8, 8, 3, 0, 5, 
+7, 0, 0, 10, 0, 0, 11, 0, 35, 8, 7, 13, 0, 6, 3, 0, 
+5, 10, 0, 4, 40, 0, 2, 7, 0, 0, 41, 0, 2, 25, 0, 1, 
+2, 0, 4, 54, 0, 5, 35, 0, 5, 89, 0, 8, 74, 0, 7, 63, 
+0, 8, 95, 0, 8, 32, 0, 8, 17, 0, 2, 116, 0, 10, 64, 0, 
+5, 32, 0, 15, 46, 0, 2, 6, 48, 0, 12, 137, 0, 3, 32, 0, 
+2, 121, 0, 6, 167, 0, 12, 152, 0, 5, 159, 0, 11, 98, 0, 1, 
+88, 0, 4, 49, 0, 8, 29, 0, 5, 207, 0, 7, 47, 0, 15, 97, 
+1, 2, 8, 131, 0, 4, 51, 0, 10, 188, 0, 12, 57, 0, 10, 111, 
+1, 11, 24, 0, 7, 233, 0, 15, 194, 0, 2, 4, 28, 0, 15, 58, 
+1, 0, 0, 56, 2, 240, 149, 5, 7, 249, 251, 6, 4, 247, 254, 7, 
+0, 249, 4, 7, 245, 1, 6, 248, 6, 4, 247, 1, 10, 249, 253, 6, 
+254, 253, 6, 253, 254, 6, 249, 255, 2, 7, 249, 253, 4, 253, 0, 8, 
+248, 255, 6, 252, 253, 4, 6, 248, 255, 2, 6, 251, 254, 2, 0, 255, 
+255, 4, 253, 254, 2, 1, 253, 0, 5, 1, 246, 7, 1, 250, 7, 0, 
+251, 255, 6, 255, 250, 2, 7, 251, 250, 9, 255, 249, 5, 2, 251, 1, 
+2, 255, 254, 4, 255, 252, 4, 255, 0, 3, 252, 0, 0, 0, 1, 254, 
+1, 255, 1, 2, 254, 254, 4, 0, 253, 255, 7, 253, 249, 8, 254, 251, 
+3, 2, 252, 0, 2, 0, 254, 2, 3, 252, 1, 0, 1, 0, 255, 0, 
+0, 2, 253, 2, 2, 253, 0, 1, 255, 2, 0, 253, 0, 2, 255, 255, 
+4, 254, 252, 4, 3, 251, 255, 3, 255, 0, 255, 15, 0, 33, 1, 0, 
+1, 0, 240, 5, 1, 253, 1, 3, 254, 254, 0, 4, 253, 253, 6, 255, 
+250, 4, 2, 251, 0, 3, 254, 255, 4, 0, 160, 2, 0, 254, 0, 5, 
+251, 253, 5, 0, 250, 53, 0, 240, 44, 5, 0, 251, 1, 5, 252, 0, 
+3, 252, 255, 3, 1, 252, 1, 1, 0, 254, 0, 2, 254, 255, 2, 255, 
+0, 1, 255, 255, 2, 3, 250, 0, 5, 252, 254, 2, 1, 255, 254, 0, 
+2, 255, 253, 1, 1, 254, 254, 3, 0, 252, 0, 2, 1, 254, 255, 1, 
+255, 1, 1, 254, 80, 0, 48, 2, 2, 252, 191, 0, 112, 2, 0, 255, 
+0, 1, 0, 254, 38, 0, 0, 116, 0, 144, 2, 255, 253, 2, 1, 253, 
+255, 3, 254, 39, 0, 0, 178, 0, 129, 1, 255, 0, 0, 0, 255, 255, 
+2, 130, 0, 96, 254, 0, 3, 255, 253, 1, 44, 0, 0, 176, 0, 1, 
+145, 0, 32, 1, 1, 117, 0, 17, 255, 221, 0, 16, 254, 16, 0, 2, 
+136, 0, 1, 16, 0, 3, 3, 0, 2, 7, 0, 64, 2, 255, 254, 0, 
+156, 0, 32, 0, 1, 117, 0, 16, 254, 86, 0, 4, 4, 0, 48, 1, 
+0, 254, 25, 0, 3, 17, 0, 0, 165, 0, 32, 0, 254, 43, 0, 1, 
+3, 0, 1, 132, 0, 1, 35, 0, 1, 32, 0, 7, 88, 0, 1, 78, 
+0, 4, 70, 0, 6, 105, 0, 3, 38, 0, 4, 14, 0, 0, 4, 0, 
+67, 8, 8, 7, 7, 4, 0, 8, 3, 0, 22, 7, 3, 0, 1, 7, 
+0, 4, 19, 0, 8, 4, 0, 3, 53, 0, 9, 51, 0, 7, 24, 0, 
+3, 65, 0, 2, 36, 0, 20, 8, 68, 0, 8, 88, 0, 5, 60, 0, 
+9, 72, 0, 12, 78, 0, 4, 57, 0, 2, 1, 0, 13, 127, 0, 8, 
+191, 0, 10, 7, 0, 5, 10, 0, 4, 81, 0, 10, 34, 0, 10, 60, 
+0, 5, 172, 0, 1, 107, 0, 9, 60, 0, 15, 247, 0, 3, 7, 55, 
+0, 14, 78, 0, 9, 3, 1, 12, 217, 0, 13, 13, 0, 3, 116, 0, 
+10, 177, 0, 6, 19, 1, 10, 198, 0, 8, 91, 1, 9, 80, 0, 15, 
+104, 0, 2, 13, 118, 0, 7, 81, 0, 1, 7, 0, 0, 107, 0, 64, 
+0, 0, 255, 255, 3, 0, 2, 4, 0, 4, 7, 0, 3, 19, 0, 5, 
+29, 0, 12, 17, 0, 0, 19, 0, 5, 18, 0, 1, 31, 0, 4, 54, 
+0, 5, 17, 0, 1, 37, 0, 2, 7, 0, 4, 40, 0, 3, 59, 0, 
+14, 2, 0, 80, 0, 8, 8, 7, 7, 3, 0, 2, 4, 0, 4, 7, 
+0, 3, 19, 0, 5, 29, 0, 12, 17, 0, 0, 19, 0, 5, 18, 0, 
+1, 31, 0, 4, 54, 0, 5, 17, 0, 1, 37, 0, 2, 7, 0, 4, 
+40, 0, 3, 59, 0, 14, 2, 0, 16, 8
+};
@@ -0,0 +1,482 @@
+// Generado por tools/bank_gen.c a partir de audio_table.h; no editar.
+// Muestras de 12 bits empaquetadas, 8 por cada 3 palabras (ver packed12.h).
+
+#define AUDIO_SAMPLE_RATE 24000
+#define SNARE_SIZE 3600
+#define KICK_SIZE 3600
+#define HIHAT_SIZE 2694
+#define AUDIO_BITS_PER_SAMPLE 12
+
+const uint32_t kick_packed[1350] = {
+0x047fc803, 0x780a7fc8, 0x80081e7e, 0xf485d7cf, 0x08147ed7, 0x7fd7f482, 0x67875816, 0xc7ed81f8, 
+0x70885181, 0xef7ef796, 0xa80d8137, 0x7fa75b84, 0x167af817, 0xb8438498, 0x8257b275, 0x0e84786d, 
+0x27c88208, 0x7b97e480, 0x5a736754, 0x78467e47, 0x7fd82187, 0x7e7577ca, 0x380e8418, 0x87e8d48b, 
+0x197b0839, 0x778b8af8, 0x7cf8b185, 0x0682e89e, 0x08a28448, 0x7e971886, 0x008b3865, 0xd8858498, 
+0x88089288, 0xb07c787f, 0xf7ec7867, 0x84a8457b, 0x4a7ab8a4, 0xc8717e67, 0x8ab76885, 0x94853885, 
+0xa7d083c8, 0x8027b87a, 0x2e81d840, 0xc6c86787, 0x7078c683, 0xa84b250a, 0x27e67fa6, 0x94a61766, 
+0x71e8ccf5, 0x3d83dd7e, 0x6fc935bc, 0xaf6e2647, 0x15e56566, 0x5a563966, 0x814a64c5, 0x24644774, 
+0x5e16d856, 0x794fa61f, 0x76fd5614, 0x6326d678, 0x6679166f, 0x58c87e77, 0x9a19f39f, 0x9c9ca91f, 
+0x7d1dbb8a, 0xc12cd4d2, 0x4bc2ec33, 0xad16cb1c, 0xcecd13d3, 0x60c80cb5, 0xdc1cc41c, 0xb7cbbabe, 
+0x86adab32, 0x79d4a3ca, 0x8e694499, 0xaf820888, 0x66f674e7, 0x5ee6526a, 0x1155f59a, 0x64744c85, 
+0x3ad3e244, 0x2c32939d, 0x32bc3213, 0x23826f29, 0xfc208278, 0x728822d1, 0x1f81b925, 0x0d1f71da, 
+0x72252462, 0x1aa1aa1d, 0xc21f21c4, 0xe1ae1bb1, 0x1901f522, 0x7e24326a, 0xd2ab2b92, 0x1a61fe23, 
+0xe1277239, 0x635725d1, 0x50a50148, 0x9941f49d, 0xb31834b3, 0x2d72dd2f, 0x633212f7, 0x33ee3a43, 
+0x4ce48143, 0xf258852b, 0xb6d565f5, 0x8447c774, 0xbf9428c3, 0xdab7a3c9, 0xc10ba0b2, 0x42ce2c7c, 
+0x2df2d9ed, 0xec9e8be4, 0x54f30f02, 0x1f8cf73f, 0xfbdfaefa, 0xd0fcdfc5, 0xdfd9fd6f, 0xfe1fdefd, 
+0xe4fe4fe2, 0x6fe5fe6f, 0xfdbfe3fe, 0xd7fdafe1, 0xdfc9fc9f, 0xf9afb0fb, 0x75f73f8c, 0x7f27f47f, 
+0xecfef5f1, 0x96ebceae, 0x0e21e77e, 0xde1e30e7, 0xe7e04e0c, 0x0da7d97d, 0xda9dafdb, 0x81d68d8e, 
+0x2d11d21d, 0xcd0cfad2, 0x65cb7ca0, 0xdc05c35c, 0xb66b9dbd, 0x2bb30b3b, 0xbaf3ae8b, 0x9829f2a6, 
+0xd2962993, 0x68b58e58, 0x7e67f787, 0x2a7897d2, 0xd66e6b97, 0x66566464, 0xbe5f963f, 0xa56058e5, 
+0x4d451053, 0x2f46e4aa, 0x93b83f44, 0x2f833537, 0x452802bc, 0xf1d320c2, 0x13816919, 0xb60de10a, 
+0x208409a0, 0x05606307, 0x3c04204b, 0xe0320360, 0x02802b02, 0x23024027, 0x00210210, 0x01f01f02, 
+0x2002001f, 0x70230220, 0x02e02a02, 0x4503d034, 0x405904f0, 0x07c06f06, 0xa909c08b, 0x40cf0bc0, 
+0x10c0f80e, 0x5413b122, 0x018916a1, 0x1d71c01a, 0x46218200, 0x42a12692, 0x2eb2e02b, 0x4837c343, 
+0x640a3c93, 0x48643943, 0xf050e4cb, 0x457651c4, 0x55156b57, 0xc45a45ba, 0x95e05d75, 0x6155ea5d, 
+0x3363562f, 0xc6786526, 0x6c06796a, 0xe26ea6d3, 0x375671e6, 0x79876774, 0xfc7d57fa, 0xa8758317, 
+0x8d789787, 0x7996a92f, 0x79e99d69, 0xa65a32a0, 0xffae0a99, 0x5b9bb52a, 0xc2bbfebc, 0xc9c91c59, 
+0x5d2fcfbc, 0xd75d62d4, 0xaeda6d9e, 0xfde3dc5d, 0xe33e15df, 0x7de6ee51, 0x3eaae93e, 0xef9eddec, 
+0x38f26f0f, 0x6f57f48f, 0xf7ef72f6, 0x9ef94f8a, 0x3fadfa6f, 0xfbcfb8fb, 0xc6fc3fc0, 0xbfcafc8f, 
+0xfcdfccfc, 0xcefcefce, 0xdfcdfcef, 0xfcbfccfc, 0xbffc4fc8, 0xbfb3fb9f, 0xf97fa2fa, 0x73f81f8d, 
+0x5f56f65f, 0xf23f34f4, 0xe6efbf0f, 0x1eb7ecfe, 0xe6ce87ea, 0x19e36e52, 0xeddfdfce, 0xd7dd9cdb, 
+0x1bd3bd5b, 0xaccfcf4d, 0xc56c80ca, 0xdcc0bc2e, 0x6b8bbb5b, 0xb06b34b6, 0x87ab2ae8, 0x4a25a4da, 
+0x97b99a9d, 0xfe931962, 0x58ad8c98, 0x84f85889, 0x2083a839, 0xc8278328, 0x7d17d981, 0x9b7c57df, 
+0x47ad77b7, 0x74375c77, 0xfa73b76d, 0x56d66ee6, 0x6816a06c, 0x2865065f, 0xc5e26146, 0x55e5725b, 
+0xfd52b54a, 0xf4d74d94, 0x44a46e48, 0xbf3f843f, 0x43763a43, 0x2fe30d34, 0x962bf2de, 0x224a2732, 
+0x1e31fe22, 0x8a1ac1c7, 0x616216d1, 0x13114014, 0xd90f1105, 0x40c50c00, 0x0a00a80b, 0x7d08c097, 
+0xe0730790, 0x06606c06, 0x5705d061, 0xb04d0530, 0x04304304, 0x41042044, 0xc03f03f0, 0x03903a03, 
+0x3903903a, 0xd03a0390, 0x03d03c03, 0x3d03d03c, 0x103f03e0, 0x04c04504, 0x6205c054, 0xc0740680, 
+0x09208607, 0xb90ad0a0, 0xc0da0c90, 0x10b0fa0e, 0x4313111d, 0xa17215c1, 0x1af19a18, 0xfc1dd1c8, 
+0xe23821b1, 0x28526724, 0xf22ce2aa, 0x433530e2, 0x39537135, 0xee3d23b8, 0x542b4073, 0x4a348045, 
+0x175074c1, 0x855a5375, 0x5cf5a758, 0x69649617, 0xe6a066c6, 0x6ee6dd6b, 0x5d73c711, 0x17b47977, 
+0x8247fd7d, 0x9a89184a, 0xf8dc8c08, 0x8fc8e78d, 0x4693b944, 0x89809569, 0x9b999598, 0xe29e39d5, 
+0x7a41a1f9, 0xa7ca5ba5, 0xe5ac6aa1, 0x7b07afca, 0xb3bb23b1, 0x7fb6ab67, 0x6bb6b98b, 0xc1bbfcbd, 
+0x6dc4fc36, 0x5ca1c8cc, 0xce4cc6cb, 0x22d01cf6, 0xdd46d36d, 0xd6ed5bd5, 0xc7db3d8f, 0xcde0dcfd, 
+0xe1ae00de, 0x72e54e31, 0x4e7ae7fe, 0xe6ce76e7, 0xa3e77e6e, 0x8ecceb2e, 0xf0aef6ef, 0x0ef14f18, 
+0xaf1ff11f, 0xf4ff4af3, 0x40f47f4e, 0xaf30f2df, 0xf28f26f2, 0x13f22f2b, 0x8f01f04f, 0xef4ef6f0, 
+0x00f03ef6, 0x4f0ef05f, 0xeebefaf0, 0xc9ed3ee8, 0x8eb9ed0e, 0xebbec1eb, 0xc1ec4ec4, 0x5ea8eafe, 
+0xe99e9aea, 0x9eea2e9d, 0x3e90e98e, 0xe5ce70e8, 0x36e3fe49, 0x1e1fe26e, 0xe0fe0be1, 0xf2dffe08, 
+0xeddddebd, 0xdabdbfdc, 0x61d85d96, 0x0d34d4ad, 0xcfbd0ad2, 0xd8ce5cf7, 0x6cb6cc4c, 0xc5ec7bc9, 
+0x06c25c46, 0xabccbe5c, 0xb68b7dba, 0x18b36b50, 0x6adfafbb, 0xa8caa6ad, 0x3da60a7d, 0x19f9a13a, 
+0x9999b39d, 0x5e97498d, 0x292493e9, 0x8d18df90, 0x998b08be, 0x286c8858, 0x81182d85, 0xcc7d47f9, 
+0x37b67c37, 0x76a7887a, 0x22733746, 0xe7097107, 0x6e56ee6f, 0x9e6b36cf, 0x267f68d6, 0x66c66f67, 
+0x6366666a, 0x965065c6, 0x64164564, 0x2e63763d, 0x261a6266, 0x60960e61, 0x1160d60a, 0x760d6126, 
+0x5fb60260, 0xe75ef5f4, 0xd5dc5e25, 0x5cd5d45d, 0xcb5cf5cf, 0x05c85c35, 0x5b75ba5c, 0xa95ad5b4, 
+0x55a55a25, 0x57f5955a, 0x4755c56b, 0xd5455425, 0x53454054, 0x2652952a, 0x252051f5, 0x4fa50951, 
+0xdc4ea4f8, 0x54da4dc4, 0x4ca4c94d, 0xae4b94c4, 0x849f4a44, 0x48348f49, 0x53467472, 0x24434454, 
+0x41e42843, 0xfd40b419, 0x63e23ef3, 0x3c23cc3d, 0xa33b43bc, 0x03823943, 0x34335637, 0x1b327334, 
+0x33003103, 0x2d42e42f, 0xb72c22d0, 0x82982a72, 0x27627a28, 0x50258266, 0x123b2452, 0x21622323, 
+0xf420220b, 0x91df1e81, 0x1c11ce1d, 0xa91ad1b7, 0x519a1a51, 0x18a19119, 0x7317b183, 0x31641681, 
+0x15f16316, 0x4f15615a, 0x01401471, 0x13c13d14, 0x3c13c13c, 0xd13d13b1, 0x14713f13, 0x5314d148, 
+0xe1591551, 0x16616215, 0x7116e16a, 0x117a1751, 0x18b18718, 0x9419118e, 0xf19b1971, 0x1a81a319, 
+0xb61b11ac, 0x61c01bb1, 0x1d11cc1c, 0xe61de1d7, 0x81fc1f01, 0x22121420, 0x4923b22d, 0xc26a2592, 
+0x2a028e27, 0xdb2c62b3, 0xe3072f02, 0x35033731, 0x9c383369, 0x13d33b73, 0x42d40e3f, 0x8d46c44d, 
+0x34d14af4, 0x5385154f, 0xa257e55b, 0xf5ea5c65, 0x65863460, 0xc76a367e, 0x97126ed6, 0x78475f73, 
+0xf47cf7a9, 0x484081b7, 0x8a888786, 0x128ee8ca, 0xe95b9369, 0x9c299f97, 0x28a059e3, 0xda6ca4ba, 
+0xacdab1a8, 0x25b0aae9, 0xcb60b43b, 0xbb5b9ab7, 0xf9be6bcf, 0xbc1bc0ab, 0xc49c3ac2, 0x79c66c55, 
+0x1c98c88c, 0xcb1ca9ca, 0xcecc0cb6, 0x1cf0cdfc, 0xd1ad0dd0, 0x3ad30d25, 0x0d53d46d, 0xd7fd70d6, 
+0xb1da2d93, 0x5dd2dc2d, 0xe0cdf9de, 0x42e33e20, 0x2e62e51e, 0xe91e80e7, 0xc1eb1ea2, 0xaedced0e, 
+0xf06ef8ee, 0x2bf1ef10, 0xbf41f35f, 0xf60f56f4, 0x7cf73f6a, 0x1f8bf84f, 0xf9bf95f9, 0xabfa5fa0, 
+0x7fb3fb0f, 0xfbefbafb, 0xc5fc3fc1, 0xcfcafc7f, 0xfcffcdfc, 0xd1fd0fcf, 0x3fd2fd2f, 0xfd4fd3fd, 
+0xd5fd5fd4, 0x6fd6fd5f, 0xfd7fd6fd, 0xd5fd6fd6, 0x5fd5fd6f, 0xfd4fd5fd, 0xd3fd3fd4, 0xefd0fd2f, 
+0xfcafcdfc, 0xc1fc4fc7, 0x4fb8fbcf, 0xfacfb0fb, 0x9afa1fa7, 0xef88f92f, 0xf69f74f7, 0x3ef4df5c, 
+0x4f22f30f, 0xef6f05f1, 0xbbed1ee5, 0x8e8eea5e, 0xe4de63e7, 0x0ae21e37, 0xedd9df2e, 0xd84da2db, 
+0x2cd49d67, 0xccedd0dd, 0xc87ca9cc, 0x1ac3ec63, 0xbbd3bf7c, 0xb59b82ba, 0xe5b0ab30, 0x4aa3ac3a, 
+0xa41a64a8, 0xd89fca1e, 0x798d9b39, 0x91694096, 0xa28c68ec, 0x38618808, 0x80082384, 0x8c7b17d9, 
+0x57457687, 0x6e870672, 0x8a6aa6c9, 0x56486686, 0x5e160262, 0x835a35c2, 0xf53f5615, 0x4df4fe51, 
+0x824a04bf, 0x74464644, 0x3ee40942, 0x9f3ba3d4, 0x236b3853, 0x32333a35, 0xde2f530c, 0xa2b12c62, 
+0x27028529, 0x3424725c, 0x02112222, 0x1de1ef20, 0xaf1bf1ce, 0x61931a11, 0x16b17818, 0x4815215f, 
+0x813213d1, 0x11611f12, 0x0010710f, 0xe0f40fa1, 0x0e30e90e, 0xd10d70dd, 0x60ca0cd0, 0x0c00c30c, 
+0xb70ba0bd, 0x40b40b50, 0x0b20b30b, 0xb00b10b1, 0xf0af0b00, 0x0b10b00a, 0xb30b30b2, 0x70b50b40, 
+0x0bb0b90b, 0xc70c30bf, 0x20ce0ca0, 0x0da0d70d, 0xe70e20de, 0xc0f40ec0, 0x1101050f, 0x2f12511b, 
+0xb1421391, 0x15b15314, 0x7816d163, 0xc1901841, 0x1b31a719, 0xdb1cc1bf, 0x81f91ea1, 0x22721720, 
+0x51243235, 0x22702602, 0x2a829528, 0xdf2cd2bb, 0x73032f12, 0x34132c31, 0x8136c357, 0xf3ab3973, 
+0x3e63d33b, 0x264103fb, 0xe45543d4, 0x4a148846, 0xe94d14ba, 0xd5175004, 0x55a54352, 0xa458b573, 
+0xc5d55bd5, 0x61a6035e, 0x60649632, 0x768f6776, 0x6d36be6a, 0x106fb6e7, 0x773f7267, 0x78677075, 
+0xc87b379d, 0x87f37de7, 0x83181d80, 0x6f85a845, 0x88968838, 0x8cc8ba8a, 0x048f28df, 0xc9299179, 
+0x95f94e93, 0x8d97e96f, 0x89a999b9, 0x9d79c89b, 0x039f59e6, 0xba1ea11a, 0xa43a37a2, 0x67a5ba4f, 
+0x6a7da72a, 0xa97a8fa8, 0xb1aa8a9f, 0xdac4abaa, 0xadcad5ac, 0xf4aecae4, 0x9b02afba, 0xb16b0fb0, 
+0x26b21b1c, 0x4b2fb2bb, 0xb3eb38b3, 0x4db49b44, 0x7b54b51b, 0xb5bb5ab5, 0x5fb5eb5d, 0x5b63b61b, 
+0xb66b66b6, 0x65b65b66, 0x4b64b65b, 0xb63b64b6, 0x5db5fb61, 0x4b57b5ab, 0xb4fb52b5, 0x43b48b4c, 
+0x7b3bb3fb, 0xb2fb33b3, 0x23b27b2c, 0x4b19b1eb, 0xb08b0eb1, 0xf6afcb02, 0x4aeaaf0a, 0xad8adfae, 
+0xc2ac9ad1, 0xdab4abaa, 0xa9faa7aa, 0x89a91a98, 0x3a7ba82a, 0xa62a6aa7, 0x4ba53a5a, 0x1a3aa43a, 
+0xa21a29a3, 0x09a11a19, 0x09f9a01a, 0x9de9e79f, 0xc39cb9d4, 0x99b29ba9, 0x9969a09a, 0x7a98398d, 
+0x19699729, 0x95195a96, 0x37940949, 0xd92692f9, 0x90b91491, 0xf28fa903, 0xa8e28ea8, 0x8cb8d28d, 
+0xb68bd8c4, 0xf8a78ae8, 0x89089889, 0x7a882889, 0x786d8738, 0x85c86186, 0x4c852857, 0x983f8468, 
+0x82d83383, 0x1e823827, 0x081581a8, 0x80680b81, 0xfb7fe802, 0xf7f37f77, 0x7e77eb7e, 0xdd7e07e4, 
+0x27d57d97, 0x7cc7cf7d, 0xc37c67c9, 0xd7be7c17, 0x7bb7bc7b, 0xb57b77b9, 0xf7b17b37, 0x7ab7ad7a, 
+0xa97a97aa, 0x77a87a87, 0x7a77a77a, 0xa67a67a7, 0x47a57a67, 0x7a37a37a, 0xa67a57a3, 0x97a87a77, 
+0x7ab7aa7a, 0xad7ac7ac, 0xf7ad7ad7, 0x7b27b07a, 0xb47b47b3, 0x87b67b57, 0x7bb7b97b, 0xbe7bd7bc, 
+0x27c17bf7, 0x7c57c47c, 0xc97c87c6, 0xd7cc7ca7, 0x7d17cf7c, 0xd67d57d3, 0xb7da7d87, 0x7df7dd7d, 
+0xe57e47e1, 0x97e87e77, 0x7ed7eb7e, 0xf37f17ef, 0x97f77f57, 0x7fc7fb7f, 0x018007fe, 0x68048028, 
+0x80980780, 0x0c80b80a, 0x080f80d8, 0x81381181, 0x15815814, 0x98188168, 0x81c81b81, 0x1d81d81c, 
+0x081f81e8, 0x82182082, 0x22821821, 0x38228228, 0x82482482, 0x25825825, 0x58258258, 0x82482482, 
+0x23824824, 0x18228238, 0x81f82082, 0x1c81d81e, 0x981a81b8, 0x81681781, 0x11813815, 0xc80e80f8, 
+0x80880a80, 0x03804806, 0xf8008028, 0x7fb7fd7f, 0xf47f67f8, 0xd7ef7f17, 0x7e87eb7e, 0xe17e37e6, 
+0x97db7de7, 0x7d47d67d, 0xcd7cf7d2, 0x57c87ca7, 0x7bf7c27c, 0xb77ba7bc, 0xf7b27b47, 0x7a97ac7a, 
+0xa17a47a7, 0xa79c79f7, 0x79579879, 0x8d790792, 0x578778a7, 0x78078278, 0x7977b77d, 0x17747767, 
+0x76d76f77, 0x6776976b, 0x17637657, 0x75d75f76, 0x5775975b, 0x37547557, 0x75075175, 0x4c74d74f, 
+0x974a74b7, 0x74874974, 0x47748748, 0x47457467, 0x74274374, 0x41741742, 0x07407417, 0x74073f74, 
+0x3f73f73f, 0x07407407, 0x74074074, 0x40740740, 0x17407407, 0x74274174, 0x43743742, 0x67457447, 
+0x74774674, 0x49748747, 0xc74b74a7, 0x74e74d74, 0x5375174f, 0x87567547, 0x75b75975, 0x5f75e75d, 
+0x37617607, 0x76576476, 0x6a768766, 0xd76b76a7, 0x77076e76, 0x75773771, 0x87777767, 0x77a77977, 
+0x7d77c77b, 0x278077f7, 0x78578478, 0x8a789787, 0xe78d78c7, 0x79178f78, 0x95793792, 0x87977967, 
+0x79a79979, 0x9d79c79b, 0x07a079f7, 0x7a37a27a, 0xa67a57a4, 0x97a87a77, 0x7ac7ab7a, 0xaf7ae7ad, 
+0x17b07af7, 0x7b37b17b, 0xb67b57b3, 0x97b87b77, 0x7bb7ba7b, 0xbf7be7bd, 0x37c17c07, 0x7c67c47c, 
+0xca7c97c8, 0xe7cd7cc7, 0x7d17cf7c, 0xd57d47d2, 0x97d87d67, 0x7dc7db7d, 0xe17df7dd, 0x57e37e27, 
+0x7e77e67e, 0xeb7e97e8, 0xf7ed7ec7, 0x7f27f07e, 0xf67f47f3, 0xa7f97f77, 0x7fd7fc7f, 0x028007ff, 
+0x68048038, 0x80980880, 0x0e80d80b, 0x381180f8, 0x81781581, 0x1b81a818, 0x081f81d8, 0x82382282, 
+0x27826825, 0xc82a8298, 0x82f82d82, 0x34832831, 0x98378358, 0x83c83a83, 0x3f83e83d, 0x48438418, 
+0x84784584, 0x4b849848, 0xf84d84c8, 0x85185084, 0x56854853, 0xb8598588, 0x85e85d85, 0x63861860, 
+0x88668658, 0x86b86986, 0x6f86e86c, 0x28718708, 0x87587487, 0x79878876, 0xc87b87a8, 0x87d87d87, 
+0x8187f87e, 0x48838828, 0x88788688, 0x8b889888, 0xd88c88b8, 0x88e88e88, 0x9089088f, 0x38928918, 
+0x89589489, 0x99898896, 0xd89b89a8, 0x89e89d89, 0xa18a08a0, 0x48a38a28, 0x8a68a58a, 0xa98a88a7, 
+0xb8aa8aa8, 0x8ac8ab8a, 0xae8ae8ad, 0xf8af8af8, 0x8b08af8a, 0xb18b18b1, 0x28b28b28, 0x8b48b38b, 
+0xb58b48b4, 0x58b58b58, 0x8b68b68b, 0xb78b78b6, 0x88b78b78, 0x8b88b88b, 0xb98b98b8, 0x98b98b98, 
+0x8b98b98b, 0xb98b98b9, 0x88b88b88, 0x8b78b78b, 0xb68b68b7, 0x58b58b68, 0x8b48b58b, 0xb28b38b4, 
+0x08b18b18, 0x8ae8af8b, 0xad8ad8ae, 0xa8ab8ac8, 0x8a88a98a, 0xa58a68a7, 0x28a38a48, 0x8a08a18a, 
+0x9d89e89f, 0xa89b89c8, 0x89789889, 0x93894896, 0xf8908928, 0x88d88e88, 0x8888a88b, 0x48858878, 
+0x88188288, 0x7d87e87f, 0x987a87b8, 0x87687787, 0x72873875, 0xd86e8708, 0x86a86b86, 0x66867869, 
+0x18638648, 0x85e86086, 0x5a85b85d, 0x68578588, 0x85385485, 0x4f851852, 0xb84d84e8, 0x84884a84, 
+0x44846847, 0xf8418438, 0x83c83e83, 0x3783983a, 0x38348368, 0x83083283, 0x2c82d82f, 0x882982b8, 
+0x82582682, 0x21822824, 0xd81e8208, 0x81a81b81, 0x15817818, 0x28138148, 0x80f81081, 0x0b80d80e, 
+0x880980a8, 0x80580780, 0x02803804, 0xe7ff8008, 0x7fb7fc7f, 0xf77f87f9, 0x37f47f67, 0x7f17f27f, 
+0xed7ee7ef, 0xa7eb7ec7, 0x7e77e87e, 0xe47e57e6, 0x17e27e37, 0x7df7e07e, 0xdc7dd7de, 0xa7da7db7, 
+0x7d87d87d, 0xd57d67d7, 0x27d37d47, 0x7d07d17d, 0xce7cf7d0, 0xc7cd7cd7, 0x7ca7cb7c, 0xc77c87c9, 
+0x57c67c77, 0x7c47c47c, 0xc27c37c3, 0x17c17c27, 0x7c07c07c, 0xbe7bf7bf, 0xd7bd7be7, 0x7bc7bd7b, 
+0xbb7bc7bc, 0xb7bb7bb7, 0x7bb7bb7b, 0xba7bb7bb, 0xa7ba7ba7, 0x7ba7ba7b, 0xba7ba7ba, 0xa7ba7ba7, 
+0x7bb7bb7b, 0xbb7bb7bb, 0xb7bb7bb7, 0x7bc7bc7b, 0xbd7bc7bc, 0xd7bd7bd7, 0x7be7be7b, 0xbf7bf7be, 
+0x07bf7bf7, 0x7c17c07c, 0xc27c17c1, 0x37c37c27, 0x7c37c37c, 0xc47c47c4, 0x57c57c47, 0x7c67c67c, 
+0xc77c77c7, 0x87c87c87, 0x7c97c97c, 0xc97c97c9, 0xa7ca7ca7, 0x7cb7ca7c, 0xcb7cb7cb, 0xc7cb7cb7, 
+0x7cc7cc7c, 0xcd7cc7cc, 0xd7cd7cd7, 0x7ce7ce7c, 0xcf7cf7ce, 0xf7cf7cf7, 0x7d07d07c, 0xd17d17d0, 
+0x17d17d17, 0x7d27d17d, 0xd27d27d2, 0x27d27d27, 0x7d37d37d, 0xd37d37d3, 0x47d47d37, 0x7d47d47d, 
+0xd57d57d4, 0x67d67d57, 0x7d67d67d, 0xd77d77d7, 0x87d87d87, 0x7d87d87d, 0xd97d97d9, 0xa7da7d97, 
+0x7da7da7d, 0xdb7db7db, 0xb7db7db7, 0x7dc7dc7d, 0xdc7dc7dc, 0xc7dc7dc7, 0x7dd7dc7d, 0xdd7dd7dd, 
+0xd7dd7dd7, 0x7dd7dd7d, 0xdd7dd7dd, 0xe7de7de7, 0x7de7de7d, 0xde7de7de, 0xf7df7df7, 0x7df7df7d, 
+0xdf7df7df, 0x07df7e07, 0x7e07e07e, 0xe07e07e0, 0x17e17e17, 0x7e27e17e, 0xe27e27e2, 0x37e37e37, 
+0x7e37e37e, 0xe47e47e3, 0x57e47e47, 0x7e57e57e, 0xe67e57e5, 0x67e67e67, 0x7e77e77e, 0xe87e77e7, 
+0x87e87e87, 0x7e87e87e, 0xe87e87e8, 0x97e97e97, 0x7ea7e97e, 0xea7ea7ea, 0xb7eb7ea7, 0x7eb7eb7e, 
+0xec7ec7eb, 0xc7ec7ec7, 0x7ec7ec7e, 0xed7ec7ec, 0xd7ed7ed7, 0x7ed7ed7e, 0xed7ed7ed, 0xe7ed7ed7, 
+0x7ee7ee7e, 0xee7ee7ee, 0xe7ee7ee7, 0x7ee7ee7e, 0xef7ef7ee, 0xf7ef7ef7, 0x7ef7ef7e, 0xef7ef7ef, 
+0xf7ef7ef7, 0x7f07ef7e, 0xf07f07f0, 0x07f07f07, 0x7f07f07f, 0xf07f07f0, 0x07f07f07, 0x7f07f07f, 
+0xf07f07f0, 0xf7ef7ef7, 0x7ef7ef7e, 0xef7ef7ef, 0xf7ef7ef7, 0x7ee7ef7e, 0xee7ee7ee, 0xe7ee7ee7, 
+0x7ed7ee7e, 0xed7ed7ed, 0xd7ed7ed7, 0x7ec7ed7e, 0xec7ec7ec, 0xc7ec7ec7, 0x7eb7eb7e, 0xeb7eb7eb, 
+0xa7eb7eb7, 0x7ea7ea7e, 0xea7ea7ea, 0x97e97ea7, 0x7e97e97e, 0xe97e97e9, 0x87e87e97, 0x7e87e87e, 
+0xe87e87e8, 0x87e87e87, 0x7e77e77e, 0xe77e77e7, 0x77e77e77, 0x7e77e77e, 0xe67e67e7, 0x67e67e67, 
+0x7e67e67e, 0xe67e67e6, 0x67e67e67, 0x7e67e67e, 0xe57e57e6, 0x57e57e57, 0x7e57e57e, 0xe57e57e5, 
+0x57e57e57, 0x7e57e57e, 0xe57e57e5, 0x57e57e57, 0x7e57e57e, 0xe57e57e5, 0x57e57e57, 0x7e57e57e, 
+0xe57e57e5, 0x57e57e57, 0x7e57e57e, 0xe57e57e5, 0x57e57e57, 0x7e57e57e, 0xe57e57e5, 0x57e57e57, 
+0x7e67e57e, 0xe67e67e6, 0x67e67e67, 0x7e67e67e, 0xe67e67e6, 0x67e67e67, 0x7e67e67e, 0xe77e77e6, 
+0x77e77e77, 0x7e77e77e, 0xe77e77e7, 0x77e77e77, 0x7e87e87e, 0xe87e87e8, 0x87e87e87, 0x7e87e87e, 
+0xe97e97e8, 0x97e97e97, 0x7e97e97e, 0xe97e97e9, 0xa7ea7ea7, 0x7ea7ea7e, 0xea7ea7ea, 0xb7ea7ea7, 
+0x7eb7eb7e, 0xeb7eb7eb, 0xc7eb7eb7, 0x7ec7ec7e, 0xec7ec7ec, 0xd7ec7ec7, 0x7ed7ed7e, 0xed7ed7ed, 
+0xe7ed7ed7, 0x7ee7ee7e, 0xee7ee7ee, 0xf7ee7ee7, 0x7ef7ef7e, 0xef7ef7ef, 0x07f07ef7, 0x7f07f07f, 
+0xf07f07f0, 0x17f17f17, 0x7f17f17f, 0xf17f17f1, 0x27f27f27, 0x7f27f27f, 0xf37f27f2, 0x37f37f37, 
+0x7f37f37f, 0xf47f37f3, 0x47f47f47, 0x7f47f47f, 0xf57f47f4, 0x57f57f57, 0x7f57f57f, 0xf67f57f5, 
+0x67f67f67, 0x7f67f67f, 0xf67f67f6, 0x77f77f77, 0x7f77f77f, 0xf77f77f7, 0x87f87f77, 0x7f87f87f, 
+0xf87f87f8, 0x97f87f87, 0x7f97f97f, 0xf97f97f9, 0x97f97f97, 0x7fa7f97f, 0xfa7fa7fa, 0xa7fa7fa7, 
+0x7fa7fa7f, 0xfb7fb7fb, 0xb7fb7fb7, 0x7fb7fb7f, 0xfb7fb7fb, 0xc7fc7fc7, 0x7fc7fc7f, 0xfc7fc7fc, 
+0xd7fc7fc7, 0x7fd7fd7f, 0xfd7fd7fd, 0xd7fd7fd7, 0x7fd7fd7f, 0xfe7fe7fe, 0xe7fe7fe7, 0x7fe7fe7f, 
+0xfe7fe7fe, 0xf7ff7ff7, 0x7ff7ff7f, 0xff7ff7ff, 0xf7ff7ff7, 0x8007ff7f
+};
+
+const uint32_t snare_packed[1350] = {
+0x728007fb, 0x26cf6cf7, 0x70e73071, 0x3f70e6e5, 0x96806e37, 0x68368466, 0x5a691697, 0xd6906b46, 
+0x8066ef5e, 0xe16166ee, 0x6ac79f27, 0x86e8c5a0, 0x208ab896, 0xc9ef98f9, 0x9c899ca4, 0xbb997a6e, 
+0x7ba6a4c8, 0x814a43bd, 0x84a728f7, 0x58a9982a, 0xa5fa9d97, 0xbc86793e, 0x59849438, 0x9689c99c, 
+0x8e8848d0, 0x39368f08, 0x97f9208e, 0x5085c91e, 0x69288fb8, 0x8a38228b, 0x848eb922, 0xa76d7b78, 
+0x7f48b485, 0xff6eb727, 0x36a06c66, 0x62368f6a, 0x2b5da5b9, 0xc5b06196, 0x53c5ad57, 0xd4523508, 
+0x84fa4a24, 0x3b643350, 0xf24c03f8, 0x14914bf4, 0x5005374b, 0xb557752f, 0xc5705e65, 0x5d853851, 
+0x6e656644, 0xe6c76c46, 0x77a70d6c, 0x6877d7aa, 0xe75975a7, 0x7ab79d77, 0x6b80f7de, 0xd8b388b8, 
+0x8bc8a48d, 0x4a9118ff, 0xe99896b9, 0xa2e9f19d, 0x5db4aab7, 0x4b2ab09b, 0xb56b1eb2, 0x16bd5b84, 
+0x3b39bd1c, 0xa9ca90ad, 0x21aedaa8, 0x5b3db42b, 0xadaaecb1, 0xdfa34ab5, 0x1a3d9ed9, 0x9849f6a4, 
+0x3395895a, 0x78e490d9, 0x85681a87, 0x90802865, 0x272073a7, 0x7456ef6f, 0x02773783, 0xb6c36b57, 
+0x6426836c, 0xb95e5626, 0x95ec5c15, 0x60360f60, 0x4863560d, 0x36006406, 0x5e25ca5c, 0xdc5a35c3, 
+0x95ff6045, 0x6275ed5f, 0x8164864a, 0xd6b36b16, 0x64265068, 0x8367567d, 0x370d6f56, 0x75973671, 
+0x9e76a745, 0x27607657, 0x8167a077, 0x6887c880, 0x489a87a8, 0x8b98c88a, 0xe08a58a8, 0xe92394a8, 
+0x91693f93, 0x52914913, 0x79be99a9, 0x8d496f9e, 0x3d9ca920, 0x9a08a3da, 0x9359419c, 0xdf9cb9d2, 
+0xc9daa1f9, 0x9f99989a, 0xfba14a44, 0x592a9629, 0x92e90295, 0x50973995, 0x58c79129, 0x83287a8c, 
+0x277e87f7, 0xd7707c78, 0x76278e79, 0x1a768745, 0x262265d7, 0x65268664, 0x5a66e61a, 0xa6426216, 
+0x5ea5ca60, 0x2763b602, 0x56095ff6, 0x6976c562, 0x6c601606, 0xc6526966, 0x68168c68, 0xe2693677, 
+0x27777396, 0x6fe73277, 0x6870f6f5, 0xf76f77d7, 0x75f73073, 0x287d57b3, 0x17d78548, 0x85a7b074, 
+0xd081a85a, 0x987e84e7, 0x8d28d189, 0xfb8a28a6, 0x98bd8c58, 0x92e8ee8d, 0x0e8d98e4, 0x497993e9, 
+0x95794496, 0x5d943945, 0xe9709789, 0x9a999a95, 0xed9dd9d8, 0x69c99f89, 0x97996e98, 0x8492c966, 
+0x490494f9, 0x8bb89593, 0xda8d18c9, 0xd8d086b8, 0x88581a8e, 0x497fa884, 0x67ac7f98, 0x74e80484, 
+0xcb7e67c7, 0xe79f7877, 0x7827937b, 0xb66d6734, 0x66ea6a66, 0x72b71a73, 0xdf718732, 0xa6ac6bf6, 
+0x6f268b69, 0xe961f671, 0x869a6e36, 0x69b6c76b, 0xff6e96dd, 0xb7527026, 0x7186c775, 0x9d7a5757, 
+0xe7847487, 0x7a573277, 0xd375f79c, 0x37f27ce7, 0x8027e97e, 0x0f7e17b2, 0x98107c08, 0x8a388888, 
+0x70887859, 0x58e288e8, 0x92190a8a, 0x018d78d6, 0xf8fc8e49, 0x8b587289, 0xe69158e2, 0x78bb8bf8, 
+0x8f59088b, 0x809558e7, 0x197499d9, 0x9619969d, 0x6497894e, 0xf8eb8fb9, 0x8b79328e, 0xf58ad85c, 
+0x08c38d68, 0x90c8f18b, 0xaa8df93f, 0xa85d8a68, 0x83e7ff82, 0xcf80f80c, 0x87ce7be7, 0x81b80b7a, 
+0xaf7c17ec, 0xa7917af7, 0x74d76675, 0x4477c719, 0x77687247, 0x7ad75872, 0xc3759799, 0xb6ae6d76, 
+0x69c6ea69, 0x71682674, 0xb7066c86, 0x63b6a06f, 0xf36ba65e, 0x86a16a46, 0x6c86fc6b, 0x98735745, 
+0xa6ec6ce6, 0x7a07356e, 0x72770777, 0xc7b179e7, 0x7e77fa7f, 0x3a87980e, 0x386b8428, 0x88088284, 
+0xae8aa89c, 0xa8fb88a8, 0x90d93893, 0xea921918, 0x18da8b38, 0x96f95193, 0x5892f94a, 0xc91a9479, 
+0x98c93b97, 0xe08a096f, 0x190e9058, 0x92990990, 0x2e8f48ed, 0xf8b38b29, 0x8d88a28c, 0x988b38b0, 
+0x48518b28, 0x82287782, 0x6f816826, 0x57f68858, 0x83a85d81, 0xf67ce81b, 0xb8418507, 0x7ed83884, 
+0x867d67fc, 0x67a97d87, 0x78676778, 0x6579479b, 0x16fc6bc7, 0x6da68c6d, 0xa06db724, 0x369f6ce6, 
+0x6ed6b56b, 0xb16dd6fc, 0x96e56606, 0x72371272, 0x53758754, 0x87867b77, 0x73c6fe71, 0x0177f783, 
+0x671d7257, 0x7857de75, 0xae7897be, 0x97b78007, 0x84982e7a, 0x1681f81e, 0x98b188c8, 0x85080d82, 
+0x9f8ae85f, 0xe8788a08, 0x9098af86, 0xe48518be, 0x68ff9138, 0x8e58e48e, 0xef8af8a3, 0x897e9458, 
+0x8d68818f, 0x5691f905, 0x48ce9199, 0x91b8fb8b, 0x678e6930, 0x18ae8808, 0x8498968c, 0x0686b89d, 
+0x585786d8, 0x82885384, 0x0f8517e4, 0x783f7e08, 0x7e07d67f, 0x1a7fa7f9, 0x97c67d88, 0x7a97af7c, 
+0xe77e47ca, 0xb7d17f67, 0x7537c07d, 0x7d762718, 0xd7727557, 0x71f70170, 0x0b7446fe, 0x56a76a87, 
+0x6a96c46e, 0x8c69766a, 0xf7116c96, 0x6d96e96d, 0xad6dd721, 0xd7496a16, 0x74071d74, 0x5c767761, 
+0x074b76c7, 0x7ba7867a, 0xbd7a37ae, 0xf7f37f07, 0x81889782, 0x5b847801, 0x18698748, 0x88a8fb8c, 
+0xba8d28a8, 0x289e87e8, 0x93a8fb8c, 0xf28b38bf, 0x28f990e8, 0x8ef9238e, 0x5b96f8f8, 0xa8ce9319, 
+0x8fb8bd89, 0xe48918c1, 0x28968c48, 0x88e89587, 0x2f86e8b8, 0xd8798b68, 0x82f83c86, 0x2780684b, 
+0x28898548, 0x80185c8a, 0x2281580b, 0x281d86b8, 0x7b57947e, 0xc77797d0, 0x17b67ac7, 0x7957d67e, 
+0x55768766, 0xe6f37387, 0x76679872, 0x2e745730, 0xe71a71c7, 0x74f76073, 0x3d736734, 0x972a7067, 
+0x70772873, 0x417366f6, 0x37367427, 0x73b76779, 0xc3768746, 0xe7a77d67, 0x7ea7b276, 0xc978b7d5, 
+0x780d8257, 0x7ce81a7c, 0x4e825785, 0x38068338, 0x86487b80, 0x2f8067f9, 0x28598678, 0x86483284, 
+0x02874834, 0x18308c59, 0x87e8ac84, 0xf08ad88a, 0xb8d98f38, 0x8bb8e88f, 0x978f58c2, 0x58838698, 
+0x85687f85, 0x5689285f, 0x38d38b88, 0x7ee83a87, 0x4b8157fd, 0xa7ff8588, 0x8c88d484, 0xfd7e5834, 
+0x083f7fc7, 0x84283e84, 0x5580b7ee, 0x97b38448, 0x7bb75e75, 0xa17557ba, 0xa7377a27, 0x79a7156f, 
+0xd87a87a0, 0x177177b7, 0x72376279, 0x927bd752, 0xd7587507, 0x72c78577, 0x7775a6ea, 0x97857587, 
+0x7ea7ab78, 0xca7657b8, 0xb7b37ca7, 0x7f67e07b, 0xb87a07a2, 0xd79c7967, 0x77a7a77e, 0xdd7ce7c9, 
+0x08047ec7, 0x81c7ea80, 0x0f815805, 0xe8178488, 0x84c7ea7a, 0x93862885, 0xd82f8368, 0x8c686c81, 
+0x5089a88d, 0x886a8648, 0x8a789288, 0xe98b588b, 0x08028418, 0x87e8d887, 0x5d82680d, 0x281d83e8, 
+0x88486f85, 0x0c827874, 0x984c83e8, 0x7f983283, 0x028197e9, 0x18077d48, 0x7e97e581, 0xce81781e, 
+0xc8067d97, 0x82c84b7f, 0xa27a97c8, 0xc7d57ee7, 0x7d57c47e, 0xc07b77f9, 0x27df7d77, 0x7e17bc7d, 
+0xbb7fb7ff, 0xe79377e7, 0x7bf76d74, 0x7d7ba7dd, 0x77b07987, 0x7be7c179, 0x57739782, 0xe7937b47, 
+0x78877876, 0x937c779a, 0x67957b27, 0x7c27fd7c, 0xbe7f37f7, 0xc7f17d67, 0x7f982381, 0x5d854846, 
+0xd81383e8, 0x87885280, 0x77867867, 0xe7fc8258, 0x86681f80, 0x8283081f, 0x17bc8488, 0x82c88381, 
+0x0981a7f1, 0x38478478, 0x79c80880, 0x2c8037b9, 0x77e18468, 0x7e780d7f, 0x4d8277ec, 0xc8298208, 
+0x8257e77d, 0x4788e843, 0x78088278, 0x84186580, 0x7583783e, 0x08228558, 0x81b7c27f, 0x43801807, 
+0x67ea8618, 0x8647c677, 0xbc78a7e0, 0xc7a87ca7, 0x8077d678, 0xf17fe815, 0x77e77dc7, 0x7cc7b37e, 
+0x137fe7d8, 0x48157b48, 0x7cf7d482, 0x1281d801, 0x87cb81d8, 0x7ec7f87d, 0xb27ea7ef, 0xd8097cc7, 
+0x7b37b57c, 0xc87c37a9, 0x97d67a87, 0x7d27b97d, 0xea7fb7f8, 0x87b87e27, 0x7d37c178, 0xd68297e7, 
+0xf7ae7b67, 0x85e8307b, 0x1a7dd7d4, 0xa8618398, 0x7c87ff84, 0xda7d5820, 0x681483e7, 0x7f58077f, 
+0xcf81182a, 0xf80b8197, 0x79e7f37f, 0xdd7d87aa, 0xb7c37bb7, 0x8558017c, 0xbc7b380d, 0xf7fb7d97, 
+0x7bc7d281, 0x117f47ee, 0xc7fe7db8, 0x80480783, 0x0b82e802, 0x48458038, 0x82381d84, 0x37843827, 
+0x48218218, 0x7d07f281, 0x6884e844, 0x883383b8, 0x84385485, 0x3484a835, 0xa85e8848, 0x8337e880, 
+0x2a7d882c, 0x984585e8, 0x7c47dc7f, 0xe37ef7c5, 0x37ee8077, 0x80c7ce7a, 0xec7ad7e1, 0xc7f67fc7, 
+0x7c67997b, 0xb67ce7ba, 0x67cb7e97, 0x7ae7a07a, 0xf77ed807, 0x180a7fe7, 0x8067ce7e, 0x287e57e8, 
+0xc7db8228, 0x7dc7ef7b, 0xa37c87d9, 0x97c17c47, 0x7f780980, 0x4b81580b, 0x27f28198, 0x7d77ca7d, 
+0x3d83f7ce, 0xe7b27e48, 0x7e87e57c, 0xf07c67eb, 0xb8018027, 0x80b83981, 0xfe7ed7de, 0xf8058077, 
+0x7c47cc80, 0xe9820818, 0x07ec7b57, 0x88786484, 0x077d9837, 0x08198428, 0x8097d97b, 0xbe821832, 
+0x28548087, 0x7d87f285, 0x26825817, 0xa81a7ee8, 0x7cc7df83, 0x1984980f, 0xd82f7d18, 0x83881386, 
+0x0f80e850, 0x77eb81c8, 0x84f82d7f, 0xd07e6837, 0xe8077de7, 0x7817dc82, 0xd38137de, 0x57ea7a27, 
+0x7ed7f880, 0xc27ea7f0, 0x47d37d37, 0x7c37c07e, 0x3780e803, 0xb7ba82f8, 0x7f38017c, 0xba7b77f0, 
+0xb80380b7, 0x8017b87a, 0xee811810, 0x38057e37, 0x82b7d17d, 0xcf7ea80f, 0xc82c7ec7, 0x80680781, 
+0x377e6804, 0xd81385f8, 0x7fe81580, 0x528007ee, 0x08018458, 0x82a82b82, 0x0b7c27ec, 0xa7e17ee8, 
+0x7ac7d97f, 0xf27df7a1, 0x87ff7e67, 0x7c27ca7f, 0xaa7c87e0, 0x382d8027, 0x82f82984, 0xb07d4827, 
+0xe8388087, 0x7a77d57d, 0xcf7d77c8, 0x580f7f67, 0x8187bb7e, 0x027e881a, 0x58007de8, 0x7d97f584, 
+0x057ef7f3, 0x881e7f58, 0x81a81b84, 0xfa834845, 0xf8448167, 0x82388087, 0x768727f1, 0x281c81f8, 
+0x83684481, 0x0d80c817, 0x480d7d98, 0x81284087, 0xed7f3801, 0x68348357, 0x7cf7af7d, 0xbf7bf7fb, 
+0x08137ee7, 0x7cb7f181, 0x048047cb, 0x97b37e68, 0x7d67d579, 0xf780e7dc, 0x68027ed7, 0x7f57ec7f, 
+0xd47b37be, 0x27f98077, 0x7f17d87e, 0xe87f7823, 0xd81a8107, 0x7e37cf7f, 0x7181580a, 0x881784d8, 
+0x8177ff7e, 0x8d7c87f4, 0xe7c97b87, 0x8178107e, 0xe37da803, 0x07f180a7, 0x7c27dd7e, 0xc07da7d8, 
+0x87a17b57, 0x86b8227c, 0xdc808867, 0x97f87fc7, 0x8097f37f, 0x31821817, 0x97fa7fb8, 0x82285584, 
+0x077fb81d, 0x683f8538, 0x8267ee80, 0x3a80b82e, 0x384e82b8, 0x82682883, 0x2486883b, 0x88127ea8, 
+0x7d57f583, 0x178107ba, 0xf8147f38, 0x82581d80, 0x037fc81d, 0x682484d8, 0x82f82f80, 0xee7ff813, 
+0x18197f27, 0x81784e82, 0xc484882d, 0x282a7cb7, 0x7d97bc80, 0x9f7c27f6, 0x47de7d57, 0x7f87e47b, 
+0xba7f27e2, 0x48037ec7, 0x7c57d97e, 0xab7a47da, 0xf7f07ee7, 0x7d27f67f, 0xca81080e, 0x87d37a97, 
+0x7de7b67c, 0xc38047f0, 0xe8217cd7, 0x7f781c83, 0x0d81380d, 0x98078068, 0x7f47fc7f, 0xc87f47ef, 
+0x07fa7c97, 0x7ad7ac80, 0xc07e1801, 0x17c37c47, 0x80b7fa80, 0x18827826, 0x982081c8, 0x80482980, 
+0x2180e801, 0x787284d8, 0x89489388, 0x808888a3, 0x384b8798, 0x88987486, 0x20822858, 0x68318138, 
+0x80081485, 0xfe80d819, 0xc7da8017, 0x7f581b7d, 0x0a809809, 0x57f58148, 0x7ea7fd80, 0xe27cd7b1, 
+0xf7f678f7, 0x7b37cb81, 0xbb7a9794, 0xb7997907, 0x7cc7b67b, 0xec7f37d4, 0xd7d87de7, 0x7c17bf7c, 
+0xc27bd7eb, 0x47cc7b67, 0x7e07ff82, 0x198147ff, 0x18198248, 0x81d80981, 0x047fb819, 0xb82b80b8, 
+0x7e080682, 0x51842800, 0x97f38478, 0x7ce8097f, 0x037f77de, 0xb83180a8, 0x81480982, 0xdb7eb7f8, 
+0x87f27d07, 0x7fd84c81, 0x2e8377e3, 0x97fa7fc8, 0x83784382, 0x2d83a834, 0x28388398, 0x7de81a83, 
+0x478287ea, 0x882e8678, 0x86182d7f, 0x277f881a, 0x68398228, 0x81283183, 0x157fc7f3, 0x281e8238, 
+0x8157fb81, 0x17817808, 0xf8148058, 0x7ec81881, 0xdf7d57fc, 0x881380a7, 0x7ed7d77f, 0xbf7df7f5, 
+0x37e57ec7, 0x7a87c37e, 0xe77da7e6, 0xb7ea8107, 0x7f87de7b, 0xbc7be7e1, 0x97ce7e17, 0x7be7d87c, 
+0x0e7de7ab, 0x77dc7f78, 0x7fa7e37d, 0xef7ec802, 0x28147f77, 0x82080781, 0x3084a838, 0xb84681a8, 
+0x83c80682, 0x02817845, 0x080e82e8, 0x81b82f81, 0xeb7f1809, 0xc82b80d7, 0x80e7e880, 0xf9819830, 
+0xf81e7fb7, 0x8407fc7e, 0x3783183e, 0x28128158, 0x81c81781, 0xe981c804, 0xc7d77cc7, 0x81a81e7d, 
+0x197f77db, 0x482d81e8, 0x81081183, 0x3a81082b, 0xc80c83d8, 0x7f581782, 0x4b852845, 0x181182c8, 
+0x81880480, 0x0f7fb7d7, 0x982681e8, 0x7fd80b80, 0x058117e9, 0xe80b7e88, 0x80082080, 0xfe7f97fd, 
+0x47e58037, 0x8067f17f, 0xee7db808, 0xe7e57f97, 0x7da7a37b, 0x0681c80f, 0x981c80d8, 0x7ee81e81, 
+0x037ff7e0, 0xc7f27f08, 0x8067fa7f, 0xf980f806, 0x57d27e37, 0x7ed80f7f, 0xcb7f4804, 0x47e87c47, 
+0x7ea7e07e, 0x9a77878c, 0x97dd7bf7, 0x7b07a37b, 0xbc7ca7cc, 0xe7f87c47, 0x81a8047f, 0x1f815808, 
+0x082583b8, 0x85282b80, 0x29831840, 0x98067fe8, 0x81f84683, 0x3a829833, 0x68348678, 0x84083282, 
+0x1684084e, 0x18478488, 0x84782e81, 0x21860861, 0x784f8268, 0x84184684, 0x1782e846, 0xe7eb7eb8, 
+0x7f583f83, 0x0e8187ea, 0x58288138, 0x82d7fc80, 0x027fc825, 0xe82b80b8, 0x7ee7f380, 0x017f87e9, 
+0x57ab7ea8, 0x7c57af7a, 0xbe7c07b8, 0xa7d57c77, 0x80280c7c, 0xf48087fa, 0x08087fd7, 0x7d07d17e, 
+0xd17e07ca, 0x57ef7d17, 0x7dc7ea80, 0xf18007de, 0x27e47d37, 0x7ea7fd7f, 0x08819807, 0x98157e28, 
+0x80d81083, 0x1f8067fc, 0x58158388, 0x7c37f07f, 0x007f87d4, 0x58017f18, 0x7de7fc81, 0xf17fb800, 
+0xa81980e7, 0x84c83383, 0x11823831, 0xb8388138, 0x8017ea7f, 0x2a8147f6, 0xa8138098, 0x80481e82, 
+0x4083d833, 0x48058208, 0x84383383, 0x17826848, 0xb8087fc8, 0x86684d83, 0x287fa820, 0x180181e8, 
+0x81d81180, 0xfd7f580d, 0x481a80b7, 0x7fa80282, 0x11815814, 0x67f68148, 0x7e780b7f, 0xcf7d37d8, 
+0x47df7d57, 0x7e07e67d, 0x1882b7e6, 0xe7ea7e98, 0x7fd7e17c, 0xe07f4808, 0xf7de7e77, 0x7d07c97e, 
+0xd77d87ce, 0x67dd7c57, 0x7bc7ad7c, 0xc47de7d0, 0xd80e7d57, 0x7d87cd7e, 0xf1810805, 0x97d77d77, 
+0x7f280f80, 0xed7fe7fa, 0x28188017, 0x7f47ea7e, 0x1f820806, 0x981882d8, 0x82c80580, 0x1c815824, 
+0x88458368, 0x82e85685, 0x7784384a, 0x380d8668, 0x80b80981, 0xf681a81b, 0xc82b8037, 0x83d81a81, 
+0x2783484e, 0x183282f8, 0x7f681583, 0x017ed7e0, 0x58108018, 0x81a82981, 0xff82a82c, 0xf82e8237, 
+0x7f37e17f, 0xf580a809, 0x381980b7, 0x7f280980, 0xf380a7f1, 0xa8187f67, 0x7d87f681, 0xeb8067fa, 
+0x17f77ee7, 0x7e37d77f, 0xe27e17df, 0x27dd7cf7, 0x7ea7fa7e, 0xf08007e9, 0xd7d07e27, 0x7df7e97c, 
+0xa579e7bf, 0x87ee7e07, 0x7cf7bb7d, 0xe57d87c7, 0xb7d17d47, 0x8168067d, 0xe97de7fb, 0x28198087, 
+0x80b80981, 0x1a7ea7e7, 0x57d07f18, 0x82a81e7d, 0x0e806812, 0x47fd8268, 0x83282080, 0x3382981d, 
+0x98318398, 0x82f83983, 0x39828833, 0x880082c8, 0x82082e7f, 0x1a81c80d, 0x78278128, 0x7ff81083, 
+0xf77e77ef, 0x681b8017, 0x81280781, 0xfd7f580b, 0x97fe8097, 0x84583b81, 0xea7e2814, 0x380b8037, 
+0x82783882, 0x0f821820, 0x08027fa8, 0x7ef7ff80, 0x278037ed, 0x07f68258, 0x8217f57f, 0xf77cf7fa, 
+0x47e17f77, 0x7c17e17d, 0xc77c47b2, 0xf7ca7c57, 0x7d47d87d, 0xcf7ed7ed, 0x77d17cf7, 0x7ce7dc7d, 
+0xe17dc7c5, 0x57d37c87, 0x7f17de7d, 0xdb7c77e2, 0x47ef7de7, 0x7f37e67f, 0x0f7ef7da, 0xa7ec8048, 
+0x7ea80e81, 0x037ee7fd, 0x982b8338, 0x82682c81, 0x1382d82c, 0xb8518338, 0x82c84684, 0x4e82e835, 
+0x585b86e8, 0x84983e84, 0x5284582f, 0x87f982b8, 0x81284b82, 0x2b82d811, 0xd82682f8, 0x82f82080, 
+0x0d7fd827, 0xd7f681b8, 0x80682381, 0xdf7da7f1, 0x18027e37, 0x7e07de80, 0xe47f07f0, 0x67dc7e27, 
+0x7da7eb7e, 0xd67e97e8, 0x67eb7e27, 0x7fe8047f, 0xda7da7f5, 0x27ee7ea7, 0x7fd7dd7f, 0xd17e7804, 
+0x47d97d37, 0x7c97e07e, 0xe17f9815, 0xa80d7f57, 0x7f37d67f, 0xe77d37c8, 0x67c57e57, 0x7d47e87d, 
+0xdf7e07e5, 0x67ea7e27, 0x7e37e17e, 0xee7e97e7, 0x97e87e77, 0x82682c80, 0x17817813, 0xc81d8118, 
+0x82883683, 0x24829826, 0xa82b82c8, 0x81282881, 0x0180d80d, 0x67f78008, 0x7ff81580, 0x1b82e80c, 
+0x883b81d8, 0x80380982, 0x008037f6, 0x87f880a8, 0x8147e97c, 0xf380d81c, 0x48138137, 0x80e81680, 
+0xfc80c820, 0xf81f8047, 0x80c80d82, 0x0282d82f, 0xc8237f68, 0x80480b82, 0x1781a805, 0x17fd7f38, 
+0x80780480, 0xd47fb7f8, 0xc80c7dd7, 0x7fa80d81, 0xd07dd7f3, 0x77d87d77, 0x7d17c77c, 0xe67dc7e0, 
+0x47ce7df7, 0x80c8097e, 0x087fa7dc, 0xa7fb7f38, 0x7cf7c57d, 0xe07dc7d9, 0xd7eb7e87, 0x7e27e17e, 
+0xee7e87ed, 0xd7de7dd7, 0x7ed7f87e, 0x017ee7ce, 0xa8118098, 0x81282a81, 0x1a828823, 0x08278108, 
+0x83481f84, 0x2581c822, 0x88088138, 0x81b81c7f, 0x1381280a, 0xe82381e8, 0x82280a80, 0x1381b82b, 
+0x07f67f68, 0x7e67f781, 0xf1806805, 0x480d7f57, 0x7df7f081, 0xe47f57ed, 0x77f97f87, 0x7ea7e87f, 
+0xed7f080d, 0x880c8037, 0x7fa7e67f, 0xd07e87f7, 0xe7e97c97, 0x7d37dc7e, 0xe97de7e3, 0xa7e97f47, 
+0x7f77fd7f, 0x1981f809, 0x78188048, 0x80b82f84, 0x177ef806, 0xb81982f8, 0x80481981, 0xe17dd7e6, 
+0xe7ee7ec7, 0x7f58017f, 0xdb7eb7fc, 0x67fe7f07, 0x7ef80180, 0xfe811804, 0x08068127, 0x8108187f, 
+0x0c8017f4, 0x58138078, 0x80b80b81, 0xf9807816, 0xf8258157, 0x7f97d47f, 0xfc81181d, 0xc80a7fd7, 
+0x7e07cd7f, 0xfe8017ff, 0x48078027, 0x7e67ed7f, 0x0a8017fc, 0x47e17fa8, 0x7d87b27c, 0xf87f67e5, 
+0xe7fa7e87, 0x7dd7fa7f, 0xfb7fc7d0, 0x37fa7ef7, 0x7f77e57f, 0x00800802, 0x48138098, 0x7fb7f880, 
+0x127fb7f6, 0x580d8198, 0x7d87f980, 0x088047e4, 0x17f68058, 0x7db7e87e, 0xf37f97e4, 0xa7fa7f47, 
+0x80380980, 0x2a82a815, 0x981981b8, 0x81c81581, 0x13828820, 0xd7fc7fd8, 0x82582480, 0xf57e8811, 
+0x981881b7, 0x7f97d77e, 0xf37fd812, 0xf7e68037, 0x7d77d27d, 0x067fe7f1, 0x47ef7fd8, 0x7f98027f, 
+0xf2802800, 0xb8027f67, 0x7e07dc7e, 0x007f57ed, 0x17fc7fd8, 0x80280180, 0x13813804, 0x97f280a8, 
+0x7fd8087f, 0x01811808, 0xb80e8068, 0x7e380181, 0x0280e800, 0xa80c7f18, 0x7f87f780, 0xe67f47f9, 
+0x97f37e67, 0x7ee80580, 0xf07eb7e2, 0x47fb7f47, 0x7f77df7f, 0x047fc7fd, 0xc7ee7e38, 0x7fb7f57f, 
+0xf87f07eb, 0x67f37fb7, 0x80e80c7f, 0x0a80780b, 0x87f97ea8, 0x81281080, 0x04802801, 0x080f8068, 
+0x82781782, 0x13820824, 0x081080f8, 0x7ff80881, 0xfa7fc80a, 0xb81e8157, 0x81f80d7f, 0x1c81780b, 
+0x17f68108, 0x80c81780, 0xe9803816, 0xe7f47ec7, 0x7e47f47f, 0x057ff7ee, 0xe7f27fe8, 0x7e77fa7f, 
+0xee7f07f4, 0x27ec7f97, 0x8027e87e, 0xee7e07f5, 0x77eb7f97, 0x7f67f17e, 0xdf7ec802, 0xd7fe7f27, 
+0x7fe8007f, 0x0c811803, 0x47e97ee8, 0x7e77f880, 0xed7f57ef, 0x27ef7e97, 0x7e87ed7f, 0xec7fb7f7, 
+0xe80c7f77, 0x80180d80, 0x057fc7ef, 0xd8008028, 0x82782080, 0x067f480d, 0x78138108, 0x7f580e81, 
+0xfd80d7f4, 0x180b7f77, 0x80581781, 0xfc7f67f2, 0x38068067, 0x8097fb7f, 0x0c80a802, 0x980f8098, 
+0x80a80c80, 0x138047fc, 0x480480e8, 0x80c80680, 0xf27f47f5, 0xa7f77ef7, 0x7e98017f, 0xd67dd7de, 
+0xb7fe7ea7, 0x7fd7fa7f, 0xff7f37f0, 0x57f87fd7, 0x7f67ef7e, 0xee7f37f8, 0x980b7fb7, 0x8127ff80, 
+0xfa7fa808, 0x280780e7, 0x7f480780, 0xf57f07f5, 0x58097ff7, 0x80f81881
+};
+
+const uint32_t hihat_packed[1011] = {
+0xa47d9805, 0x48148347, 0x82881781, 0xeb80a80c, 0xb8088137, 0x6a57f787, 0x7d8b77d3, 0x68348038, 
+0x8a375475, 0xda7dc86d, 0x28967f47, 0x8f666f7f, 0x217118c4, 0xf8bd8398, 0x93f73f6e, 0xdf67a8a1, 
+0xc7da90d7, 0x8577887f, 0xbc7e0820, 0xe7f78527, 0x8357e57e, 0xcd7ab81c, 0x07a39077, 0x849a1462, 
+0xd48a761d, 0x176562e9, 0x7358199b, 0xf591173b, 0xf84d7ca7, 0x7698437d, 0x7d8e372c, 0x17967c88, 
+0x7bf85e81, 0xb28de7dc, 0xf9027e66, 0x7f390371, 0x8a7fd6f3, 0x771d7189, 0x70494988, 0x6495a708, 
+0xb8ef65f8, 0x74540daf, 0xfd747b74, 0x19308f05, 0xa848116a, 0xd67b8462, 0xf62b741a, 0x3daa2c9d, 
+0x0cab8861, 0x990d6147, 0x59e6639d, 0x257e0c3c, 0x3a479fb4, 0xaf257164, 0x8d4e3958, 0x881eaaf7, 
+0xa318e74a, 0x1f77f616, 0xd75c7dd9, 0x6b37df8a, 0x348a28b4, 0xc92e7cc7, 0x98f63d79, 0x8073e85f, 
+0x083fa0c7, 0x92098249, 0x336978cc, 0x37ccb406, 0x97b99056, 0x5476d652, 0x67bd7c79, 0x6b77688e, 
+0x0b8db96d, 0xc8277397, 0x71b66c9c, 0x59823a27, 0xe7c399b6, 0x8bea0861, 0x74835633, 0xc7605c2a, 
+0x5e6899a0, 0x4f9d0801, 0x88908cd6, 0x81f6f982, 0x078d2855, 0x08f05ed8, 0x5628cc91, 0x0d91c952, 
+0xd7469476, 0x7ad8b584, 0x6a794831, 0x16708c38, 0x7d39ca7f, 0xb783063d, 0x05d6732a, 0x59ea1096, 
+0x22a277a9, 0x3a607da6, 0x92d66070, 0x876d5860, 0xc6719728, 0x8d394d73, 0xbe7a064d, 0xf70974e9, 
+0x73b8a08b, 0x007aa82e, 0xa6297c19, 0x6c56cba8, 0x2a735abd, 0xc8f79686, 0x9727256a, 0xc262a910, 
+0xb8d48c97, 0xa2b6c272, 0x246167d2, 0xd8458849, 0x9906dc73, 0x308e4798, 0x29d256b8, 0x8666278d, 
+0x3a6b09d3, 0xc8be8837, 0x8ee67880, 0x0e6b18fc, 0xe799a937, 0x98c8fc5d, 0x2a822633, 0xc7b8591a, 
+0x6606d8a8, 0x26892972, 0xd96a7607, 0xa3856081, 0xe162782a, 0xf71c7aa9, 0x6ee93282, 0x5382a7d3, 
+0xe7997fd8, 0x8648c280, 0x5d91359a, 0x470c6fd9, 0x7136fe9f, 0xc0925928, 0xfa7b6a56, 0x90b6327a, 
+0xc65e29a4, 0x88279817, 0x92d94d5e, 0xf284c5e8, 0xd5f58dc8, 0x7629937f, 0x0f8b274e, 0x087e75d8, 
+0x79c82d7c, 0x1e7289b6, 0xe8c695e6, 0x93976a76, 0xc572d750, 0x861e9358, 0x8449c779, 0x5795f5d5, 
+0x38285c69, 0x59f88a93, 0xee7e39a5, 0xc8e58836, 0x9ea78772, 0x6f8035e6, 0x164d83c9, 0x6b495886, 
+0xab8f57c5, 0xb88e7bc7, 0x72b99273, 0x609db649, 0x37c96ba8, 0x6c27249c, 0xe18d390e, 0xa90d7816, 
+0x7f57e97b, 0xd7714893, 0x37b18de7, 0x93380d7b, 0xe77c5676, 0xf7588b28, 0x7c288e73, 0xf890884d, 
+0xe9c97176, 0x8af7db6e, 0xda73983e, 0x88868397, 0x7e469a88, 0x6378f954, 0x17808d57, 0x77a89f7c, 
+0xe180585a, 0x86618be7, 0x7db8358a, 0x927f9853, 0x780483a7, 0x69a7f48a, 0xbd920876, 0x09d969b7, 
+0x8976a27c, 0x5f71b91f, 0x68598867, 0x7cb8b87a, 0x0b8b1698, 0xf70e78c9, 0x7e07c48b, 0x8d8b77dc, 
+0x482d7c27, 0x7e188b77, 0x5f7a1871, 0x87d39007, 0x89e8d16e, 0xc77aa71c, 0x06df8908, 0x7d692c7a, 
+0xf58c06de, 0xa85c6908, 0x8b47e780, 0xe7837722, 0xc86e8047, 0x8ab7727b, 0xec81979e, 0x67ce8b57, 
+0x83e91b67, 0x4066d8a6, 0x76fe9118, 0x8098df7d, 0xd58a96d0, 0x379d6f98, 0x71576b95, 0xd089f8dc, 
+0x291a7de6, 0x89a73b78, 0xb86e28d5, 0xe7dd8ef7, 0x88f7f478, 0x377d0788, 0x17ba81a8, 0x6a27f38a, 
+0x8d917881, 0x085b7327, 0x72580587, 0xbc8558bb, 0x391a82e6, 0x8e26e47a, 0xa56af898, 0xf6c48b68, 
+0x7a390280, 0xa98ae704, 0xf7a670d8, 0x7357dc8f, 0x6785f862, 0x28127fb7, 0x7657b788, 0x9d80c88e, 
+0x089682b7, 0x94f7e16f, 0x217bf70e, 0x67957429, 0x7ae8a983, 0x928a272b, 0xb7837238, 0x75f75996, 
+0x0e7e2911, 0x18b687c7, 0x8f278273, 0x8b6d0835, 0x67dc83f8, 0x7f28327e, 0xfc8f078a, 0x19167b06, 
+0x7e07e17a, 0x9c8537f9, 0xd7e48187, 0x7997f984, 0x6077f8b9, 0x982f8dc7, 0x88380c73, 0x886df854, 
+0x573285c8, 0x7897ee8a, 0xe783b845, 0x17ff7b67, 0x85c7a686, 0x877cb799, 0xa7c67b18, 0x7787e789, 
+0x23831811, 0x083c7bf8, 0x8937b57e, 0x896cc822, 0x873e8af8, 0x82486b7d, 0x937c57ce, 0x37467aa8, 
+0x72d7be92, 0x4787e889, 0x28b47c57, 0x85b75780, 0x0f7a4827, 0x280d8588, 0x85789d72, 0xbe7e874a, 
+0x17837b08, 0x87180683, 0xaf7f175a, 0xa7e47668, 0x7d182984, 0xb58a37b0, 0x68a57567, 0x7e278d83, 
+0x6288780d, 0x186c7f67, 0x7fb81a7c, 0x6a7917de, 0xf7688638, 0x7e08957d, 0x8283f768, 0x37c17828, 
+0x74981789, 0x9a88b82f, 0xc8cf7947, 0x8557687c, 0xab7f781b, 0x47c486c7, 0x8677f67d, 0x3a7677fb, 
+0x077886c8, 0x76588c7f, 0xed87b803, 0xe86e7607, 0x7e377284, 0x4f803870, 0x28718567, 0x8467dc77, 
+0xb0788852, 0xe8288877, 0x87a82a74, 0x487e2780, 0xe7708258, 0x75583d85, 0x9b8a481f, 0x48467a27, 
+0x7a379f85, 0x7a803896, 0xa87882e7, 0x88e7cd77, 0x7c74f804, 0x176383e8, 0x78b86c83, 0x1c8787bd, 
+0xd80d76e8, 0x7a17a089, 0x5b850860, 0x783d8197, 0x7de78a83, 0x107a7878, 0xf7d48508, 0x84c85b78, 
+0xb57ac7ac, 0xf7977ae8, 0x7c986b82, 0xff86978e, 0x57f77fe7, 0x7f174786, 0xa77f3882, 0xc8568337, 
+0x85882474, 0x6974e815, 0x77898498, 0x84483c7f, 0xfa816787, 0x07b88597, 0x7fe85e7c, 0x128207bd, 
+0xf8087eb8, 0x7d881d7d, 0x857a8875, 0x484c87a7, 0x8677e078, 0x5d7907fb, 0xf7718198, 0x7a085d83, 
+0x9d8967c4, 0xd80e7ef7, 0x7b67ca84, 0xf97fa849, 0x37ef8047, 0x74c81f82, 0x83838875, 0xf8688117, 
+0x85b79f7c, 0xde7a682f, 0x07cb8597, 0x7d18637e, 0x2c8547ac, 0x07e47a08, 0x7c97ae88, 0x0982e82b, 
+0x08437818, 0x7e97c583, 0xc279e86f, 0x480b8647, 0x8598097b, 0x147f979f, 0x37af8428, 0x79c86a7f, 
+0x168627d1, 0x981678d8, 0x7c97bf85, 0x81801866, 0x483c8417, 0x8577f67a, 0x2b7ad7e7, 0xb79d8538, 
+0x7a48817d, 0x198107fc, 0x77de7ef8, 0x84a7e881, 0x407b57d6, 0xe7e780a8, 0x7d779984, 0xa47ea876, 
+0x583283d7, 0x83d7ef7b, 0x1279d818, 0x97c384a8, 0x7f485d7d, 0x0d83279e, 0x97c88258, 0x79a8567e, 
+0x0e823811, 0xd82d7ce8, 0x84f77481, 0xe67a4843, 0x17ff8567, 0x83a82e7a, 0x257ed7b7, 0xd79b83a8, 
+0x7b684a80, 0xf98337f5, 0x48247cf7, 0x80a7eb80, 0xf27a5834, 0x981782a7, 0x8387de7e, 0xf48067de, 
+0x07c08337, 0x79784580, 0xe1843818, 0x57ff7d97, 0x7b781c82, 0xf18477fb, 0xd8247b87, 0x7e17bd83, 
+0xaa811840, 0x18348217, 0x8457ee7c, 0x4c7a87f9, 0x57c38048, 0x7df83881, 0x308347c0, 0xf8007b18, 
+0x8067c283, 0xe182f802, 0x78477d17, 0x83e7af7f, 0x067af823, 0xa7ee83c8, 0x7ee8597b, 0x278067cb, 
+0xc7b48178, 0x7e783880, 0x168267ce, 0xa81b7dc8, 0x8497a680, 0x0a7b781f, 0x281880b8, 0x8107e67f, 
+0x057e0811, 0xc8248058, 0x82c7cd7d, 0xe080d80f, 0x87f48037, 0x7fc8277f, 0x2d8097d8, 0x48147c28, 
+0x8017c682, 0xc27f6833, 0x48218287, 0x8307e97d, 0x0e7c880b, 0x180c8098, 0x83b7db80, 0x317d87df, 
+0x97f07e98, 0x7da7fb82, 0xfb832802, 0x981e7c37, 0x8007db81, 0xd97d3837, 0xd7fc8357, 0x7dd8257e, 
+0x028167e4, 0x180c80c8, 0x82d7e97e, 0x327ee7ec, 0x77d67e48, 0x7d881782, 0xf281d7fa, 0xf7fa7fa7, 
+0x7df80e80, 0xe181e7fe, 0xa8198137, 0x82c8017c, 0x227cb7f7, 0x67cf81e8, 0x7eb8397f, 0x048237d3, 
+0xd7fc7f68, 0x8047dc81, 0x107c6826, 0x77f580c8, 0x80b7f580, 0x017e780d, 0xc8058068, 0x8258087e, 
+0x2d7e87db, 0x57d78028, 0x7f382a80, 0x028317d2, 0x08187d48, 0x7ef7eb81, 0xda81b812, 0x88267f57, 
+0x8117e67f, 0xf58037fb, 0xf8188057, 0x81d7fb7d, 0x2d7eb7f1, 0x97e87e18, 0x7d781981, 0xee8237fa, 
+0x780c7ef7, 0x7f77d782, 0xd87f5826, 0xb81e81a7, 0x8297f87d, 0x1d7d67fb, 0x67d98168, 0x7ee8267f, 
+0xe98377e5, 0x88147e67, 0x7dc7f281, 0xde81981a, 0x78158057, 0x80a7fe7e, 0xf97dd817, 0xa8188107, 
+0x82b7f97d, 0x1a7ef7e3, 0x97d68118, 0x7e382180, 0xdb8327f1, 0x380f7fa7, 0x7fc80c7f, 0xee8107fa, 
+0x68178057, 0x7fc82b7c, 0x018077ee, 0x67e98148, 0x8158137f, 0x237f97d8, 0xd7d78018, 0x7ce81881, 
+0xe4816812, 0xe80f7fa7, 0x8017e180, 0xf57eb816, 0xe8168087, 0x8138077d, 0x1c7f57ec, 0x37e97fc8, 
+0x80a80e80, 0x088097df, 0xe7fe8058, 0x81d7f67f, 0x237df7f1, 0x57ee8038, 0x7ef80580, 0xe3807814, 
+0xe81380b7, 0x80c7f57e, 0x057e7810, 0x17f58088, 0x80680c80, 0x177fb7e9, 0x07ee7fd8, 0x7fa81380, 
+0xf482b7e4, 0xf81b7e67, 0x7fa7f17f, 0xe480c80c, 0x981480c7, 0x7fd8017e, 0x057f2810, 0xe7f37fd8, 
+0x7eb7f781, 0xee807813, 0x27fd8037, 0x7e37fb81, 0xf180d80f, 0x78157f87, 0x8007e280, 0xf17f9817, 
+0xc7fe8107, 0x80d7f97f, 0x1c7e3804, 0x87e68008, 0x7ed81b80, 0xff8187f3, 0xb80b7e97, 0x7f57eb81, 
+0xf37f7818, 0x17f880d7, 0x80d7fe80, 0x197e2802, 0xd7e78098, 0x80c8067f, 0x137f47f7, 0xa7e380a8, 
+0x7f181180, 0xfb8227f0, 0x481d7e47, 0x8007f37f, 0xec7f381a, 0x880f80f7, 0x8178017e, 0x098027e3, 
+0xe7e480f8, 0x80880b7f, 0x117e4804, 0x97f28038, 0x7f180b80, 0xfa8127fa, 0xf8167f37, 0x80c7e67f, 
+0xf37f880f, 0xb80b8117, 0x8167fb7e, 0x197e97fb, 0x67ed7fe8, 0x7f481680, 0x068127ee, 0x980e7eb8, 
+0x8067e480, 0xf1802808, 0xc7fc8147, 0x80e8067e, 0x0b7e9802, 0x67f18108, 0x7fe8147f, 0x0880a7f1, 
+0xd7f67f68, 0x7ec80680, 0xf9812804, 0x18157ee7, 0x80a7ee80, 0xf7802807, 0xb8038067, 0x7f68057f, 
+0x04807803, 0xf8087fb8, 0x80f7ed7f, 0xfc7fa805, 0x17fd8047, 0x7f280f80, 0xfa8147f9, 0xd80a7f27, 
+0x7fd7ef80, 0xf87f3815, 0x680a8077, 0x8137f67f, 0x097ff7f7, 0x18037f18, 0x7f880d80, 0xfa80d7f4, 
+0xf80a7fc7, 0x8057f67f, 0xfe7fd801, 0x87f980a7, 0x8018067f, 0xf5804803, 0x580a7fc7, 0x80480b7f, 
+0x058007f3, 0xc7f080b8, 0x7fb80c7f, 0xfe80c7fa, 0xe8077f67, 0x8077fd7f, 0x027fb7ff, 0xa8087fe8, 
+0x7fe7fd7f, 0xf17fd80b, 0x17fb8147, 0x80880a7f, 0x098027f2, 0x47fa7fb8, 0x7f380a80, 0xfc807800, 
+0x68097fb7, 0x8027f080, 0xf77fc80b, 0xe7fe80a7, 0x8057fc7f, 0x027f0808, 0xe8038018, 0x8018057f, 
+0x048067f5, 0x67fd7fc8, 0x8027fc80, 0x0c7ff7fd, 0xa7f77f78, 0x7ef80880, 0xf2808807, 0x18038037, 
+0x8067fe80, 0x047f3800, 0xb7fa80b8, 0x8028067f, 0x068047f8, 0x57fe7f88, 0x7f880480, 0xfe8087ff, 
+0x68067f87, 0x7ff7f580, 0xfa7fb809, 0x67fb80e7, 0x80680a7f, 0x0c8017f2, 0x47f97fa8, 0x7f480a80, 
+0xfb8077ff, 0xd8097fe7, 0x8017f97f, 0xf5801807, 0xb8048077, 0x8067fb7f, 0xff7f6805, 0x77fb80a7, 
+0x80480c7f, 0x0c7ff7f3, 0x87f87fb8, 0x7fc80080, 0xff8097fd, 0x28097f57, 0x8017f780, 0xfa7f980b, 
+0x38068027, 0x8057f380, 0xfe7fa805, 0x87fd8097, 0x7ff80b7f, 0x0a8027f7, 0xa7f97f98, 0x7f780080, 
+0xf9807805, 0x48067fb7, 0x7fe7f780, 0xf9800807, 0x58078047, 0x8068017f, 0x048067f8, 0xa8017f78, 
+0x7fd7f980, 0xfd7fe806, 0xe7fd8067, 0x7f98067f, 0x078027ff, 0x47fd7f98, 0x8007fd80, 0xff7f8808, 
+0xd7fc8067, 0x8068047f, 0x027ff7f8, 0xe7fb8068, 0x8008027f, 0x047ff7ff, 0x27fe7fd8, 0x7fd80180, 
+0x01805800, 0x18077f68, 0x8077fa80, 0xff7fb800, 0xa7ff8067, 0x8078027f, 0x097fa7fb, 0x57f97ff8, 
+0x7fb80280, 0xff802801, 0xf8047fe7, 0x8047fc7f, 0x038007ff, 0x08007fc8, 0x80180080, 0xff8017fe, 
+0xe8028017, 0x8047fe7f, 0xff7fd800, 0x97fd8077, 0x7fe8087f, 0x028037fb, 0x28007fc8, 0x7fe80080, 
+0xfc803802, 0x18008017, 0x7ff80080, 0x02800800, 0x28027fd8, 0x8007fd80, 0x027ff801, 0x07fd8008, 
+0x7ff80280, 0xfe8047ff, 0x38047fc7, 0x7ff7fb80, 0x007ff803, 0x28007ff8, 0x7ff7ff80, 0x00800801, 
+0x08008008, 0x80180080, 0x038017fd, 0x07fe7fe8, 0x7fd80480, 0xff8067fd, 0x28047fa7, 0x8007fb80, 
+0xff7fe803, 0xe8038007, 0x8027ff7f, 0x007fe800, 0xd7fb8058, 0x8008057f, 0x038047fa, 0x57ff7fb8, 
+0x7fb80080, 0xfc805801, 0xc8038007, 0x8037ff7f, 0x017fc801, 0xe8008018, 0x8028007f, 0x027ff7fe, 
+0x18007ff8, 0x7ff7ff80, 0xfa803802, 0xc8058007, 0x8027fe7f, 0xfe7ff801, 0xf8028007, 0x8017fd7f, 
+0xfe7fe801, 0xc8008037, 0x8028007f, 0xff7fe801, 0x17ff8017, 0x7fe80180, 0xff7fe803, 0x28028007, 
+0x8017fc80, 0xfe7ff802, 0xf8008027, 0x8018007f, 0x027fe800, 0x17fd7ff8, 0x7fe80380, 0x028007fe, 
+0x27fd7ff8, 0x7fd80180, 0xfe8037ff, 0x18017ff7, 0x8017fe80, 0x007ff800, 0x07ff8018, 0x80080080, 
+0x027ff7ff, 0x07ff7fe8, 0x7fe80380, 0x038007fe, 0x17fd7ff8, 0x7ff80280, 0x008017fd, 0x28007ff8, 
+0x7ff7fe80, 0xfe800802, 0xe8018017, 0x8027ff7f, 0x017ff7ff, 0x07ff8008, 0x7fe80080, 0xfe800802, 
+0xe8008017, 0x8028007f, 0x017ff7fe, 0x07ff8008, 0x7ff80080, 0xff800800, 0xf8008007, 0x8007ff7f, 
+0x007ff800, 0xf8028008, 0x8007fe7f, 0xff801800, 0x18007ff7, 0x7fe7ff80, 0xfe800802, 0x08008007, 
+0x8007ff80, 0xff800800, 0x08008007, 0x8017ff80, 0x017fe800, 0x07ff7ff8, 0x7ff80080, 0x00800800, 
+0x18007ff8, 0x7ff7fe80, 0xfe800801, 0xf8018007, 0x8017ff7f, 0x017ff7ff, 0xf8007ff8, 0x8018007f, 
+0x017ff7ff, 0x17fe8008, 0x7ff80080, 0x00800800, 0x07ff8008, 0x7ff80080, 0xff800800, 0xf8008007, 
+0x8018007f, 0x007ff7ff, 0x07ff8008, 0x80080080, 0x008007ff, 0x08007ff8, 0x7ff7ff80, 0xff800800, 
+0xf8008007, 0x8008007f, 0xff800800, 0xf7ff8007, 0x8008007f, 0x008007ff, 0x07ff7ff8, 0x7ff80080, 
+0xff800800, 0xf8007ff7, 0x8007ff7f, 0xff7ff800, 0xf8008007, 0x8008007f, 0x007ff7ff, 0x07ff8008, 
+0x8007ff80, 0x007ff7ff, 0x07ff8008, 0x7ff80080, 0xff8007ff, 0x08007ff7, 0x7ff80080, 0xff7ff800, 
+0xf8008007, 0x8008007f, 0x007ff7ff, 0x07ff7ff8, 0x8007ff80, 0x00800800, 0x07ff7ff8, 0x7ff80080, 
+0xff800800, 0x08008007, 0x8007ff80, 0xff800800, 0x07ff8007, 0x7ff7ff80, 0x008007ff, 0x08007ff8, 
+0x7ff80080, 0x007ff800, 0x08007ff8, 0x8007ff80, 0xff8007ff, 0x07ff8007, 0x7ff80080, 0xff800800, 
+0x07ff8007, 0x7ff7ff80, 0x007ff800, 0xf8007ff8, 0x7ff8007f, 0x007ff800, 0xf8007ff8, 0x7ff8007f, 
+0x007ff800, 0x08007ff8, 0x00000080
+};
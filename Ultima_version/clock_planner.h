@@ -0,0 +1,138 @@
+/**
+ * @file clock_planner.h
+ * @brief Búsqueda del reloj del sistema, wrap y divisor del PWM para una frecuencia de audio exacta.
+ * @details El PWM entrega una muestra por ciclo, así que la frecuencia real es
+ *     sys_hz · 16 / (div16 · (wrap + 1))
+ * con div16 el divisor en dieciseisavos (parte entera de 8 bits y fracción de
+ * 4). Un divisor fraccionario alterna ciclos de distinta duración y añade
+ * jitter, y con el reloj de 125 MHz la mayoría de las frecuencias no salen
+ * exactas. El planificador recorre las frecuencias que el PLL del sistema
+ * puede generar desde el cristal de 12 MHz (en kHz enteros, como las pide
+ * set_sys_clock_khz()) y, para cada una, los divisores del PWM, y se queda con
+ * el mejor candidato según este orden:
+ *  1. error de frecuencia, considerando iguales los que están dentro de la tolerancia;
+ *  2. divisor entero antes que fraccionario;
+ *  3. mayor wrap (más resolución);
+ *  4. menor error;
+ *  5. reloj del sistema más cercano al nominal.
+ * No depende del SDK de la Pico, así que la búsqueda también corre en el host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PLANNER_REF_KHZ       12000u   ///< Cristal de la placa.
+#define PLANNER_VCO_MIN_KHZ   750000u  ///< Límites del VCO del PLL del sistema.
+#define PLANNER_VCO_MAX_KHZ   1600000u
+#define PLANNER_FBDIV_MIN     16u
+#define PLANNER_FBDIV_MAX     320u
+#define PLANNER_POSTDIV_MAX   7u
+#define PLANNER_DIV16_MIN     16u      ///< Divisor 1.0 en dieciseisavos.
+#define PLANNER_DIV16_MAX     4095u    ///< Divisor 255 + 15/16.
+#define PLANNER_WRAP_MAX      4095u    ///< Un ciclo de 12 bits, la resolución de las muestras.
+#define PLANNER_NOMINAL_KHZ   125000u  ///< Reloj por defecto del SDK.
+#define PLANNER_MAX_ERROR_PPB 1000000  ///< Candidatos con más de 1000 ppm de error se descartan.
+
+typedef struct {
+    uint32_t sys_khz;   ///< Reloj del sistema a configurar con set_sys_clock_khz().
+    uint16_t wrap;      ///< Wrap del PWM; los niveles van de 0 a wrap.
+    uint8_t div_int;    ///< Parte entera del divisor del PWM.
+    uint8_t div_frac;   ///< Parte fraccionaria del divisor, en dieciseisavos.
+    uint64_t rate_mhz;  ///< Frecuencia de audio obtenida en milihercios.
+    int32_t error_ppb;  ///< Error respecto a la pedida, en partes por mil millones.
+} ClockPlan;
+
+/**
+ * @brief Devuelve true si @p a es mejor que @p b según el orden descrito en el archivo.
+ */
+static bool clock_plan_better(const ClockPlan *a, const ClockPlan *b, int32_t tolerance_ppb) {
+    uint32_t ea = (uint32_t)(a->error_ppb < 0 ? -a->error_ppb : a->error_ppb);
+    uint32_t eb = (uint32_t)(b->error_ppb < 0 ? -b->error_ppb : b->error_ppb);
+    uint32_t ka = ea > (uint32_t)tolerance_ppb ? ea : 0;
+    uint32_t kb = eb > (uint32_t)tolerance_ppb ? eb : 0;
+    if (ka != kb) return ka < kb;
+    if ((a->div_frac == 0) != (b->div_frac == 0)) return a->div_frac == 0;
+    if (a->wrap != b->wrap) return a->wrap > b->wrap;
+    if (ea != eb) return ea < eb;
+    uint32_t da = a->sys_khz > PLANNER_NOMINAL_KHZ ? a->sys_khz - PLANNER_NOMINAL_KHZ : PLANNER_NOMINAL_KHZ - a->sys_khz;
+    uint32_t db = b->sys_khz > PLANNER_NOMINAL_KHZ ? b->sys_khz - PLANNER_NOMINAL_KHZ : PLANNER_NOMINAL_KHZ - b->sys_khz;
+    return da < db;
+}
+
+/**
+ * @brief Evalúa un reloj del sistema y un divisor, eligiendo el wrap más cercano a la frecuencia pedida.
+ * @return false si no hay wrap válido o el error supera PLANNER_MAX_ERROR_PPB.
+ */
+static bool clock_plan_evaluate(uint32_t sys_khz, uint32_t div16, uint32_t rate_hz, uint16_t min_wrap,
+                                ClockPlan *plan) {
+    uint64_t num = (uint64_t)sys_khz * 1000u * 16u; // sys_hz · 16
+    uint64_t per_top = (uint64_t)div16 * rate_hz;
+    uint64_t top = (num + per_top / 2) / per_top;  // wrap + 1 redondeado
+    if (top < (uint64_t)min_wrap + 1 || top > PLANNER_WRAP_MAX + 1u) return false;
+
+    uint64_t den = per_top * top;
+    int64_t diff = (int64_t)num - (int64_t)den;
+    if ((diff < 0 ? -diff : diff) * 1000 > (int64_t)den) return false; // Más de 1000 ppm
+
+    plan->sys_khz = sys_khz;
+    plan->wrap = (uint16_t)(top - 1);
+    plan->div_int = (uint8_t)(div16 >> 4);
+    plan->div_frac = (uint8_t)(div16 & 0xF);
+    plan->rate_mhz = (num * 1000u + (div16 * top) / 2) / (div16 * top);
+    plan->error_ppb = (int32_t)(diff * 1000000000 / (int64_t)den);
+    return plan->error_ppb <= PLANNER_MAX_ERROR_PPB && plan->error_ppb >= -PLANNER_MAX_ERROR_PPB;
+}
+
+/**
+ * @brief Busca la mejor combinación de reloj del sistema, wrap y divisor para @p rate_hz.
+ * @param rate_hz Frecuencia de audio deseada.
+ * @param min_sys_khz, max_sys_khz Rango permitido para el reloj del sistema.
+ * @param min_wrap Wrap mínimo aceptable (define la resolución mínima).
+ * @param tolerance_ppb Errores por debajo de este valor se consideran exactos.
+ * @param plan Resultado de la búsqueda.
+ * @return false si ninguna combinación cumple las restricciones.
+ */
+static bool clock_plan_search(uint32_t rate_hz, uint32_t min_sys_khz, uint32_t max_sys_khz, uint16_t min_wrap,
+                              int32_t tolerance_ppb, ClockPlan *plan) {
+    bool found = false;
+    ClockPlan candidate;
+    // Solo las frecuencias que el PLL genera exactamente, en pasos de kHz:
+    // sys = 12 MHz · fbdiv / (pd1 · pd2)
+    for (uint32_t fbdiv = PLANNER_FBDIV_MIN; fbdiv <= PLANNER_FBDIV_MAX; ++fbdiv) {
+        uint32_t vco = PLANNER_REF_KHZ * fbdiv;
+        if (vco < PLANNER_VCO_MIN_KHZ || vco > PLANNER_VCO_MAX_KHZ) continue;
+        for (uint32_t pd1 = 1; pd1 <= PLANNER_POSTDIV_MAX; ++pd1) {
+            for (uint32_t pd2 = 1; pd2 <= pd1; ++pd2) {
+                if (vco % (pd1 * pd2)) continue;
+                uint32_t sys_khz = vco / (pd1 * pd2);
+                if (sys_khz < min_sys_khz || sys_khz > max_sys_khz) continue;
+
+                // Divisores que dejan un wrap de al menos min_wrap
+                uint64_t div16_max = ((uint64_t)sys_khz * 1000u * 16u) / ((uint64_t)rate_hz * (min_wrap + 1u));
+                if (div16_max > PLANNER_DIV16_MAX) div16_max = PLANNER_DIV16_MAX;
+                for (uint32_t div16 = PLANNER_DIV16_MIN; div16 <= div16_max; ++div16) {
+                    if (!clock_plan_evaluate(sys_khz, div16, rate_hz, min_wrap, &candidate)) continue;
+                    if (!found || clock_plan_better(&candidate, plan, tolerance_ppb)) {
+                        *plan = candidate;
+                        found = true;
+                    }
+                }
+            }
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Resolución efectiva de la salida en décimas de bit, log2(wrap + 1) · 10.
+ */
+static inline uint32_t clock_plan_bits_x10(const ClockPlan *plan) {
+    static const uint32_t tenth_steps[9] = {70240, 75281, 80684, 86475, 92682, 99334, 106464, 114105, 122295}; // 2^(k/10) en 16.16
+    uint32_t levels = (uint32_t)plan->wrap + 1u;
+    uint32_t bits = 0;
+    while ((2u << bits) <= levels) ++bits;
+    uint32_t tenths = 0;
+    while (tenths < 9 && ((uint64_t)tenth_steps[tenths] << bits) <= ((uint64_t)levels << 16)) ++tenths;
+    return bits * 10u + tenths;
+}
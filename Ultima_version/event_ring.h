@@ -0,0 +1,90 @@
+/**
+ * @file event_ring.h
+ * @brief Cola sin bloqueos de un productor y un consumidor para pasar eventos al motor de audio.
+ * @details El núcleo 0 (botones, ADC, consola) escribe y el núcleo 1 (mezcla y
+ * secuenciador) lee. Cada lado solo modifica su propio índice: el productor
+ * escribe el evento y después publica 'head' con semántica release; el
+ * consumidor lee 'head' con acquire, copia el evento y libera la casilla
+ * publicando 'tail'. Ninguna operación deshabilita interrupciones ni espera al
+ * otro núcleo, así que el motor nunca se bloquea por la interfaz. Los índices
+ * cuentan sin límite y se enmascaran al acceder, de modo que la cola puede
+ * llenarse por completo. Usa solo C11, así que también compila en el host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define EVENT_RING_SIZE 64 ///< Capacidad de la cola; potencia de dos.
+_Static_assert((EVENT_RING_SIZE & (EVENT_RING_SIZE - 1)) == 0, "EVENT_RING_SIZE debe ser potencia de dos");
+
+typedef enum {
+    EVENT_TRIGGER = 0,    ///< Dispara 'track' transpuesto 'semitones', parte 'step'.
+    EVENT_PATTERN_TOGGLE, ///< Alterna el paso 'step' del patrón de 'track'.
+    EVENT_TEMPO,          ///< Cambia el tempo a 'value' BPM.
+    EVENT_PERIOD,         ///< Cambia el periodo del DMA a 'value' cuadros.
+    EVENT_ATTACK_BENCH,   ///< Mide el relleno con todas las voces arrancando a la vez.
+    EVENT_TAIL_BENCH,     ///< Mide el relleno con varias voces largas sonando sus colas.
+    EVENT_STEAL_MODE,     ///< Cambia el modo de robo de voces a 'value' (StealMode).
+    EVENT_NOISE_ORDER,    ///< Cambia el orden del modelado de ruido de la salida a 'value'.
+    EVENT_INTERP,         ///< Cambia la interpolación de 'track' a 'value' (InterpMode).
+    EVENT_RESET_COUNTERS, ///< Reinicia los contadores de rendimiento y de vaciados.
+} EventType;
+
+typedef struct {
+    uint32_t time;      ///< Posición de audio (muestras desde el arranque) al generarse.
+    uint8_t type;       ///< EventType.
+    uint8_t track;      ///< Sonido o pista.
+    int8_t semitones;   ///< Transposición del disparo.
+    uint8_t step;       ///< Paso del patrón, o parte del sonido en un disparo.
+    uint16_t value;     ///< Parámetro numérico (BPM, cuadros o el modo elegido).
+} EngineEvent;
+
+typedef struct {
+    _Atomic uint32_t head;                ///< Eventos escritos; solo lo modifica el productor.
+    _Atomic uint32_t tail;                ///< Eventos leídos; solo lo modifica el consumidor.
+    EngineEvent events[EVENT_RING_SIZE];
+    uint32_t dropped;                     ///< Eventos descartados por cola llena (productor).
+} EventRing;
+
+static void event_ring_init(EventRing *ring) {
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    ring->dropped = 0;
+}
+
+/**
+ * @brief Encola un evento. Solo la llama el productor.
+ * @return false si la cola está llena; el evento se descarta y se cuenta.
+ */
+static bool event_ring_push(EventRing *ring, const EngineEvent *event) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail >= EVENT_RING_SIZE) {
+        ring->dropped++;
+        return false;
+    }
+    ring->events[head & (EVENT_RING_SIZE - 1)] = *event;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Devuelve el evento más antiguo sin sacarlo. Solo la llama el consumidor.
+ * @return NULL si la cola está vacía. El puntero es válido hasta event_ring_pop().
+ */
+static const EngineEvent *event_ring_peek(EventRing *ring) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (head == tail) return NULL;
+    return &ring->events[tail & (EVENT_RING_SIZE - 1)];
+}
+
+/**
+ * @brief Libera el evento devuelto por event_ring_peek(). Solo la llama el consumidor.
+ */
+static void event_ring_pop(EventRing *ring) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
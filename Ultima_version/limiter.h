@@ -0,0 +1,111 @@
+/**
+ * @file limiter.h
+ * @brief Limitador suave del bus maestro con curva tabulada y seguidor de picos.
+ * @details Trabaja sobre la suma de voces ya escalada a unidades de 12 bits con
+ * signo (una voz a fondo de escala llega a ±2048) y LIMITER_FRAC_BITS bits
+ * fraccionarios, de modo que la mezcla puede correr sin margen de atenuación y
+ * la etapa de salida recibe más resolución que la del PWM. Los niveles de este
+ * archivo están en unidades de 12 bits; el código los escala. Cada bloque se procesa en dos pasadas:
+ *  1. Se busca el pico del bloque y se actualiza una envolvente con ataque
+ *     inmediato y liberación exponencial. Si la envolvente supera el umbral, se
+ *     calcula una ganancia de reducción (una sola división por bloque).
+ *  2. Cada muestra se multiplica por esa ganancia y pasa por la curva de
+ *     saturación: lineal hasta la rodilla y una tangente hiperbólica tabulada
+ *     hasta el techo de ±2047, con interpolación lineal entre entradas.
+ * Como el pico se mide sobre el mismo bloque que se va a escribir, no hace falta
+ * retardo de anticipación. No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "requantizer.h"
+
+#define LIMITER_KNEE        1792  ///< Por debajo de este nivel la curva es lineal.
+#define LIMITER_CEILING     2047  ///< Nivel máximo de salida.
+#define LIMITER_THRESHOLD   2560  ///< Entrada máxima de la curva; por encima actúa la envolvente.
+#define LIMITER_TABLE_SHIFT 4     ///< Cada entrada de la tabla cubre 16 niveles de entrada.
+#define LIMITER_TABLE_SIZE  (LIMITER_THRESHOLD >> LIMITER_TABLE_SHIFT)
+#define LIMITER_RELEASE_SHIFT 4   ///< Liberación: la envolvente recorre 1/16 de la distancia por bloque.
+#define LIMITER_CYCLES_PER_SAMPLE_BUDGET 40 ///< Presupuesto de CPU del limitador por muestra.
+#define LIMITER_FRAC_BITS MIX_FRAC_BITS   ///< Bits fraccionarios de las muestras que procesa.
+#define LIMITER_LEVEL(x) ((int32_t)(x) << LIMITER_FRAC_BITS) ///< Nivel de 12 bits en unidades de las muestras.
+
+typedef struct {
+    int16_t curve[LIMITER_TABLE_SIZE + 1]; ///< Curva de saturación en [0, LIMITER_THRESHOLD].
+    int32_t envelope;                      ///< Envolvente de pico actual (unidades de las muestras).
+    uint32_t gain;                         ///< Ganancia de reducción del último bloque (Q15).
+} Limiter;
+
+/**
+ * @brief Precalcula la curva de saturación; se llama una vez al arrancar.
+ */
+static void limiter_init(Limiter *lim) {
+    const float span = (float)(LIMITER_CEILING - LIMITER_KNEE);
+    for (int i = 0; i <= LIMITER_TABLE_SIZE; ++i) {
+        int32_t x = i << LIMITER_TABLE_SHIFT;
+        if (x <= LIMITER_KNEE) {
+            lim->curve[i] = (int16_t)x;
+        } else {
+            float y = LIMITER_KNEE + span * tanhf((float)(x - LIMITER_KNEE) / span);
+            lim->curve[i] = (int16_t)(y + 0.5f);
+        }
+    }
+    lim->envelope = 0;
+    lim->gain = 1u << 15;
+}
+
+/**
+ * @brief Aplica la curva de saturación a un nivel positivo ya reducido.
+ */
+static inline int32_t limiter_shape(const Limiter *lim, int32_t x) {
+    const int shift = LIMITER_TABLE_SHIFT + LIMITER_FRAC_BITS;
+    if (x <= LIMITER_LEVEL(LIMITER_KNEE)) return x;
+    if (x >= LIMITER_LEVEL(LIMITER_THRESHOLD)) return LIMITER_LEVEL(lim->curve[LIMITER_TABLE_SIZE]);
+
+    uint32_t idx = (uint32_t)x >> shift;
+    int32_t frac = x & ((1 << shift) - 1);
+    int32_t y0 = LIMITER_LEVEL(lim->curve[idx]);
+    int32_t y1 = LIMITER_LEVEL(lim->curve[idx + 1]);
+    return y0 + (((y1 - y0) * frac) >> shift);
+}
+
+/**
+ * @brief Limita un bloque en su sitio.
+ * @param lim Estado del limitador.
+ * @param samples Muestras con signo en unidades de 12 bits con LIMITER_FRAC_BITS
+ * bits fraccionarios; se sobrescriben con valores dentro de ±LIMITER_CEILING.
+ * @param n Número de muestras del bloque.
+ */
+static void limiter_process(Limiter *lim, int32_t *samples, size_t n) {
+    // Pasada 1: pico del bloque y envolvente
+    int32_t peak = 0;
+    for (size_t i = 0; i < n; ++i) {
+        int32_t a = samples[i] < 0 ? -samples[i] : samples[i];
+        if (a > peak) peak = a;
+    }
+    if (peak >= lim->envelope) {
+        lim->envelope = peak;
+    } else {
+        lim->envelope -= (lim->envelope - peak) >> LIMITER_RELEASE_SHIFT;
+    }
+    lim->gain = lim->envelope > LIMITER_LEVEL(LIMITER_THRESHOLD)
+                    ? ((uint32_t)LIMITER_LEVEL(LIMITER_THRESHOLD) << 15) / (uint32_t)lim->envelope
+                    : 1u << 15;
+
+    // Pasada 2: reducción (solo si hace falta) y curva
+    int32_t gain = (int32_t)lim->gain;
+    if (gain == (1 << 15)) {
+        for (size_t i = 0; i < n; ++i) {
+            int32_t x = samples[i];
+            samples[i] = x < 0 ? -limiter_shape(lim, -x) : limiter_shape(lim, x);
+        }
+    } else {
+        // Con los bits fraccionarios el producto no cabe en 32 bits
+        for (size_t i = 0; i < n; ++i) {
+            int32_t x = (int32_t)(((int64_t)samples[i] * gain) >> 15);
+            samples[i] = x < 0 ? -limiter_shape(lim, -x) : limiter_shape(lim, x);
+        }
+    }
+}
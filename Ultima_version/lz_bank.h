@@ -0,0 +1,183 @@
+/**
+ * @file lz_bank.h
+ * @brief Compresión LZ sin pérdida del banco de sonidos, al estilo de los bloques LZ4.
+ * @details El banco se guarda comprimido en flash y se descomprime una sola vez
+ * al arrancar a una región de SRAM reservada; después las voces leen de SRAM
+ * como con el banco PCM (ver lz_bank_decode() más abajo para la división del
+ * banco en bloques). Cada secuencia empieza con un byte de control (nibble
+ * alto: literales, nibble bajo: largo de la copia menos LZ_MIN_MATCH; 15 indica
+ * que siguen bytes de extensión que se suman hasta uno distinto de 255), sigue
+ * con los literales y termina con la distancia de la copia (16 bits en little
+ * endian). La última secuencia solo tiene literales.
+ *
+ * Los literales se copian con LZ_COPY_LITERALS(dst, src, n), que por omisión
+ * es memcpy(); main.c la redefine antes de incluir este archivo para copiar
+ * las tandas largas con DMA. Las copias se hacen byte a byte porque pueden
+ * solaparse con lo que producen. El compresor solo se usa en el host (ver
+ * tools/bank_gen.c). No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define LZ_MIN_MATCH 4           ///< Copia más corta que se codifica.
+#define LZ_MAX_OFFSET 65535      ///< Distancia más larga de una copia.
+/// Bytes que pueden ocupar @p n bytes comprimidos en el peor caso (todo literales).
+#define LZ_BOUND(n) ((n) + (n) / 255 + 16)
+
+#ifndef LZ_COPY_LITERALS
+#define LZ_COPY_LITERALS(dst, src, n) memcpy((dst), (src), (n))
+#endif
+
+/// Lee un largo de 4 bits y sus bytes de extensión; falso si se sale de @p end.
+static inline bool lz_read_length(const uint8_t **src, const uint8_t *end, size_t *length) {
+    if (*length != 15) return true;
+    uint8_t byte;
+    do {
+        if (*src >= end) return false;
+        byte = *(*src)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+/**
+ * @brief Descomprime @p src_len bytes de @p src en @p dst.
+ * @return Bytes escritos, o 0 si los datos están corruptos o no caben en @p dst_cap.
+ */
+static size_t lz_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_cap) {
+    const uint8_t *end = src + src_len;
+    uint8_t *out = dst;
+    uint8_t *out_end = dst + dst_cap;
+    while (src < end) {
+        uint8_t token = *src++;
+        size_t literals = token >> 4;
+        if (!lz_read_length(&src, end, &literals)) return 0;
+        if (literals > (size_t)(end - src) || literals > (size_t)(out_end - out)) return 0;
+        LZ_COPY_LITERALS(out, src, literals);
+        out += literals;
+        src += literals;
+        if (src == end) break; // Última secuencia: solo literales
+
+        if (end - src < 2) return 0;
+        size_t offset = src[0] | (src[1] << 8);
+        src += 2;
+        size_t match = token & 0x0F;
+        if (!lz_read_length(&src, end, &match)) return 0;
+        match += LZ_MIN_MATCH;
+        if (offset == 0 || offset > (size_t)(out - dst) || match > (size_t)(out_end - out)) return 0;
+        const uint8_t *from = out - offset;
+        while (match--) *out++ = *from++;
+    }
+    return (size_t)(out - dst);
+}
+
+/// Escribe un largo que no cupo en el nibble como bytes de extensión.
+static inline uint8_t *lz_write_length(uint8_t *out, size_t length) {
+    for (; length >= 255; length -= 255) *out++ = 255;
+    *out++ = (uint8_t)length;
+    return out;
+}
+
+/**
+ * @brief Comprime @p n bytes de @p in en @p out (hasta LZ_BOUND(n) bytes). Solo en el host.
+ * @details Busca en toda la ventana la copia más larga en cada posición y la
+ * toma si alcanza LZ_MIN_MATCH; los bancos son de pocos KB, así que la
+ * búsqueda exhaustiva tarda poco y comprime mejor que una tabla hash.
+ * @return Bytes escritos.
+ */
+static inline size_t lz_compress(const uint8_t *in, size_t n, uint8_t *out) {
+    uint8_t *start = out;
+    size_t anchor = 0; // Primer literal pendiente
+    size_t i = 0;
+    while (i + LZ_MIN_MATCH <= n) {
+        size_t best = 0, best_offset = 0;
+        size_t first = i > LZ_MAX_OFFSET ? i - LZ_MAX_OFFSET : 0;
+        for (size_t j = first; j < i; ++j) {
+            size_t len = 0;
+            while (i + len < n && in[j + len] == in[i + len]) ++len;
+            if (len >= best) { // A igual largo, la más cercana
+                best = len;
+                best_offset = i - j;
+            }
+        }
+        if (best < LZ_MIN_MATCH) {
+            ++i;
+            continue;
+        }
+        size_t literals = i - anchor;
+        size_t match = best - LZ_MIN_MATCH;
+        *out++ = (uint8_t)(((literals < 15 ? literals : 15) << 4) | (match < 15 ? match : 15));
+        if (literals >= 15) out = lz_write_length(out, literals - 15);
+        memcpy(out, in + anchor, literals);
+        out += literals;
+        *out++ = (uint8_t)(best_offset & 0xFF);
+        *out++ = (uint8_t)(best_offset >> 8);
+        if (match >= 15) out = lz_write_length(out, match - 15);
+        i += best;
+        anchor = i;
+    }
+    size_t literals = n - anchor;
+    *out++ = (uint8_t)((literals < 15 ? literals : 15) << 4);
+    if (literals >= 15) out = lz_write_length(out, literals - 15);
+    memcpy(out, in + anchor, literals);
+    out += literals;
+    return (size_t)(out - start);
+}
+
+// --- Banco de muestras ---
+// Cada sonido se comprime en bloques independientes de LZ_BLOCK_SAMPLES
+// muestras. Dentro del bloque van primero los bytes bajos de todas las muestras
+// y después los altos (0-15 en 12 bits), que se repiten mucho más que los
+// pares intercalados; así el bloque se descomprime en un búfer de
+// LZ_SCRATCH_BYTES y se intercala sobre la región de destino. Cada bloque
+// empieza con sus bytes comprimidos (16 bits en little endian).
+
+#define LZ_BLOCK_SAMPLES 512                      ///< Muestras por bloque comprimido.
+#define LZ_SCRATCH_BYTES (2 * LZ_BLOCK_SAMPLES)   ///< Búfer temporal de un bloque descomprimido.
+#define LZ_BLOCK_HEADER_BYTES 2
+/// Bytes que puede ocupar el banco comprimido de @p samples muestras en el peor caso.
+#define LZ_BANK_BOUND(samples) \
+    ((((samples) + LZ_BLOCK_SAMPLES - 1) / LZ_BLOCK_SAMPLES) * (LZ_BLOCK_HEADER_BYTES + LZ_BOUND(LZ_SCRATCH_BYTES)))
+
+/**
+ * @brief Descomprime las @p samples muestras de @p bank en @p out usando @p scratch (LZ_SCRATCH_BYTES).
+ * @return Falso si el banco está corrupto; @p out queda a medias.
+ */
+static bool lz_bank_decode(const uint8_t *bank, size_t bank_len, uint16_t *out, size_t samples, uint8_t *scratch) {
+    const uint8_t *end = bank + bank_len;
+    for (size_t base = 0; base < samples; base += LZ_BLOCK_SAMPLES) {
+        size_t n = samples - base < LZ_BLOCK_SAMPLES ? samples - base : LZ_BLOCK_SAMPLES;
+        if (end - bank < LZ_BLOCK_HEADER_BYTES) return false;
+        size_t len = bank[0] | (bank[1] << 8);
+        bank += LZ_BLOCK_HEADER_BYTES;
+        if (len > (size_t)(end - bank) || lz_decompress(bank, len, scratch, 2 * n) != 2 * n) return false;
+        bank += len;
+        for (size_t i = 0; i < n; ++i) out[base + i] = (uint16_t)(scratch[i] | (scratch[n + i] << 8));
+    }
+    return true;
+}
+
+/**
+ * @brief Comprime @p n muestras en @p out (hasta LZ_BANK_BOUND(n) bytes). Solo en el host.
+ * @return Bytes escritos.
+ */
+static inline size_t lz_bank_encode(const uint16_t *in, size_t n, uint8_t *out) {
+    uint8_t planes[LZ_SCRATCH_BYTES];
+    uint8_t *start = out;
+    for (size_t base = 0; base < n; base += LZ_BLOCK_SAMPLES) {
+        size_t count = n - base < LZ_BLOCK_SAMPLES ? n - base : LZ_BLOCK_SAMPLES;
+        for (size_t i = 0; i < count; ++i) {
+            planes[i] = (uint8_t)(in[base + i] & 0xFF);
+            planes[count + i] = (uint8_t)(in[base + i] >> 8);
+        }
+        size_t len = lz_compress(planes, 2 * count, out + LZ_BLOCK_HEADER_BYTES);
+        out[0] = (uint8_t)(len & 0xFF);
+        out[1] = (uint8_t)(len >> 8);
+        out += LZ_BLOCK_HEADER_BYTES + len;
+    }
+    return (size_t)(out - start);
+}
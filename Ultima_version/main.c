@@ -4,63 +4,218 @@
  * @details Este programa implementa una caja de ritmos de 16 pasos con 3 instrumentos (kick, snare, hi-hat).
  * Utiliza PWM y DMA para la salida de audio, ADC para el control de tempo,
  * y PIO para la retroalimentación visual en una tira de LEDs WS2812.
+ * El motor de audio (secuenciador, mezcla y la interrupción del DMA) corre en
+ * el núcleo 1; el núcleo 0 atiende botones, ADC, LEDs y consola y le envía
+ * los cambios por una cola sin bloqueos (ver event_ring.h).
  * @author Daniel Rúa
  * @date 16 de Julio, 2025
  */
 
  #include <stdio.h>
  #include "pico/stdlib.h"
+ #include "pico/multicore.h"
  #include "hardware/dma.h"
  #include "hardware/pwm.h"
  #include "hardware/gpio.h"
  #include "hardware/irq.h"
+ #include "hardware/sync.h"
  #include "hardware/timer.h"
  #include "hardware/adc.h"
  #include "hardware/clocks.h"
+ #include "hardware/structs/xip_ctrl.h"
+ #if AUDIO_ADPCM
+ #include "audio_table_adpcm.h"
+ #elif AUDIO_PACKED12
+ #include "audio_table_packed.h"
+ #elif AUDIO_LZ
+ #include "audio_table_lz.h"
+ #else
  #include "audio_table.h"
+ #endif
  #include "sampler.h"
+ _Static_assert(KICK_SIZE <= SAMPLE_LENGTH_MAX && SNARE_SIZE <= SAMPLE_LENGTH_MAX && HIHAT_SIZE <= SAMPLE_LENGTH_MAX,
+                "Un sonido del banco pasa de SAMPLE_LENGTH_MAX muestras");
+ #include "perf.h"
+ #if AUDIO_PREFIX_CACHE
+ void stream_dma_start(uint16_t *dst, const uint16_t *src, uint32_t n);
+ bool stream_dma_busy();
+ #define STREAM_DMA_START(dst, src, n) stream_dma_start((dst), (src), (n))
+ #define STREAM_DMA_BUSY() stream_dma_busy()
+ #endif
+ bool claim_output_block();
+ #define MIXER_OUTPUT_CLAIM() claim_output_block()
+ #include "mixer.h"
+ #if AUDIO_LZ
+ void lz_dma_copy(uint8_t *dst, const uint8_t *src, size_t n);
+ #define LZ_COPY_LITERALS(dst, src, n) lz_dma_copy((dst), (src), (n))
+ #include "lz_bank.h"
+ #endif
+ #include "clock_planner.h"
+ #include "event_ring.h"
  #include "ws2812.h"
  
  // --- Definiciones de Hardware y Parámetros ---
  
  #define POT_PIN 27                  ///< Pin GPIO para la entrada del potenciómetro (ADC1).
  #define MIC_PIN 26                  ///< Pin GPIO para una entrada de micrófono (no usado actualmente).
- #define PWM_PIN 15                  ///< Pin GPIO para la salida de audio PWM.
+ #define PWM_PIN 15                  ///< Pin GPIO para la salida de audio PWM (canal derecho en estéreo).
+ #define PWM_PIN_LEFT 14             ///< Pin GPIO del canal izquierdo en estéreo (mismo slice que PWM_PIN).
  #define BUTTON_PIN 0                ///< Pin GPIO inicial para los 10 botones de entrada.
- #define PWM_WRAP_VALUE      4096    ///< Valor de envoltura del PWM (resolución).
+ #define PWM_WRAP_VALUE PWM_WRAP      ///< Valor de envoltura del PWM, derivado de la frecuencia (ver audio_config.h).
  #define SAMPLES 120000              ///< Número de muestras a leer (usado en una función inactiva).
- #define SAMPLE_RATE 24000           ///< Frecuencia de muestreo del audio en Hz.
+ #define SAMPLE_RATE OUTPUT_SAMPLE_RATE ///< Frecuencia de muestreo del audio en Hz (ver audio_config.h).
+ #define AUDIO_MIN_SYS_KHZ 100000    ///< Reloj del sistema mínimo que acepta el planificador.
+ #define AUDIO_MAX_SYS_KHZ 133000    ///< Reloj del sistema máximo (el nominal de la RP2040).
+ #define AUDIO_MIN_WRAP 1023         ///< Resolución mínima del PWM: 10 bits.
+ #define AUDIO_RATE_TOLERANCE_PPB 1000 ///< Errores menores a 1 ppm cuentan como frecuencia exacta.
  #define PATTERN_STEPS_PER_BUFFER (DMA_HALF_BUFFER_SIZE / 4) ///< Pasos de patrón por búfer (sin uso activo).
- #define NUM_SOUNDS          3       ///< Número total de sonidos (kick, snare, hi-hat).
  
  // --- Prototipos de Funciones ---
  
+ void audio_clock_init(uint32_t sample_rate);
+ void print_clock_plan();
  void pwm_sample_rate_init(uint32_t sample_rate);
  void play_samples_pwm_dma();
  void update_tempo(uint32_t new_bpm);
- void fill_and_mix_buffer(uint16_t *buffer_ptr, size_t num_samples_to_fill);
+ void handle_console();
+ void print_headroom_table();
+ void print_underruns();
+ void print_period_table();
+ bool fill_audio_half(audio_frame_t *buffer_ptr, uint16_t frames);
+ uint32_t audio_position();
+ uint32_t audio_next_block(uint32_t *start);
+ void audio_set_period(uint16_t period);
+ void audio_core_main();
+ void post_event(EngineEvent event);
+ void post_timed_event(EngineEvent event);
+ uint32_t live_lookahead(uint16_t period);
+ void apply_engine_events(uint32_t block_start);
+ void reset_counters();
+ #if AUDIO_LZ
+ void bank_init();
+ void print_bank_report();
+ #endif
+ #if AUDIO_PREFIX_CACHE
+ void prefix_cache_init();
+ #endif
+ int attack_bench_begin();
+ void print_attack_bench();
+ int tail_bench_next(uint16_t frames);
+ void print_tail_bench();
  
  // --- Variables Globales ---
  
- SamplePlayer players[3];              ///< Arreglo de reproductores de muestras para cada sonido.
  volatile bool adc_ready = false;      ///< Bandera que indica que una nueva lectura del ADC está lista.
  volatile bool dma = false;            ///< Bandera que indica que el DMA ha completado una transferencia.
  volatile int dma_chan = 0;            ///< Canal DMA utilizado para la reproducción de audio.
+ volatile int ctrl_chan = 0;           ///< Canal DMA que relanza 'dma_chan' sobre la mitad siguiente.
+ // Los bloques de audio se numeran desde el arranque; el bloque k suena en la mitad k % 2
+ volatile uint32_t dma_blocks_done = 0;    ///< Bloques que el DMA terminó de enviar al PWM.
+ volatile uint32_t dma_samples_done = 0;   ///< Cuadros de esos bloques: la posición de audio al empezar el que suena.
+ volatile uint16_t audio_period = AUDIO_PERIOD_DEFAULT; ///< Cuadros que el DMA recarga al relanzarse; solo lo cambia claim_output_block().
+ uint16_t fill_period = AUDIO_PERIOD_DEFAULT; ///< Cuadros de los bloques que mezcla el núcleo 1 (ver audio_set_period()).
+ /// Cuadros del último bloque lanzado en cada mitad; los anota la interrupción del DMA.
+ volatile uint16_t block_period[2] = {AUDIO_PERIOD_DEFAULT, AUDIO_PERIOD_DEFAULT};
+ volatile uint32_t audio_blocks_ready = 2; ///< Bloques rellenados (los dos primeros antes de arrancar).
+ volatile uint32_t underrun_count = 0;     ///< Bloques que empezaron a sonar sin estar rellenados.
+ uint32_t late_fills = 0;                  ///< Rellenos descartados porque su bloque ya había empezado a sonar.
+ uint32_t worst_late_samples = 0;          ///< Mayor retraso de un relleno, en muestras.
+ bool fill_claims = false;                 ///< Falso durante el prellenado, con el DMA parado.
+ uint32_t fill_block = 0;                  ///< Bloque que está rellenando el núcleo 1.
+ uint32_t fill_block_start = 0;            ///< Posición de audio en que empieza a sonar.
+ uint32_t late_triggers = 0;               ///< Disparos en vivo que llegaron después de su anticipación.
+ /// Direcciones de inicio de cada mitad; el canal de control las recorre en anillo (alineadas a 8 bytes).
+ static audio_frame_t *dma_block_addrs[2] __attribute__((aligned(8))) = {sampler_buffer, sampler_buffer + HALF_BUFFER_SIZE};
  volatile int trigger_channel = 0;     ///< Canal DMA para el disparo por ADC (no usado).
  volatile uint8_t button_num = 0;      ///< Almacena el número del último botón presionado (0-9).
  volatile uint8_t pattern_slice = 0;   ///< Desplazamiento del patrón (0 o 8) para edición con 8 botones.
  volatile uint8_t idx = 0;             ///< Índice del instrumento actualmente seleccionado para edición (0-2).
+ volatile bool chromatic_mode = false; ///< Si está activo, los botones 0-7 tocan el instrumento en una escala.
+ /// Escala mayor de una octava en semitonos, relativa a la octava baja (pattern_slice = 0).
+ static const int8_t chromatic_scale[8] = {-12, -10, -8, -7, -5, -3, -1, 0};
+ // Copias del núcleo 0 de los ajustes que cambia la consola; el motor recibe cada cambio como evento
+ StealMode steal_mode_setting = STEAL_OLDEST;            ///< Modo de robo de voces enviado al motor.
+ uint8_t noise_order_setting = REQUANT_FIRST_ORDER;      ///< Orden del modelado de ruido enviado al motor.
+ uint8_t interp_setting[NUM_SOUNDS];                     ///< Interpolación de cada sonido enviada al motor.
+ ClockPlan audio_clock_plan;           ///< Reloj, wrap y divisor elegidos para la frecuencia de audio.
+ bool audio_clock_planned = false;     ///< Falso si el planificador no encontró combinación válida.
+ PerfCounter fill_perf[MAX_VOICES + 1]; ///< Ciclos por bloque (y cuadros mezclados) según las voces activas al inicio.
+ EventRing engine_events;              ///< Disparos, ediciones del patrón y tempo del núcleo 0 al motor.
+ #if AUDIO_LZ
+ #define LZ_DMA_MIN_LITERALS 16        ///< Las tandas de literales más cortas se copian con memcpy().
+ uint16_t bank_sram[KICK_SIZE + SNARE_SIZE + HIHAT_SIZE]; ///< Región reservada donde se descomprime el banco LZ.
+ static uint8_t lz_scratch[LZ_SCRATCH_BYTES];             ///< Bloque descomprimido antes de intercalar sus bytes.
+ int lz_dma_chan = -1;                 ///< Canal DMA de las copias de literales; solo existe durante bank_init().
+ uint32_t lz_dma_bytes = 0;            ///< Bytes de literales que copió el DMA.
+ uint32_t bank_load_us[NUM_SOUNDS];    ///< Tiempo de descompresión de cada sonido al arrancar.
+ bool bank_load_ok[NUM_SOUNDS];        ///< Falso si el sonido estaba corrupto y quedó mudo.
+ #endif
+ #if AUDIO_PREFIX_CACHE
+ static uint16_t prefix_cache[NUM_SOUNDS][AUDIO_PREFIX_CACHE]; ///< Primeras muestras de cada sonido, copiadas de la flash.
+ int stream_dma_chan = -1;             ///< Canal DMA que precarga los trozos de las voces; solo lo usa el núcleo 1.
+ dma_channel_config stream_dma_config; ///< Configuración fija de ese canal.
+ #endif
+ volatile uint8_t attack_bench_phase = 0; ///< Bloques que faltan de la prueba de ataque.
+ PerfCounter attack_perf[2];           ///< Relleno del bloque en que arrancan todas las voces: [0] sin caché, [1] con caché.
+ uint32_t attack_xip_misses[2];        ///< Fallos de la caché XIP durante ese relleno.
+ uint32_t worst_fill_xip_misses = 0;   ///< Más fallos de la caché XIP en un relleno cualquiera.
+ #define TAIL_BENCH_STEPS 4                           ///< Cantidades de voces de la prueba de colas.
+ #define TAIL_BENCH_MODES (1 + (AUDIO_PREFIX_CACHE > 0)) ///< Colas leídas de la flash y, con caché, precargadas.
+ #define TAIL_BENCH_SKIP (3u * AUDIO_PREFIX_CACHE + AUDIO_PERIOD_MAX) ///< Cuadros de ataque que no se miden.
+ static const uint8_t tail_bench_voices[TAIL_BENCH_STEPS] = {1, MAX_VOICES / 4, MAX_VOICES / 2, MAX_VOICES};
+ volatile uint8_t tail_bench_left = 0; ///< Pasos que faltan de la prueba de colas.
+ uint32_t tail_bench_frames = 0;       ///< Cuadros mezclados en el paso en curso.
+ PerfCounter tail_perf[TAIL_BENCH_MODES * TAIL_BENCH_STEPS]; ///< Relleno de cada paso, por modo y cantidad de voces.
+ uint32_t tail_xip_misses[TAIL_BENCH_MODES * TAIL_BENCH_STEPS]; ///< Más fallos de la caché XIP en un relleno del paso.
+ 
+ /// Margen de la anticipación de los disparos en vivo para la demora del núcleo 0 en enviarlos (1 ms).
+ #define LIVE_TRIGGER_SLACK (SAMPLE_RATE / 1000)
+ 
+ #define PERIOD_SIZES 6 ///< Periodos seleccionables: AUDIO_PERIOD_MIN por 1, 2, 4 ... 32.
+ _Static_assert((AUDIO_PERIOD_MIN << (PERIOD_SIZES - 1)) == AUDIO_PERIOD_MAX, "PERIOD_SIZES no cubre hasta AUDIO_PERIOD_MAX");
+ 
+ /// Costo y latencia medidos con cada periodo, para elegir el de cada instalación.
+ typedef struct {
+     PerfCounter irq;         ///< Ciclos de la interrupción del DMA.
+     PerfCounter fill;        ///< Ciclos de mezcla, con los cuadros como elementos.
+     uint32_t worst_latency;  ///< Mayor espera de un disparo en vivo desde la pulsación hasta sonar, en muestras.
+     uint64_t latency_sum;
+     uint32_t latency_count;
+ } PeriodStats;
+ PeriodStats period_stats[PERIOD_SIZES];
+ PeriodStats *volatile period_stats_now = &period_stats[1]; ///< Estadísticas del periodo en uso (AUDIO_PERIOD_DEFAULT).
  
  
  /**
   * @brief Manejador de interrupción para el canal DMA de audio.
   * @details Se activa cuando el DMA termina de transferir una mitad del búfer de audio.
-  * Limpia la bandera de interrupción y activa la bandera 'dma' para que el
-  * bucle principal sepa que debe rellenar la mitad del búfer que ha quedado libre.
+  * Para entonces el canal de control ya relanzó la reproducción sobre la otra
+  * mitad, así que aquí no se reprograma nada: se limpia la interrupción, se
+  * cuenta el bloque terminado y se activa la bandera 'dma' para el bucle
+  * principal. El bloque que empieza a sonar se lanzó con la recarga vigente,
+  * 'audio_period', que no cambia después de lanzado (ver claim_output_block()),
+  * así que aquí se anota su longitud. Si no se rellenó a tiempo (vaciado del
+  * búfer) se cuenta: suena la caída a silencio que esta misma interrupción dejó
+  * en su mitad cuando se liberó. La mitad que acaba de terminar se prepara igual
+  * para el bloque siguiente (ver mixer_prepare_fallback()), antes de que el DMA
+  * vuelva a ella, así que nunca suena el audio de hace dos bloques.
   */
  void dma_handler() {
+     uint32_t irq_start = perf_now();
      dma_hw->ints0 = 1u << dma_chan; // Limpia la interrupción para el canal específico.
+     uint32_t finished = dma_blocks_done;
+     // La posición se actualiza antes que el contador de bloques (ver audio_position())
+     dma_samples_done = dma_samples_done + block_period[finished & 1];
+     uint32_t playing = finished + 1;
+     block_period[playing & 1] = audio_period;
+     dma_blocks_done = playing;
+     if ((int32_t)(audio_blocks_ready - playing) <= 0) {
+         underrun_count = underrun_count + 1;
+         output_fade_in = true;
+     }
+     mixer_prepare_fallback(sampler_buffer, HALF_BUFFER_SIZE, playing, block_period[playing & 1], audio_period);
      dma = true;                     // Activa la bandera para el bucle principal.
+     perf_record(&period_stats_now->irq, irq_start);
  }
  
  /**
@@ -102,13 +257,16 @@
  
  bool button_pressed = false;            ///< Bandera que indica si se ha presionado un botón.
  volatile uint32_t last_button_time = 0; ///< Marca de tiempo de la última pulsación para anti-rebote.
+ volatile uint32_t button_audio_time = 0; ///< Posición de audio de la última pulsación (ver audio_position()).
  const uint32_t debounce_ms = 300;       ///< Tiempo de anti-rebote (debounce) en milisegundos.
  
  /**
   * @brief Manejador de interrupción para los botones.
   * @details Se activa con un flanco de bajada en cualquier pin de botón.
   * Implementa una lógica anti-rebote simple basada en tiempo y, si la
-  * pulsación es válida, activa la bandera 'button_pressed' e identifica qué botón fue.
+  * pulsación es válida, activa la bandera 'button_pressed', identifica qué botón fue
+  * y anota la posición de audio en ese instante, con la que el motor programa el
+  * disparo con precisión de muestra.
   * @param gpio El pin GPIO que generó la interrupción.
   * @param events El tipo de evento de interrupción (ej. flanco de bajada).
   */
@@ -119,6 +277,7 @@
              button_pressed = true;
              last_button_time = now;
              button_num = gpio - BUTTON_PIN;
+             button_audio_time = audio_position();
          }
      }
  }
@@ -151,15 +310,17 @@
  
  /**
   * @brief Punto de entrada principal del programa.
-  * @details Realiza la inicialización de todos los periféricos y luego entra en un
-  * bucle infinito que gestiona los eventos del sistema de forma reactiva
-  * (pulsaciones de botón, finalización de DMA, lecturas de ADC).
+  * @details Realiza la inicialización de todos los periféricos, lanza el motor
+  * de audio en el núcleo 1 y luego entra en un bucle infinito que gestiona los
+  * eventos del sistema de forma reactiva (pulsaciones de botón, lecturas de ADC,
+  * consola) y se los envía al motor.
   * @return int Código de salida del programa (teóricamente, nunca retorna).
   */
  int main()
  {
      // --- Fase de Inicialización ---
      stdio_init_all();
+     audio_clock_init(SAMPLE_RATE); // Antes de los periféricos que dependen del reloj del sistema
      ws2812_init(16);
      button_init(BUTTON_PIN);
      adc_init();
@@ -167,25 +328,57 @@
      adc_select_input(1); // ADC1 corresponde a GPIO27
      adc_set_clkdiv(80.0f);
      
-     // Inicializa los reproductores de muestras
-     players[0] = (SamplePlayer){.data = kick_data, .length = KICK_SIZE, .position = 0, .active = false};
-     players[1] = (SamplePlayer){.data = snare_data, .length = SNARE_SIZE, .position = 0, .active = false};
-     players[2] = (SamplePlayer){.data = hihat_data, .length = HIHAT_SIZE, .position = 0, .active = false};
+     // Inicializa los sonidos y el banco de voces (el kick no se puede robar;
+     // el kick desvanece su golpe anterior al redispararse y el hi-hat está en el
+     // grupo de corte 1, donde se sumarían otros hi-hats)
+     slots[0] = (SampleSlot){.length = KICK_SIZE, .priority = 2, .protect = true, .mono = true, .choke_group = 0, .interp = INTERP_LINEAR, .volume = Q15_ONE, .pan = 0};
+     slots[1] = (SampleSlot){.length = SNARE_SIZE, .priority = 1, .protect = false, .mono = false, .choke_group = 0, .interp = INTERP_LINEAR, .volume = Q15_ONE, .pan = -16};
+     slots[2] = (SampleSlot){.length = HIHAT_SIZE, .priority = 0, .protect = false, .mono = false, .choke_group = 1, .interp = INTERP_LINEAR, .volume = Q15_ONE, .pan = 24};
+ #if AUDIO_ADPCM
+     slots[0].adpcm = kick_adpcm;
+     slots[1].adpcm = snare_adpcm;
+     slots[2].adpcm = hihat_adpcm;
+ #elif AUDIO_PACKED12
+     slots[0].packed = kick_packed;
+     slots[1].packed = snare_packed;
+     slots[2].packed = hihat_packed;
+ #elif AUDIO_LZ
+     bank_init(); // Descomprime el banco a SRAM y apunta 'data' de cada sonido allí
+ #else
+     slots[0].data = kick_data;
+     slots[1].data = snare_data;
+     slots[2].data = hihat_data;
+ #if AUDIO_PREFIX_CACHE
+     prefix_cache_init(); // Copia los ataques a SRAM y prepara el canal de precarga
+ #endif
+ #endif
+     for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+         interp_setting[s] = slots[s].interp; // El núcleo 1 todavía no arrancó
+     }
+     voice_pool_init(&voice_pool, steal_mode_setting);
+     mixer_init();
      
      update_tempo(112);
-     fill_and_mix_buffer(sampler_buffer, HALF_BUFFER_SIZE); // Pre-llena la mitad del búfer
+     event_ring_init(&engine_events);
+     perf_init();
+     fill_audio_half(sampler_buffer, audio_period); // Pre-llena ambas mitades del búfer
+     fill_audio_half(sampler_buffer + HALF_BUFFER_SIZE, audio_period);
  
      sleep_ms(2000); // Pausa inicial
+     print_clock_plan();
+ #if AUDIO_LZ
+     print_bank_report();
+ #endif
  
      // Inicia tareas periódicas
      add_alarm_in_us(10000, update, NULL, true); // Alarma para LEDs
      add_alarm_in_us(250000, my_alarm_callback, NULL, true); // Alarma para ADC
      
-     // Inicia el motor de audio
+     // Inicia el motor de audio en el núcleo 1
      pwm_sample_rate_init(SAMPLE_RATE);
      dma_chan = dma_claim_unused_channel(true);
-     play_samples_pwm_dma();
-     dma_channel_start(dma_chan);
+     ctrl_chan = dma_claim_unused_channel(true);
+     multicore_launch_core1(audio_core_main);
  
      // --- Bucle Principal (Orientado a Eventos) ---
      while (true) {
@@ -196,57 +389,223 @@
                  idx = (idx + 1) % 3;
                  printf("Pattern: %d\n", idx);
              }
-             else if (button_num == 9){ // Botón para cambiar de slice de patrón
+             else if (button_num == 9){ // Botón para cambiar de slice de patrón (u octava en modo cromático)
                  pattern_slice = (pattern_slice + 8) % 16;
                  printf("Pattern slice: %d\n", pattern_slice);
              }
+             else if (chromatic_mode){ // Botones 0-7 tocan una escala con el instrumento elegido
+                 post_timed_event((EngineEvent){.time = button_audio_time, .type = EVENT_TRIGGER, .track = idx,
+                                                .semitones = (int8_t)(chromatic_scale[button_num] + (pattern_slice ? 12 : 0))});
+             }
              else{ // Botones 0-7 para editar el patrón
-                 patterns[idx] ^= (1 << (button_num + pattern_slice));
+                 post_event((EngineEvent){.type = EVENT_PATTERN_TOGGLE, .track = idx,
+                                          .step = (uint8_t)(button_num + pattern_slice)});
              }
          }
  
-         if(dma) { // Si una transferencia DMA ha terminado
-             dma = false;
-             // Lógica de doble búfer
-             if(current_buffer_is_upper_half){
-                 dma_channel_set_read_addr(dma_chan, sampler_buffer, false);
-                 fill_and_mix_buffer(sampler_buffer + HALF_BUFFER_SIZE, HALF_BUFFER_SIZE);
-             } else {
-                 dma_channel_set_read_addr(dma_chan, sampler_buffer + HALF_BUFFER_SIZE, false);
-                 fill_and_mix_buffer(sampler_buffer, HALF_BUFFER_SIZE);
-             }
-             current_buffer_is_upper_half = !current_buffer_is_upper_half;
-             dma_channel_set_trans_count(dma_chan, HALF_BUFFER_SIZE, true); // Inicia la siguiente transferencia
-         }
-         
          if (adc_ready) { // Si hay una nueva lectura de ADC
              adc_ready = false;
              uint16_t adc_value = adc_read();
              uint new_bpm = 60 + (adc_value * 160 / 4095); // Mapea el valor a un rango de BPM
              if (abs((int)current_bpm - (int)new_bpm) > 2) { // Evita fluctuaciones pequeñas
-                 update_tempo(new_bpm);
+                 current_bpm = new_bpm; // El motor lo vuelve a fijar al aplicar el evento
+                 post_event((EngineEvent){.type = EVENT_TEMPO, .value = (uint16_t)new_bpm});
                  printf("BPM updated to: %d\n", new_bpm);
              }
          }
          
+         handle_console();
+ 
          tight_loop_contents(); // Mantiene la CPU en bajo consumo mientras espera interrupciones
      }
  }
  
+ /**
+  * @brief Bucle del motor de audio en el núcleo 1.
+  * @details Configura aquí el DMA para que su interrupción quede habilitada en
+  * el NVIC de este núcleo; el núcleo 0 no la recibe. Por cada bloque que el
+  * DMA termina aplica los eventos pendientes (que pueden cambiar el periodo) y
+  * rellena la mitad libre, que guarda el bloque siguiente al que está sonando.
+  * Un relleno que llega tarde se descarta (ver claim_output_block()) y el
+  * bucle sigue con el bloque siguiente.
+  */
+ void audio_core_main() {
+     perf_init(); // SysTick es propio de cada núcleo
+     play_samples_pwm_dma();
+     dma_channel_start(dma_chan);
+     fill_claims = true;
+ 
+     while (true) {
+         if(dma) { // Si una transferencia DMA ha terminado
+             dma = false;
+             // El DMA ya sigue con la otra mitad por su cuenta; solo se rellena la libre
+             uint32_t start;
+             uint32_t block = audio_next_block(&start);
+             apply_engine_events(start);
+             fill_block = block;
+             fill_block_start = start;
+             if (!fill_audio_half(sampler_buffer + (block & 1) * HALF_BUFFER_SIZE, fill_period)) {
+                 ++late_fills; // Suena la caída a silencio que dejó la interrupción
+                 uint32_t late = audio_position() - start;
+                 if (late > worst_late_samples) worst_late_samples = late;
+             }
+         }
+         tight_loop_contents();
+     }
+ }
+ 
+ /**
+  * @brief Envía un evento al motor de audio con la posición de audio actual. Solo desde el núcleo 0.
+  */
+ void post_event(EngineEvent event) {
+     event.time = audio_position();
+     post_timed_event(event);
+ }
+ 
+ /**
+  * @brief Envía un evento que ya trae su posición de audio (la de la pulsación). Solo desde el núcleo 0.
+  */
+ void post_timed_event(EngineEvent event) {
+     if (!event_ring_push(&engine_events, &event)) {
+         printf("Cola de eventos llena\n");
+     }
+ }
+ 
+ /**
+  * @brief Anticipación de los disparos en vivo con un periodo dado, en muestras.
+  * @details Un disparo pulsado justo después de que el motor lea la cola espera
+  * a la lectura siguiente y se mezcla en el bloque posterior a ella, que empieza
+  * a sonar hasta dos periodos después de la pulsación. Retrasando todos los
+  * disparos esa cantidad (más el margen del núcleo 0) la latencia es siempre la
+  * misma en lugar de variar entre cero y dos periodos según el momento.
+  */
+ uint32_t live_lookahead(uint16_t period) {
+     return 2u * period + LIVE_TRIGGER_SLACK;
+ }
+ 
+ /**
+  * @brief Aplica en el núcleo 1 los eventos que envió el núcleo 0.
+  * @details Cada disparo en vivo suena live_lookahead() muestras después de su
+  * pulsación, en el cuadro exacto del bloque que le toca (ver mixer_trigger_at()).
+  * Si ese cuadro cae después del bloque que se va a mezclar, el disparo y los
+  * eventos que lo siguen se quedan en la cola hasta el bloque siguiente, para
+  * no alterar su orden. Los que llegan tarde suenan al inicio del bloque y se cuentan.
+  * @param block_start Posición de audio en que empieza a sonar el bloque que se
+  * va a mezclar; con ella se ubica cada disparo y se mide cuánto esperó.
+  */
+ void apply_engine_events(uint32_t block_start) {
+     const EngineEvent *event;
+     while ((event = event_ring_peek(&engine_events)) != NULL) {
+         switch (event->type) {
+         case EVENT_TRIGGER: {
+             int32_t offset = (int32_t)(event->time + live_lookahead(fill_period) - block_start);
+             if (offset >= (int32_t)fill_period) return; // Suena en un bloque posterior
+             if (offset < 0) {
+                 ++late_triggers;
+                 offset = 0;
+             }
+             mixer_trigger_at(event->track, event->semitones, event->step, (uint32_t)offset);
+             PeriodStats *ps = period_stats_now;
+             uint32_t latency = block_start + (uint32_t)offset - event->time;
+             if (latency > ps->worst_latency) ps->worst_latency = latency;
+             ps->latency_sum += latency;
+             ps->latency_count++;
+             break;
+         }
+         case EVENT_PATTERN_TOGGLE:
+             patterns[event->track] ^= (uint16_t)(1u << event->step);
+             break;
+         case EVENT_TEMPO:
+             update_tempo(event->value);
+             break;
+         case EVENT_PERIOD:
+             audio_set_period(event->value);
+             break;
+         case EVENT_ATTACK_BENCH:
+             attack_bench_phase = 2; // Un bloque sin caché de prefijo y otro con ella
+             break;
+         case EVENT_TAIL_BENCH:
+             tail_bench_left = TAIL_BENCH_MODES * TAIL_BENCH_STEPS;
+             tail_bench_frames = 0;
+             break;
+         case EVENT_STEAL_MODE:
+             voice_pool.steal_mode = (StealMode)event->value;
+             break;
+         case EVENT_NOISE_ORDER:
+             output_stage.order = (uint8_t)event->value;
+             break;
+         case EVENT_INTERP:
+             // Las voces ya disparadas conservan su modo; el cambio aplica al siguiente disparo
+             slots[event->track].interp = (uint8_t)event->value;
+             break;
+         case EVENT_RESET_COUNTERS:
+             reset_counters();
+             break;
+         }
+         event_ring_pop(&engine_events);
+     }
+ }
+ 
+ /**
+  * @brief Elige y aplica el reloj del sistema que da la frecuencia de audio exacta.
+  * @details Busca con clock_planner.h el reloj del sistema, el wrap y el divisor
+  * del PWM, cambia el reloj del sistema y ajusta el nivel máximo de salida del
+  * mezclador al wrap elegido. Si no hay combinación válida se mantiene el reloj
+  * actual y pwm_sample_rate_init() usa el cálculo aproximado.
+  * @param sample_rate La frecuencia de muestreo deseada en Hz.
+  */
+ void audio_clock_init(uint32_t sample_rate){
+     audio_clock_planned = clock_plan_search(sample_rate, AUDIO_MIN_SYS_KHZ, AUDIO_MAX_SYS_KHZ, AUDIO_MIN_WRAP,
+                                             AUDIO_RATE_TOLERANCE_PPB, &audio_clock_plan);
+     if (audio_clock_planned && !set_sys_clock_khz(audio_clock_plan.sys_khz, false)) {
+         audio_clock_planned = false;
+     }
+     mixer_set_output_max(audio_clock_planned ? audio_clock_plan.wrap : PWM_WRAP_VALUE);
+ }
+ 
+ /**
+  * @brief Imprime la frecuencia de audio obtenida, su error y la resolución efectiva.
+  */
+ void print_clock_plan(){
+     if (!audio_clock_planned) {
+         printf("Reloj de audio: sin plan exacto, divisor aproximado a %lu Hz\n", (unsigned long)clock_get_hz(clk_sys));
+         return;
+     }
+     const ClockPlan *plan = &audio_clock_plan;
+     int32_t ppb = plan->error_ppb;
+     uint32_t abs_ppb = (uint32_t)(ppb < 0 ? -ppb : ppb);
+     uint32_t bits = clock_plan_bits_x10(plan);
+     printf("Reloj de audio: %lu.%03lu Hz (pedido %u), error %s%lu.%03lu ppm, %lu.%lu bits\n",
+            (unsigned long)(plan->rate_mhz / 1000), (unsigned long)(plan->rate_mhz % 1000), SAMPLE_RATE,
+            ppb < 0 ? "-" : "", (unsigned long)(abs_ppb / 1000), (unsigned long)(abs_ppb % 1000),
+            (unsigned long)(bits / 10), (unsigned long)(bits % 10));
+     printf("  sistema=%lu kHz wrap=%u divisor=%u+%u/16\n", (unsigned long)plan->sys_khz, plan->wrap,
+            plan->div_int, plan->div_frac);
+ }
+ 
  /**
   * @brief Configura el periférico PWM para operar a una frecuencia de muestreo específica.
-  * @details Calcula el divisor de reloj necesario para que la frecuencia del ciclo
-  * del PWM coincida con la frecuencia de muestreo del audio.
+  * @details Usa el wrap y el divisor entero/fraccionario del plan de reloj; sin
+  * plan, calcula un divisor en coma flotante para el wrap nominal. En estéreo
+  * también se conecta el canal A del mismo slice, que recibe el canal izquierdo.
   * @param sample_rate La frecuencia de muestreo deseada en Hz.
   */
  void pwm_sample_rate_init(uint32_t sample_rate){
      gpio_set_function(PWM_PIN, GPIO_FUNC_PWM);
+ #if AUDIO_STEREO
+     gpio_set_function(PWM_PIN_LEFT, GPIO_FUNC_PWM);
+ #endif
      uint slice_num = pwm_gpio_to_slice_num(PWM_PIN);
-     uint32_t sys_clk = clock_get_hz(clk_sys);
-     uint16_t wrap = 4000;
-     float clkdiv = (float)sys_clk / (sample_rate * (wrap + 1));
-     pwm_set_wrap(slice_num, wrap);
-     pwm_set_clkdiv(slice_num, clkdiv);
+     if (audio_clock_planned) {
+         pwm_set_wrap(slice_num, audio_clock_plan.wrap);
+         pwm_set_clkdiv_int_frac(slice_num, audio_clock_plan.div_int, audio_clock_plan.div_frac);
+     } else {
+         uint32_t sys_clk = clock_get_hz(clk_sys);
+         uint16_t wrap = PWM_WRAP_VALUE;
+         float clkdiv = (float)sys_clk / (sample_rate * (wrap + 1));
+         pwm_set_wrap(slice_num, wrap);
+         pwm_set_clkdiv(slice_num, clkdiv);
+     }
      pwm_set_enabled(slice_num, true);
  }
  
@@ -254,7 +613,16 @@
   * @brief Configura e inicia una transferencia DMA desde el búfer de audio al PWM.
   * @details Establece un canal DMA para transferir datos de 16 bits desde el
   * 'sampler_buffer' al registro de ciclo de trabajo del PWM, sincronizado
-  * por las solicitudes de datos (DREQ) del propio PWM.
+  * por las solicitudes de datos (DREQ) del propio PWM. En estéreo cada
+  * transferencia es de 32 bits y escribe un cuadro completo en el registro CC:
+  * los dos canales cambian en el mismo ciclo del PWM con una sola petición DMA.
+  *
+  * Al terminar cada mitad, el canal de datos se encadena al canal de control,
+  * que copia la dirección de la mitad siguiente (de 'dma_block_addrs', leída en
+  * anillo) en el registro READ_ADDR con disparo del canal de datos. El contador
+  * de transferencias se recarga solo con el último valor escrito, así que el
+  * doble búfer suena indefinidamente sin que la CPU intervenga; un retraso del
+  * bucle principal ya no detiene la salida.
   */
  void play_samples_pwm_dma() {
      if(dma_channel_is_busy(dma_chan)) {
@@ -264,11 +632,29 @@
      uint slice_num = pwm_gpio_to_slice_num(PWM_PIN);
      dma_channel_cleanup(dma_chan);
      dma_channel_config c = dma_channel_get_default_config(dma_chan);
-     channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+     channel_config_set_transfer_data_size(&c, AUDIO_STEREO ? DMA_SIZE_32 : DMA_SIZE_16);
      channel_config_set_read_increment(&c, true);
      channel_config_set_write_increment(&c, false);
      channel_config_set_dreq(&c, pwm_get_dreq(slice_num));
  
+     channel_config_set_chain_to(&c, ctrl_chan);
+ 
+     // Canal de control: una palabra por disparo, del anillo de direcciones al
+     // alias READ_ADDR_TRIG del canal de datos
+     dma_channel_config cc = dma_channel_get_default_config(ctrl_chan);
+     channel_config_set_transfer_data_size(&cc, DMA_SIZE_32);
+     channel_config_set_read_increment(&cc, true);
+     channel_config_set_write_increment(&cc, false);
+     channel_config_set_ring(&cc, false, 3); // Anillo de lectura de 8 bytes: dos direcciones
+     dma_channel_configure(
+         ctrl_chan,
+         &cc,
+         &dma_hw->ch[dma_chan].al3_read_addr_trig,
+         &dma_block_addrs[1],          // El primer relanzamiento va a la mitad superior
+         1,
+         false
+     );
+ 
      dma_channel_set_irq0_enabled(dma_chan, true);
      irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
      irq_set_enabled(DMA_IRQ_0, true);
@@ -278,87 +664,634 @@
          &c,
          &pwm_hw->slice[slice_num].cc, // Destino: registro de nivel del PWM
          sampler_buffer,               // Fuente: búfer de audio
-         HALF_BUFFER_SIZE,             // Número de transferencias
+         audio_period,                 // Número de transferencias
          false                         // No iniciar inmediatamente
      );
  }
  
  /**
-  * @brief Rellena un búfer con muestras de audio mezcladas según el patrón actual.
-  * @details Esta es la función principal del motor de audio. Avanza el secuenciador
-  * basado en el tempo, dispara los sonidos correspondientes a cada paso
-  * del patrón, mezcla las muestras de los sonidos activos y las escribe en el búfer.
-  * @param buffer_ptr Puntero al búfer de audio que se va a rellenar.
-  * @param num_samples_to_fill Número de muestras a generar.
+  * @brief Rellena una mitad del búfer de audio midiendo su coste en ciclos.
+  * @details El resultado se acumula en 'fill_perf' según cuántas voces estaban
+  * activas al empezar el bloque, y en las estadísticas del periodo en uso.
+  * @param buffer_ptr Puntero a la mitad del búfer que se va a rellenar.
+  * @param frames Cuadros del bloque (el periodo en uso).
+  * @return Falso si el bloque llegó tarde y no se escribió.
   */
- void fill_and_mix_buffer(uint16_t *buffer_ptr, size_t num_samples_to_fill) {
-     static size_t samples_since_last_pattern_step = 0;
+ bool fill_audio_half(audio_frame_t *buffer_ptr, uint16_t frames) {
+     int bench = attack_bench_phase ? attack_bench_begin() : -1;
+     int tail = tail_bench_left ? tail_bench_next(frames) : -1;
+     uint8_t active = voice_pool.num_active;
+     xip_ctrl_hw->ctr_hit = 0; // Los contadores saturan: se cuentan los fallos de cada relleno
+     xip_ctrl_hw->ctr_acc = 0;
+     uint32_t start = perf_now();
+     bool written = fill_and_mix_buffer(buffer_ptr, frames);
+     perf_record_items(&fill_perf[active], start, frames);
+     perf_record_items(&period_stats_now->fill, start, frames);
+     uint32_t misses = xip_ctrl_hw->ctr_acc - xip_ctrl_hw->ctr_hit;
+     if (misses > worst_fill_xip_misses) worst_fill_xip_misses = misses;
+     if (bench >= 0) {
+         perf_record_items(&attack_perf[bench], start, frames);
+         if (misses > attack_xip_misses[bench]) attack_xip_misses[bench] = misses;
+     }
+     if (tail >= 0) {
+         perf_record_items(&tail_perf[tail], start, frames);
+         if (misses > tail_xip_misses[tail]) tail_xip_misses[tail] = misses;
+     }
+     return written;
+ }
  
-     for (size_t i = 0; i < num_samples_to_fill; ++i) {
-         int32_t mixed_sample_value = 0;
-         int active_samples_count = 0;
+ /**
+  * @brief Reserva la mitad que se rellena justo antes de escribirla (MIXER_OUTPUT_CLAIM de mixer.h). Solo desde el núcleo 1.
+  * @details Con las interrupciones desactivadas comprueba que el bloque
+  * 'fill_block' todavía no empezó a sonar (audio_position() ya cuenta la
+  * interrupción pendiente) y lo marca como rellenado, así la interrupción del
+  * DMA no lo cuenta como vaciado. Aunque el bloque empiece mientras
+  * se recuantiza, la recuantización va muy por delante del DMA, que solo lee
+  * cuadros ya escritos. Si ya sonaba, suena la caída a silencio que la
+  * interrupción dejó en su mitad y la mezcla se descarta.
+  *
+  * Un cambio de periodo pendiente se programa aquí y solo si el bloque llega a
+  * tiempo: el DMA lo lanzará con la recarga nueva, que coincide con los cuadros
+  * mezclados. Al bloque anterior le queda al menos una muestra por enviar, miles
+  * de ciclos, así que el relanzamiento no puede caer entre la comprobación y la
+  * escritura. Un bloque que ya sonaba se lanzó con la recarga anterior y el
+  * cambio espera al siguiente.
+  * @return Falso si el bloque llegó tarde.
+  */
+ bool claim_output_block() {
+     if (!fill_claims) return true; // Prellenado: el DMA todavía no arrancó
+     uint32_t irq = save_and_disable_interrupts();
+     bool in_time = (int32_t)(audio_position() - fill_block_start) < 0;
+     if (in_time) {
+         if (fill_period != audio_period) {
+             audio_period = fill_period;
+             dma_channel_set_trans_count(dma_chan, fill_period, false);
+         }
+         audio_blocks_ready = fill_block + 1;
+     }
+     restore_interrupts(irq);
+     return in_time;
+ }
  
-         // --- Lógica del Secuenciador ---
-         samples_since_last_pattern_step++;
-         if (samples_since_last_pattern_step >= pattern_samples_per_step) {
-             samples_since_last_pattern_step = 0;
-             pattern_index = (pattern_index + 1) % 16; // Avanza y cicla el índice del patrón
+ /**
+  * @brief Cambia el periodo del DMA sin cortar el audio. Solo desde el núcleo 1.
+  * @details Se llama antes de mezclar un bloque: ese bloque y los siguientes se
+  * mezclan con el periodo nuevo, y claim_output_block() lo programa en el DMA
+  * cuando el primero de ellos llega a tiempo. Escribir el contador sin disparo
+  * solo cambia el valor de recarga, así que el bloque que suena termina con su
+  * longitud y el siguiente ya se envía completo. Como cada mitad empieza
+  * siempre en el mismo sitio, el bloque nuevo no se solapa con el que suena
+  * aunque el periodo crezca.
+  * @param period Cuadros por bloque; se redondea a la potencia de dos inferior
+  * dentro de [AUDIO_PERIOD_MIN, AUDIO_PERIOD_MAX].
+  */
+ void audio_set_period(uint16_t period) {
+     uint8_t index = 0;
+     while (index + 1 < PERIOD_SIZES && (AUDIO_PERIOD_MIN << (index + 1)) <= period) ++index;
+     period = AUDIO_PERIOD_MIN << index;
+     if (period == fill_period) return;
+     fill_period = period;
+     period_stats_now = &period_stats[index];
+     perf_reset(&limiter_perf); // Sus presupuestos se comparan por bloque
+     perf_reset(&requant_perf);
+ }
  
-             uint16_t current_step_bit_mask = (1u << (15 - pattern_index));
-             beat_index = 15 - pattern_index;
+ /**
+  * @brief Devuelve cuántas muestras ha enviado el DMA al PWM desde el arranque.
+  * @details Suma los cuadros de los bloques terminados y los ya enviados del
+  * bloque en curso. Justo después de que el canal de control relance el DMA y
+  * antes de que se atienda la interrupción, el contador ya se recargó pero
+  * 'dma_blocks_done' no ha avanzado; se detecta porque la mitad que se está
+  * leyendo no es la del bloque contado; ese bloque se lanzó con el valor de
+  * recarga vigente, 'audio_period', aunque no se haya llegado a rellenar. La
+  * mitad superior empieza donde termina una inferior de AUDIO_PERIOD_MAX
+  * cuadros: en esa dirección, con el contador a cero todavía es la inferior.
+  */
+ uint32_t audio_position() {
+     uint32_t done, base, remaining;
+     uintptr_t addr;
+     do { // Lectura coherente; la interrupción escribe la posición antes que el contador
+         done = dma_blocks_done;
+         base = dma_samples_done;
+         addr = dma_hw->ch[dma_chan].read_addr;
+         remaining = dma_hw->ch[dma_chan].transfer_count;
+     } while (done != dma_blocks_done || addr != dma_hw->ch[dma_chan].read_addr);
  
-             // Dispara los sonidos si el bit correspondiente está activo en el patrón
-             if (patterns[0] & current_step_bit_mask) {
-                 players[0].active = true;
-                 players[0].position = 0;
-             }
-             if (patterns[1] & current_step_bit_mask) {
-                 players[1].active = true;
-                 players[1].position = 0;
-             }
-             if (patterns[2] & current_step_bit_mask) {
-                 players[2].active = true;
-                 players[2].position = 0;
-             }
+     uintptr_t upper = (uintptr_t)(sampler_buffer + HALF_BUFFER_SIZE);
+     uint32_t half = (addr > upper || (addr == upper && remaining != 0)) ? 1u : 0u;
+     if (half != (done & 1)) { // Interrupción pendiente
+         return base + block_period[done & 1] + audio_period - remaining;
+     }
+     return base + block_period[done & 1] - remaining;
+ }
+ 
+ /**
+  * @brief Devuelve el número del bloque siguiente al que suena.
+  * @param start Posición de audio en que ese bloque empezará a sonar.
+  */
+ uint32_t audio_next_block(uint32_t *start) {
+     uint32_t done, base;
+     do {
+         done = dma_blocks_done;
+         base = dma_samples_done;
+     } while (done != dma_blocks_done);
+     *start = base + block_period[done & 1];
+     return done + 1;
+ }
+ 
+ /**
+  * @brief Imprime, para cada periodo, el costo de las interrupciones frente a la latencia de los disparos.
+  * @details Las interrupciones por segundo y la latencia teórica (la
+  * anticipación de live_lookahead()) dependen solo del periodo; los ciclos por
+  * interrupción, el uso de CPU de la mezcla (que incluye el costo fijo de cada
+  * bloque) y la peor latencia medida, desde la pulsación hasta la muestra en
+  * que empieza el disparo, se miden con el periodo en uso. Mientras ningún
+  * disparo llegue tarde la medida coincide con la teórica. Una columna sin
+  * mediciones se muestra con guiones.
+  */
+ void print_period_table() {
+     uint32_t sys_clk = clock_get_hz(clk_sys);
+     printf("Periodo: %u cuadros\n  cuadros   IRQ/s  ciclos/IRQ  IRQ %%CPU  mezcla %%CPU  latencia peor/teorica (ms)\n",
+            audio_period);
+     for (uint8_t i = 0; i < PERIOD_SIZES; ++i) {
+         uint32_t period = AUDIO_PERIOD_MIN << i;
+         const PeriodStats *ps = &period_stats[i];
+         uint32_t irqs_x10 = SAMPLE_RATE * 10u / period;
+         printf("  %7lu  %4lu.%lu", (unsigned long)period, (unsigned long)(irqs_x10 / 10), (unsigned long)(irqs_x10 % 10));
+         if (ps->irq.count) {
+             uint64_t avg = ps->irq.total / ps->irq.count;
+             uint32_t pct_x100 = (uint32_t)(avg * SAMPLE_RATE * 10000u / ((uint64_t)period * sys_clk));
+             printf("  %10lu  %5lu.%02lu", (unsigned long)avg, (unsigned long)(pct_x100 / 100),
+                    (unsigned long)(pct_x100 % 100));
+         } else {
+             printf("  %10s  %8s", "--", "--");
          }
-         
-         // --- Lógica de Mezcla de Audio ---
+         if (ps->fill.items) {
+             uint32_t pct_x10 = (uint32_t)(ps->fill.total * 1000u / ps->fill.items * SAMPLE_RATE / sys_clk);
+             printf("  %8lu.%lu", (unsigned long)(pct_x10 / 10), (unsigned long)(pct_x10 % 10));
+         } else {
+             printf("  %10s", "--");
+         }
+         uint32_t theory_x10 = live_lookahead((uint16_t)period) * 10000u / SAMPLE_RATE;
+         if (ps->latency_count) {
+             uint32_t worst_x10 = (uint32_t)((uint64_t)ps->worst_latency * 10000u / SAMPLE_RATE);
+             printf("  %8lu.%lu", (unsigned long)(worst_x10 / 10), (unsigned long)(worst_x10 % 10));
+         } else {
+             printf("  %10s", "--");
+         }
+         printf(" / %lu.%lu\n", (unsigned long)(theory_x10 / 10), (unsigned long)(theory_x10 % 10));
+     }
+ }
+ 
+ #if AUDIO_LZ
+ /**
+  * @brief Copia literales del banco LZ; las tandas largas, con DMA.
+  * @details Si origen y destino tienen la misma alineación, el canal copia
+  * palabras de 32 bits y los bytes sueltos de los extremos van con memcpy();
+  * si no, copia de byte en byte. La CPU espera a que termine: solo se usa al
+  * arrancar, antes de que el audio reserve sus canales.
+  */
+ void lz_dma_copy(uint8_t *dst, const uint8_t *src, size_t n) {
+     if (lz_dma_chan < 0 || n < LZ_DMA_MIN_LITERALS) {
+         memcpy(dst, src, n);
+         return;
+     }
+     dma_channel_config config = dma_channel_get_default_config(lz_dma_chan);
+     channel_config_set_read_increment(&config, true);
+     channel_config_set_write_increment(&config, true);
+     size_t unit = 1;
+     if ((((uintptr_t)dst ^ (uintptr_t)src) & 3) == 0) {
+         size_t head = (4 - ((uintptr_t)dst & 3)) & 3;
+         memcpy(dst, src, head);
+         dst += head;
+         src += head;
+         n -= head;
+         unit = 4;
+     }
+     channel_config_set_transfer_data_size(&config, unit == 4 ? DMA_SIZE_32 : DMA_SIZE_8);
+     size_t copied = n / unit * unit;
+     dma_channel_configure(lz_dma_chan, &config, dst, src, copied / unit, true);
+     lz_dma_bytes += copied;
+     dma_channel_wait_for_finish_blocking(lz_dma_chan);
+     memcpy(dst + copied, src + copied, n - copied); // Cola de una copia por palabras
+ }
+ 
+ /**
+  * @brief Descomprime el banco LZ a bank_sram y apunta cada sonido a su parte.
+  * @details Se llama antes de lanzar el núcleo 1 y de reservar los canales del
+  * audio; el canal de las copias se libera al terminar. Un sonido corrupto
+  * queda con largo 0 y no suena.
+  */
+ void bank_init() {
+     static const uint8_t *const banks[NUM_SOUNDS] = {kick_lz, snare_lz, hihat_lz};
+     static const uint32_t bank_bytes[NUM_SOUNDS] = {sizeof(kick_lz), sizeof(snare_lz), sizeof(hihat_lz)};
+     lz_dma_chan = dma_claim_unused_channel(false); // Sin canal libre, todo con memcpy()
+     uint16_t *out = bank_sram;
+     for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+         uint16_t length = slots[s].length;
+         uint64_t start = time_us_64();
+         bank_load_ok[s] = lz_bank_decode(banks[s], bank_bytes[s], out, length, lz_scratch);
+         bank_load_us[s] = (uint32_t)(time_us_64() - start);
+         slots[s].data = out;
+         if (!bank_load_ok[s]) slots[s].length = 0;
+         out += length;
+     }
+     if (lz_dma_chan >= 0) dma_channel_unclaim(lz_dma_chan);
+     lz_dma_chan = -1;
+ }
+ 
+ /**
+  * @brief Imprime, por sonido, la flash que ocupa el banco LZ, la SRAM que usa y lo que tardó en descomprimirse.
+  */
+ void print_bank_report() {
+     static const char *names[NUM_SOUNDS] = {"kick", "snare", "hihat"};
+     static const uint32_t bank_bytes[NUM_SOUNDS] = {sizeof(kick_lz), sizeof(snare_lz), sizeof(hihat_lz)};
+     static const uint32_t pcm_bytes[NUM_SOUNDS] = {KICK_SIZE * 2, SNARE_SIZE * 2, HIHAT_SIZE * 2};
+     uint32_t total_us = 0, total_flash = 0;
+     printf("Banco LZ:\n  sonido  flash (B)  PCM (B)  SRAM (B)  arranque (us)\n");
+     for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+         printf("  %-6s  %9lu  %7lu  %8lu  %13lu%s\n", names[s], (unsigned long)bank_bytes[s],
+                (unsigned long)pcm_bytes[s], (unsigned long)pcm_bytes[s], (unsigned long)bank_load_us[s],
+                bank_load_ok[s] ? "" : "  CORRUPTO");
+         total_us += bank_load_us[s];
+         total_flash += bank_bytes[s];
+     }
+     printf("  total: flash %lu B (ahorra %lu B), SRAM %lu B + %u B de bloque, %lu us, %lu B de literales por DMA\n",
+            (unsigned long)total_flash, (unsigned long)(sizeof(bank_sram) - total_flash), (unsigned long)sizeof(bank_sram),
+            LZ_SCRATCH_BYTES, (unsigned long)total_us, (unsigned long)lz_dma_bytes);
+ }
+ #endif
+ 
+ #if AUDIO_PREFIX_CACHE
+ /**
+  * @brief Copia a SRAM las primeras AUDIO_PREFIX_CACHE muestras de cada sonido y reserva el canal de precarga.
+  * @details Solo se copia el comienzo de cada sonido, no el de cada parte ni el
+  * final que ataca un sonido al revés: esas voces leen su ataque de la flash.
+  * El canal lee por el alias de la flash que no reserva líneas de la
+  * caché XIP, así que precargar colas no desaloja el código ni otros ataques.
+  * Con AUDIO_XIP_STREAM lee en cambio la FIFO del flujo XIP: el controlador
+  * trae de la flash las palabras pedidas en una sola ráfaga sin consultar la
+  * caché, y los fallos del código y de los ataques tienen prioridad sobre él.
+  */
+ void prefix_cache_init() {
+     for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+         uint32_t n = slots[s].length < AUDIO_PREFIX_CACHE ? slots[s].length : AUDIO_PREFIX_CACHE;
+         memcpy(prefix_cache[s], slots[s].data, n * sizeof(uint16_t));
+         slots[s].prefix = prefix_cache[s];
+     }
+     stream_dma_chan = dma_claim_unused_channel(true);
+     stream_dma_config = dma_channel_get_default_config(stream_dma_chan);
+ #if AUDIO_XIP_STREAM
+     channel_config_set_transfer_data_size(&stream_dma_config, DMA_SIZE_32);
+     channel_config_set_read_increment(&stream_dma_config, false); // Siempre la FIFO
+     channel_config_set_dreq(&stream_dma_config, DREQ_XIP_STREAM);
+ #else
+     channel_config_set_transfer_data_size(&stream_dma_config, DMA_SIZE_16);
+     channel_config_set_read_increment(&stream_dma_config, true);
+ #endif
+     channel_config_set_write_increment(&stream_dma_config, true);
+ }
+ 
+ /**
+  * @brief Arranca la carga de un trozo de cola de @p n muestras (STREAM_DMA_START de voice_stream.h).
+  * @details @p src y @p dst están alineados a 4 bytes; el flujo XIP copia
+  * palabras enteras, así que puede escribir una muestra de más en @p dst.
+  */
+ void stream_dma_start(uint16_t *dst, const uint16_t *src, uint32_t n) {
+ #if AUDIO_XIP_STREAM
+     uint32_t words = (n + 1) / 2;
+     while (!(xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY_BITS)) (void)xip_ctrl_hw->stream_fifo; // Restos de otro flujo
+     xip_ctrl_hw->stream_addr = (uint32_t)(uintptr_t)src;
+     xip_ctrl_hw->stream_ctr = words;
+     dma_channel_configure(stream_dma_chan, &stream_dma_config, dst, (const void *)XIP_AUX_BASE, words, true);
+ #else
+     uintptr_t addr = (uintptr_t)src;
+     if (addr >= XIP_BASE && addr < XIP_NOALLOC_BASE) addr += XIP_NOALLOC_BASE - XIP_BASE; // Sin reservar caché
+     dma_channel_configure(stream_dma_chan, &stream_dma_config, dst, (const void *)addr, n, true);
+ #endif
+ }
+ 
+ bool stream_dma_busy() {
+     return dma_channel_is_busy(stream_dma_chan);
+ }
+ #endif
+ 
+ /**
+  * @brief Prepara un bloque de la prueba de ataque: todas las voces arrancan juntas con la caché XIP vacía.
+  * @details La consola ('a') pide dos bloques seguidos. Con AUDIO_PREFIX_CACHE
+  * el primero lee los ataques directamente de la flash y el segundo de la caché
+  * de prefijo; sin ella, los dos leen de la flash. Antes de cada uno se cortan
+  * las voces y se vacía la caché XIP, así que ni las muestras ni el código del
+  * mezclador están en ella: es el peor caso de un golpe de todas las voces.
+  * Suenan el kick, el hi-hat y el redoblante en el resto de las voces a
+  * distintas alturas (el kick es monofónico y el hi-hat se corta a sí mismo).
+  * @return Índice de attack_perf para el bloque.
+  */
+ int attack_bench_begin() {
+     attack_bench_phase = attack_bench_phase - 1;
+     int cached = AUDIO_PREFIX_CACHE > 0 && attack_bench_phase == 0;
+ #if AUDIO_PREFIX_CACHE
+     for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+         slots[s].prefix = cached ? prefix_cache[s] : NULL; // Termina con la caché activa
+     }
+ #endif
+     voice_pool_clear(&voice_pool);
+     mixer_trigger(0, 0, 0);
+     mixer_trigger(2, 0, 0);
+     for (int v = 2; v < MAX_VOICES; ++v) mixer_trigger(1, v - MAX_VOICES / 2, 0);
+     xip_ctrl_hw->flush = 1;
+     (void)xip_ctrl_hw->flush; // La lectura espera a que termine el vaciado
+     return cached;
+ }
+ 
+ /**
+  * @brief Imprime el peor relleno de la prueba de ataque con y sin caché de prefijo.
+  * @details También el relleno con más fallos de la caché XIP desde el último
+  * 'r': con muchas voces largas sonando no debería crecer al cargar sus colas.
+  */
+ void print_attack_bench() {
+     printf("Cache XIP: peor relleno con %lu fallos\n", (unsigned long)worst_fill_xip_misses);
+     static const char *names[2] = {"ataque sin cache", "ataque con cache"};
+     for (uint8_t b = 0; b < 2; ++b) {
+         if (attack_perf[b].count == 0) continue;
+         perf_print(names[b], &attack_perf[b]);
+         printf("  peor relleno %lu us, %lu fallos de la cache XIP\n",
+                (unsigned long)((uint64_t)attack_perf[b].max * 1000000u / clock_get_hz(clk_sys)),
+                (unsigned long)attack_xip_misses[b]);
+     }
+ #if AUDIO_PREFIX_CACHE
+     printf("Cache de prefijo: %u muestras por sonido (%u B de SRAM), colas por %s; muestras del prefijo=%lu "
+            "de trozos=%lu cargadas tarde=%lu esperas al DMA=%lu\n",
+            AUDIO_PREFIX_CACHE, (unsigned)sizeof(prefix_cache), AUDIO_XIP_STREAM ? "el flujo XIP" : "el alias sin reserva",
+            (unsigned long)stream_prefetch.prefix_samples, (unsigned long)stream_prefetch.chunk_samples,
+            (unsigned long)stream_prefetch.stall_samples, (unsigned long)stream_prefetch.waits);
+ #endif
+ }
+ 
+ /**
+  * @brief Avanza la prueba de colas: varias voces largas sonando a la vez, sin el ataque.
+  * @details La consola ('l') la lanza. Cada paso dispara 1, 4, 8 y 16 voces
+  * del redoblante una octava o más abajo (duran el doble o más) y mide los
+  * bloques desde que terminó su ataque hasta que se apaga la primera. Con
+  * AUDIO_PREFIX_CACHE los pasos se repiten leyendo las colas directamente de la
+  * flash y precargándolas por DMA. Precargadas, el peor relleno por voz y los
+  * fallos de la caché XIP no deberían crecer con la cantidad de voces: el
+  * mezclador solo lee SRAM. Conviene parar los patrones antes de lanzarla.
+  * @param frames Cuadros del bloque que se va a rellenar.
+  * @return Índice de tail_perf para el bloque, o -1 si no se mide.
+  */
+ int tail_bench_next(uint16_t frames) {
+     int step = TAIL_BENCH_MODES * TAIL_BENCH_STEPS - tail_bench_left;
+     uint8_t voices = tail_bench_voices[step % TAIL_BENCH_STEPS];
+     if (tail_bench_frames == 0) {
+ #if AUDIO_PREFIX_CACHE
          for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
-             if (players[s].active) {
-                 if (players[s].position >= players[s].length) {
-                     players[s].active = false;
-                 } else {
-                     mixed_sample_value += players[s].data[players[s].position];
-                     players[s].position++;
-                     active_samples_count++;
-                 }
-             }
+             slots[s].prefix = step >= TAIL_BENCH_STEPS ? prefix_cache[s] : NULL; // Termina con la caché activa
          }
-         
-         // --- Normalización y Salida ---
-         uint16_t final_output;
-         if (active_samples_count > 0) {
-             final_output = (uint16_t)(mixed_sample_value / active_samples_count);
-             if (final_output > 4095) final_output = 4095; // Evita desbordamiento
+ #endif
+         voice_pool_clear(&voice_pool);
+         for (uint8_t v = 0; v < voices; ++v) mixer_trigger(1, -12 - (v & 3), 0);
+     } else if (voice_pool.num_active < voices) { // Se apagó la primera: siguiente paso
+         tail_bench_left = tail_bench_left - 1;
+         tail_bench_frames = 0;
+         return -1;
+     }
+     uint32_t elapsed = tail_bench_frames;
+     tail_bench_frames += frames;
+     return elapsed >= TAIL_BENCH_SKIP ? step : -1;
+ }
+ 
+ /**
+  * @brief Imprime el peor relleno de la prueba de colas para cada cantidad de voces.
+  */
+ void print_tail_bench() {
+     static const char *names[2] = {"de la flash", "precargadas"};
+     char name[32];
+     for (uint8_t m = 0; m < TAIL_BENCH_MODES; ++m) {
+         for (uint8_t k = 0; k < TAIL_BENCH_STEPS; ++k) {
+             const PerfCounter *pc = &tail_perf[m * TAIL_BENCH_STEPS + k];
+             if (pc->count == 0) continue;
+             uint32_t us = (uint32_t)((uint64_t)pc->max * 1000000u / clock_get_hz(clk_sys));
+             snprintf(name, sizeof(name), "colas %s %u voces", names[m], tail_bench_voices[k]);
+             perf_print(name, pc);
+             printf("  peor relleno %lu us (%lu us por voz), %lu fallos de la cache XIP\n", (unsigned long)us,
+                    (unsigned long)(us / tail_bench_voices[k]),
+                    (unsigned long)tail_xip_misses[m * TAIL_BENCH_STEPS + k]);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Imprime los vaciados del búfer y el mayor retraso de un relleno.
+  */
+ void print_underruns() {
+     printf("Vaciados: %lu rellenos tarde: %lu peor retraso: %lu muestras (%lu us) disparos tarde: %lu\n",
+            (unsigned long)underrun_count, (unsigned long)late_fills, (unsigned long)worst_late_samples,
+            (unsigned long)((uint64_t)worst_late_samples * 1000000u / SAMPLE_RATE), (unsigned long)late_triggers);
+ #if AUDIO_PREFIX_CACHE
+     printf("Colas cargadas tarde: %lu (%lu muestras, el mezclador espero al DMA)\n",
+            (unsigned long)stream_prefetch.stalls, (unsigned long)stream_prefetch.stall_samples);
+ #endif
+ }
+ 
+ /**
+  * @brief Imprime el margen de CPU con 8 y 16 voces a la frecuencia compilada y su proyección a las demás.
+  * @details La fila de SAMPLE_RATE es la medida, con el reloj del sistema que
+  * eligió el planificador (o el actual, sin plan). Las demás frecuencias usan
+  * el reloj que el planificador elegiría para ellas y los ciclos por cuadro
+  * medidos aquí, así que se marcan como proyectadas: no incluyen el remuestreo
+  * ni la espera de la flash a otro reloj (ver tools/mixer_bench.c para medirlas
+  * recompilando). Una columna sin mediciones se muestra con guiones.
+  */
+ void print_headroom_table() {
+     static const uint32_t rates[] = {16000, 24000, 32000, 44100, 48000};
+     static const uint8_t voices[] = {8, 16};
+     printf("Margen de CPU (compilado a %u Hz):\n  Hz      sis kHz  8 voces  16 voces\n", SAMPLE_RATE);
+     for (uint8_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) {
+         bool measured = rates[r] == SAMPLE_RATE;
+         uint32_t sys_khz;
+         if (measured) {
+             sys_khz = audio_clock_planned ? audio_clock_plan.sys_khz : clock_get_hz(clk_sys) / 1000;
          } else {
-             final_output = 2048; // Silencio (valor medio)
+             ClockPlan plan;
+             if (!clock_plan_search(rates[r], AUDIO_MIN_SYS_KHZ, AUDIO_MAX_SYS_KHZ, AUDIO_MIN_WRAP,
+                                    AUDIO_RATE_TOLERANCE_PPB, &plan)) {
+                 printf("  %-6lu  sin plan\n", (unsigned long)rates[r]);
+                 continue;
+             }
+             sys_khz = plan.sys_khz;
          }
-         buffer_ptr[i] = final_output;
+         printf("  %-6lu  %7lu", (unsigned long)rates[r], (unsigned long)sys_khz);
+         for (uint8_t v = 0; v < sizeof(voices) / sizeof(voices[0]); ++v) {
+             const PerfCounter *pc = &fill_perf[voices[v]];
+             if (pc->count == 0) {
+                 printf("  %7s", "--");
+                 continue;
+             }
+             // Porcentaje de CPU libre = 100 - ciclos por cuadro * frecuencia / reloj
+             uint64_t used = pc->total * rates[r] * 100 / (pc->items * sys_khz * 1000u);
+             printf("  %6ld%%", 100 - (long)used);
+         }
+         printf("%s\n", measured ? "" : "  proyectado");
+     }
+ }
+  
+ /**
+  * @brief Atiende los comandos de depuración recibidos por la consola USB.
+  * @details 'p' imprime los ciclos por bloque de audio para 0..MAX_VOICES voces
+  * activas, el coste del limitador frente a su presupuesto y el estado del banco de voces, 'r' reinicia los contadores y 'v'
+  * cambia el modo de robo de voces. 'm' o 's' seguidos del número de pista
+  * (0-2) alternan el silencio o el solo de esa pista. 'c' alterna el modo
+  * cromático de los botones e 'i' cambia la interpolación del instrumento
+  * seleccionado, y 'n' cambia el orden del modelado de ruido de la salida
+  * (0, 1 o 2). 'p' también muestra los ciclos por muestra de cada
+  * interpolación, el plan de reloj de audio y el margen de CPU con 8 y 16
+  * voces, medido a la frecuencia compilada y proyectado a las demás (y, con
+  * AUDIO_LZ, el informe de carga del banco).
+  * 'u' muestra solo los vaciados del búfer, que 'p' también incluye. 'b'
+  * seguido de 0-5 elige el periodo del DMA (AUDIO_PERIOD_MIN por 1, 2, 4 ... 32
+  * cuadros) y 'p' muestra la tabla de costo de interrupciones frente a latencia
+  * de cada periodo. 'a' lanza la prueba de ataque (ver attack_bench_begin()),
+  * cuyo peor relleno, con y sin la caché de prefijo, también muestra 'p', y
+  * 'l' la prueba de colas (ver tail_bench_next()), que 'p' muestra igual.
+  * Como los disparos, los ajustes y el reinicio de contadores llegan al motor
+  * por la cola de eventos; la consola avanza y muestra su propia copia de cada ajuste.
+  */
+ void handle_console() {
+     static int pending = 0; // Comando que espera el número de pista
+     int c = getchar_timeout_us(0);
+     if (c == PICO_ERROR_TIMEOUT) return;
+ 
+     if (pending == 'b') {
+         if (c >= '0' && c < '0' + PERIOD_SIZES) {
+             uint16_t period = (uint16_t)(AUDIO_PERIOD_MIN << (c - '0'));
+             post_event((EngineEvent){.type = EVENT_PERIOD, .value = period});
+             printf("Periodo: %u cuadros (%lu us)\n", period, (unsigned long)(period * 1000000u / SAMPLE_RATE));
+         }
+         pending = 0;
+     } else if (pending) {
+         if (c >= '0' && c < '0' + NUM_SOUNDS) {
+             uint32_t bit = 1u << (c - '0');
+             // Una sola escritura de 32 bits: el motor nunca ve un estado a medias
+             track_mute_solo = track_mute_solo ^ (pending == 'm' ? bit : bit << 16);
+             printf("Silencio: 0x%04lx Solo: 0x%04lx\n", (unsigned long)(track_mute_solo & 0xFFFF),
+                    (unsigned long)(track_mute_solo >> 16));
+         }
+         pending = 0;
+     } else if (c == 'm' || c == 's' || c == 'b') {
+         pending = c;
+     } else if (c == 'p') {
+         char name[24];
+         for (uint8_t v = 0; v <= MAX_VOICES; ++v) {
+             if (fill_perf[v].count == 0) continue;
+             snprintf(name, sizeof(name), "fill %u voces", v);
+             perf_print(name, &fill_perf[v]);
+         }
+         uint32_t budget = LIMITER_CYCLES_PER_SAMPLE_BUDGET * audio_period * AUDIO_CHANNELS;
+         perf_print("limitador", &limiter_perf);
+         static const char *interp_names[INTERP_MODE_COUNT] = {"sin interpolar", "lineal", "cubica"};
+         for (uint8_t m = 0; m < INTERP_MODE_COUNT; ++m) {
+             if (interp_perf[m].count) perf_print(interp_names[m], &interp_perf[m]);
+         }
+ #if VOICE_STREAMS
+         if (stream_perf.count) perf_print("ventanas", &stream_perf);
+ #endif
+         printf("Limitador: presupuesto=%lu ciclos/bloque (%s) envolvente=%ld\n", (unsigned long)budget,
+                limiter_perf.max <= budget ? "OK" : "EXCEDIDO", (long)master_limiter.envelope);
+         budget = REQUANT_CYCLES_PER_SAMPLE_BUDGET * audio_period * AUDIO_CHANNELS;
+         perf_print("salida", &requant_perf);
+         printf("Salida: orden=%u wrap=%u presupuesto=%lu ciclos/bloque (%s)\n", output_stage.order,
+                output_stage.wrap, (unsigned long)budget, requant_perf.max <= budget ? "OK" : "EXCEDIDO");
+         print_clock_plan();
+ #if AUDIO_LZ
+         print_bank_report();
+ #endif
+         print_headroom_table();
+         print_underruns();
+         print_period_table();
+         print_attack_bench();
+         print_tail_bench();
+         printf("Eventos descartados: %lu\n", (unsigned long)engine_events.dropped);
+         printf("Voces: activas=%u robadas=%lu descartadas=%lu desvanecidas=%lu cortadas=%lu modo=%d\n",
+                voice_pool.num_active, (unsigned long)voice_pool.steals, (unsigned long)voice_pool.drops,
+                (unsigned long)voice_pool.fades, (unsigned long)voice_pool.chokes, voice_pool.steal_mode);
+     } else if (c == 'r') {
+         post_event((EngineEvent){.type = EVENT_RESET_COUNTERS});
+         printf("Contadores reiniciados\n");
+     } else if (c == 'u') {
+         print_underruns();
+     } else if (c == 'a') {
+         post_event((EngineEvent){.type = EVENT_ATTACK_BENCH});
+         printf("Prueba de ataque: %u voces a la vez\n", MAX_VOICES);
+     } else if (c == 'l') {
+         post_event((EngineEvent){.type = EVENT_TAIL_BENCH});
+         printf("Prueba de colas: 1 a %u voces largas\n", MAX_VOICES);
+     } else if (c == 'v') {
+         steal_mode_setting = (StealMode)((steal_mode_setting + 1) % STEAL_MODE_COUNT);
+         post_event((EngineEvent){.type = EVENT_STEAL_MODE, .value = steal_mode_setting});
+         printf("Modo de robo de voces: %d\n", steal_mode_setting);
+     } else if (c == 'n') {
+         noise_order_setting = (uint8_t)((noise_order_setting + 1) % REQUANT_ORDER_COUNT);
+         post_event((EngineEvent){.type = EVENT_NOISE_ORDER, .value = noise_order_setting});
+         printf("Modelado de ruido de orden %u\n", noise_order_setting);
+     } else if (c == 'c') {
+         chromatic_mode = !chromatic_mode;
+         printf("Modo cromatico: %s\n", chromatic_mode ? "si" : "no");
+     } else if (c == 'i') {
+         uint8_t track = idx;
+         interp_setting[track] = (uint8_t)((interp_setting[track] + 1) % INTERP_MODE_COUNT);
+         post_event((EngineEvent){.type = EVENT_INTERP, .track = track, .value = interp_setting[track]});
+         printf("Interpolacion del instrumento %u: %u\n", track, interp_setting[track]);
      }
  }
  
  /**
-  * @brief Actualiza el tempo (BPM) y recalcula la duración de los pasos en muestras.
+  * @brief Reinicia los contadores de rendimiento, de la precarga y de vaciados. Solo desde el núcleo 1.
+  * @details Los escriben la mezcla y la interrupción del DMA, que corren en
+  * el núcleo 1; la consola ('r') lo pide con EVENT_RESET_COUNTERS.
+  */
+ void reset_counters() {
+     for (uint8_t v = 0; v <= MAX_VOICES; ++v) {
+         perf_reset(&fill_perf[v]);
+     }
+     perf_reset(&limiter_perf);
+     perf_reset(&requant_perf);
+     for (uint8_t m = 0; m < INTERP_MODE_COUNT; ++m) {
+         perf_reset(&interp_perf[m]);
+     }
+ #if VOICE_STREAMS
+     perf_reset(&stream_perf);
+ #endif
+ #if AUDIO_PREFIX_CACHE
+     stream_prefetch.prefix_samples = stream_prefetch.chunk_samples = 0;
+     stream_prefetch.stall_samples = stream_prefetch.stalls = stream_prefetch.waits = 0;
+ #endif
+     for (uint8_t b = 0; b < 2; ++b) {
+         perf_reset(&attack_perf[b]);
+         attack_xip_misses[b] = 0;
+     }
+     for (uint8_t t = 0; t < TAIL_BENCH_MODES * TAIL_BENCH_STEPS; ++t) {
+         perf_reset(&tail_perf[t]);
+         tail_xip_misses[t] = 0;
+     }
+     worst_fill_xip_misses = 0;
+     underrun_count = 0;
+     late_fills = 0;
+     worst_late_samples = 0;
+     late_triggers = 0;
+     for (uint8_t i = 0; i < PERIOD_SIZES; ++i) {
+         period_stats[i] = (PeriodStats){0};
+     }
+ }
+ 
+ /**
+  * @brief Actualiza el tempo (BPM) del reloj del secuenciador.
+  * @details La duración del paso se calcula en punto fijo 32.32 (ver tempo.h),
+  * sin truncar a muestras enteras, y el paso en curso conserva su progreso.
   * @param new_bpm El nuevo valor de Beats Per Minute.
   */
  void update_tempo(uint32_t new_bpm) {
      if (new_bpm == 0) new_bpm = 1; // Evita división por cero
      current_bpm = new_bpm;
- 
-     // Calcula cuántas muestras de audio corresponden a cada paso (semicorchea) del patrón
-     float beats_per_step = 1.0f / 4.0f; // 4 semicorcheas por pulso (beat)
-     float samples_per_step = ((float)SAMPLE_RATE * 60.0f * beats_per_step) / (float)current_bpm;
- 
-     pattern_samples_per_step = (size_t)samples_per_step;
-     if (pattern_samples_per_step == 0) pattern_samples_per_step = 1;
+     tempo_set_bpm(&sequencer_clock, SAMPLE_RATE, current_bpm);
  }
@@ -0,0 +1,568 @@
+/**
+ * @file mixer.h
+ * @brief Motor de mezcla por bloques y avance del secuenciador.
+ * @details El búfer se renderiza en tramos: cada tramo termina en el siguiente
+ * límite de paso del patrón o al final del búfer, lo que ocurra antes. Dentro de
+ * un tramo cada voz se mezcla en un bucle propio sin comprobaciones del
+ * secuenciador, y los disparos del patrón solo se evalúan en los puntos de corte.
+ * Los disparos en vivo programados con mixer_trigger_at() también cortan el
+ * tramo, así que empiezan en su cuadro exacto y no al inicio del búfer.
+ * Solo se recorren las voces de la lista activa del banco (ver voice_pool.h).
+ *
+ * La mezcla es en punto fijo: cada voz aplica su ganancia Q15 (velocidad ×
+ * volumen de pista × volumen maestro) en int32, y la suma pasa por el limitador
+ * suave del bus maestro (ver limiter.h) con MIX_FRAC_BITS bits fraccionarios. La
+ * etapa de salida (ver requantizer.h) la lleva al wrap del PWM con modelado de
+ * ruido y una única saturación final, sin divisiones ni flotantes por muestra.
+ *
+ * Las máscaras de silencio y solo (track_mute_solo) se leen una vez por bloque y
+ * se aplican al disparar: una pista muda no llega a ocupar voz ni a costar tiempo
+ * de mezcla. Si la máscara cambia, las voces de las pistas que dejan de sonar se
+ * desvanecen al comienzo del bloque siguiente.
+ *
+ * Las voces a su altura original usan el bucle entero más simple; las
+ * transpuestas avanzan en 16.16 con el modo de interpolación de su sonido
+ * (ver pitch.h). Si el banco de muestras tiene otra frecuencia que la salida
+ * (ver audio_config.h), todas las voces avanzan además con BANK_INCREMENT.
+ *
+ * Con AUDIO_STEREO el acumulador guarda pares izquierdo/derecho intercalados y
+ * cada voz suma con sus dos ganancias ya paneadas; el limitador ve ambos canales
+ * como un solo bloque, así que su reducción es la misma en los dos.
+ *
+ * Las voces de sonidos ADPCM, empaquetados o PCM con caché de prefijo (con
+ * VOICE_STREAMS) leen de su ventana: mix_stream_voice() la rellena en tandas
+ * de VOICE_STREAM_RUN muestras y mezcla cada trozo con los bucles de las voces
+ * PCM; antes de cada voz atiende la cola de trozos que precarga el DMA.
+ *
+ * Antes de escribir la salida, fill_and_mix_buffer() pide el búfer con
+ * MIXER_OUTPUT_CLAIM(); main.c la redefine antes de incluir este archivo para
+ * descartar el bloque si ya empezó a sonar (ver claim_output_block()). En el
+ * host la salida siempre llega a tiempo.
+ * No depende del SDK de la Pico, por lo que también compila en el host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sampler.h"
+#include "tempo.h"
+#include "voice_pool.h"
+#include "limiter.h"
+
+#ifndef MIXER_OUTPUT_CLAIM
+#define MIXER_OUTPUT_CLAIM() true
+#endif
+
+#define SAMPLE_MIDPOINT 2048   ///< Nivel de silencio de las muestras y de la salida de 12 bits.
+#define UNDERRUN_FADE_SHIFT 5  ///< log2 de la rampa a silencio tras un vaciado y de la entrada al recuperarse.
+#define UNDERRUN_FADE_SAMPLES (1 << UNDERRUN_FADE_SHIFT)
+
+static int32_t mix_accum[AUDIO_PERIOD_MAX * AUDIO_CHANNELS]; ///< Suma de las voces activas por muestra y canal (Q15).
+static uint16_t master_gain = Q15_ONE;       ///< Volumen maestro (Q15).
+static Limiter master_limiter;               ///< Limitador del bus maestro.
+static uint16_t fade_ramp[FADE_SAMPLES];     ///< Rampa de desvanecimiento (Q15, de 1 a 0).
+static uint16_t audible_tracks = 0xFFFF;     ///< Pistas que pueden disparar en el bloque actual.
+/// Escala al wrap del PWM con modelado de ruido; el wrap se ajusta con mixer_set_output_max().
+static Requantizer output_stage = {.wrap = PWM_WRAP, .order = REQUANT_FIRST_ORDER};
+static volatile bool output_fade_in = false; ///< El siguiente bloque entra con rampa tras un vaciado.
+
+#ifdef PERF_SYSTICK_MASK // perf.h incluido antes: se mide el coste del limitador y de cada interpolación
+PerfCounter limiter_perf;
+PerfCounter requant_perf;
+PerfCounter interp_perf[INTERP_MODE_COUNT];
+#if VOICE_STREAMS
+PerfCounter stream_perf; ///< Rellenos de las ventanas; los elementos son las muestras decodificadas.
+#endif
+#define MIXER_PERF_BEGIN(start) uint32_t start = perf_now()
+#define MIXER_PERF_END(counter, start, items) perf_record_items(&(counter), start, items)
+#else
+#define MIXER_PERF_BEGIN(start)
+#define MIXER_PERF_END(counter, start, items)
+#endif
+
+// Suma de una muestra ya centrada de la voz en la posición i del acumulador
+#if AUDIO_STEREO
+#define MIX_GAINS(v) int32_t gain_l = (v)->gain_l, gain_r = (v)->gain_r
+#define MIX_ADD(acc, i, x) do { \
+        int32_t x_ = (x); \
+        (acc)[2 * (i)] += x_ * gain_l; \
+        (acc)[2 * (i) + 1] += x_ * gain_r; \
+    } while (0)
+#else
+#define MIX_GAINS(v) int32_t gain = (v)->gain
+#define MIX_ADD(acc, i, x) ((acc)[i] += (x) * gain)
+#endif
+
+/**
+ * @brief Prepara el estado del mezclador; se llama una vez al arrancar.
+ */
+static void mixer_init(void) {
+    limiter_init(&master_limiter);
+    // Medio coseno: arranca casi en 1 y termina casi en 0 sin escalones
+    for (int k = 0; k < FADE_SAMPLES; ++k) {
+        float w = 0.5f * (1.0f + cosf(3.14159265f * (float)(k + 1) / (float)(FADE_SAMPLES + 1)));
+        fade_ramp[k] = (uint16_t)(w * (float)Q15_ONE + 0.5f);
+    }
+}
+static TempoClock sequencer_clock;           ///< Reloj de pasos del patrón (ver tempo.h).
+static VoicePool voice_pool;                 ///< Voces polifónicas del motor.
+
+/**
+ * @brief Fija el wrap del PWM, que es el nivel de salida máximo (ver audio_clock_init() en main.c).
+ */
+static inline void mixer_set_output_max(uint16_t wrap) {
+    requantizer_init(&output_stage, wrap, output_stage.order); // El error guardado era de otra escala
+}
+
+/**
+ * @brief Incremento 16.16 de una voz transpuesta @p semitones semitonos, incluido el remuestreo del banco.
+ */
+static inline uint32_t mixer_increment(int semitones) {
+#if BANK_RESAMPLE
+    return (uint32_t)(((uint64_t)pitch_increment(semitones) * BANK_INCREMENT) >> PITCH_FRAC_BITS);
+#else
+    return pitch_increment(semitones);
+#endif
+}
+
+/**
+ * @brief Avanza el patrón un paso y reinicia los sonidos marcados en él.
+ * @details Un sonido dividido en partes toca la parte que corresponde al paso en
+ * el orden de reproducción, así un loop cortado en 16 se reconstruye marcando
+ * el patrón completo.
+ */
+static void sequencer_step(void) {
+    pattern_index = (pattern_index + 1) % 16; // Avanza y cicla el índice del patrón
+
+    uint16_t current_step_bit_mask = (1u << (15 - pattern_index));
+    beat_index = 15 - pattern_index;
+
+    // Dispara los sonidos si el bit correspondiente está activo en el patrón
+    for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+        if ((patterns[s] & current_step_bit_mask) && (audible_tracks & (1u << s))) {
+            voice_pool_trigger(&voice_pool, s, &slots[s], Q15_ONE, master_gain, mixer_increment(0), pattern_index);
+        }
+    }
+}
+
+/**
+ * @brief Mezcla un tramo contiguo de una voz sobre el acumulador.
+ * @param voice Voz activa a mezclar.
+ * @param acc Acumulador de mezcla en la posición de inicio del tramo.
+ * @param n Número de cuadros del tramo; no supera lo que le queda a la voz.
+ */
+static inline void mix_voice_run(Voice *voice, int32_t *acc, size_t n) {
+    const uint16_t *src = voice->player.data + voice->player.position;
+    MIX_GAINS(voice);
+    for (size_t i = 0; i < n; ++i) {
+        MIX_ADD(acc, i, (int32_t)src[i] - SAMPLE_MIDPOINT);
+    }
+    voice->player.position += n;
+}
+
+/**
+ * @brief Igual que mix_voice_run() para una voz a altura original que suena al revés.
+ */
+static void mix_voice_run_reverse(Voice *voice, int32_t *acc, size_t n) {
+    const uint16_t *src = voice->player.data - voice->player.position;
+    MIX_GAINS(voice);
+    for (size_t i = 0; i < n; ++i) {
+        MIX_ADD(acc, i, (int32_t)src[-(int32_t)i] - SAMPLE_MIDPOINT);
+    }
+    voice->player.position += n;
+}
+
+/**
+ * @brief Hermite de 4 puntos con coeficientes duplicados y fracción @p f en Q14 para no desbordar int32.
+ */
+static inline int32_t hermite4(int32_t xm1, int32_t x0, int32_t x1, int32_t x2, int32_t f) {
+    int32_t c1 = x1 - xm1;
+    int32_t c2 = 2 * xm1 - 5 * x0 + 4 * x1 - x2;
+    int32_t c3 = x2 - xm1 + 3 * (x0 - x1);
+    int32_t y = ((((c3 * f) >> 14) + c2) * f) >> 14;
+    return x0 + (((y + c1) * f) >> 15);
+}
+
+/**
+ * @brief Mezcla un tramo de una voz transpuesta con su modo de interpolación.
+ * @details Las muestras se centran después de interpolar. Mientras la cúbica
+ * lee la primera muestra no hay anterior: se repite la primera, así el ataque
+ * suena entero.
+ * @param n Número de muestras de salida; la lectura no pasa del final permitido
+ * por el modo (ver interp_guard_after()).
+ */
+static void mix_voice_run_pitched(Voice *voice, int32_t *acc, size_t n) {
+    SamplePlayer *player = &voice->player;
+    const uint16_t *data = player->data;
+    uint32_t phase = ((uint32_t)player->position << PITCH_FRAC_BITS) | player->frac;
+    uint32_t inc = player->increment;
+    MIX_GAINS(voice);
+    int32_t d = player->stride; // Los vecinos se leen en el sentido de reproducción
+
+    switch (player->interp) {
+        case INTERP_CUBIC: {
+            size_t i = 0;
+            for (; i < n && phase < (1u << PITCH_FRAC_BITS); ++i) { // Primera muestra: x[-1] = x[0]
+                int32_t f = (int32_t)(phase & 0xFFFF) >> 2; // Q14
+                MIX_ADD(acc, i, hermite4(data[0], data[0], data[d], data[2 * d], f) - SAMPLE_MIDPOINT);
+                phase += inc;
+            }
+            for (; i < n; ++i) {
+                const uint16_t *x = data + (int32_t)(phase >> PITCH_FRAC_BITS) * d;
+                int32_t f = (int32_t)(phase & 0xFFFF) >> 2; // Q14
+                MIX_ADD(acc, i, hermite4(x[-d], x[0], x[d], x[2 * d], f) - SAMPLE_MIDPOINT);
+                phase += inc;
+            }
+            break;
+        }
+        case INTERP_LINEAR:
+            for (size_t i = 0; i < n; ++i) {
+                const uint16_t *x = data + (int32_t)(phase >> PITCH_FRAC_BITS) * d;
+                int32_t f = (int32_t)(phase & 0xFFFF) >> 1; // Q15
+                int32_t y = x[0] + ((((int32_t)x[d] - x[0]) * f) >> 15);
+                MIX_ADD(acc, i, y - SAMPLE_MIDPOINT);
+                phase += inc;
+            }
+            break;
+        case INTERP_DROP:
+        default:
+            for (size_t i = 0; i < n; ++i) {
+                MIX_ADD(acc, i, (int32_t)data[(int32_t)(phase >> PITCH_FRAC_BITS) * d] - SAMPLE_MIDPOINT);
+                phase += inc;
+            }
+            break;
+    }
+    player->position = (uint16_t)(phase >> PITCH_FRAC_BITS);
+    player->frac = (uint16_t)phase;
+}
+
+#if VOICE_STREAMS
+/**
+ * @brief Mezcla un tramo de una voz que lee de su ventana (ver voice_stream.h).
+ * @details Cada trozo llega hasta el final de la ventana o de la voz; entonces
+ * se rellena la ventana desde la muestra anterior a la actual, que la cúbica
+ * todavía lee. Los bucles de mezcla ven la posición relativa a la ventana.
+ * @return true si la voz terminó.
+ */
+static bool mix_stream_voice(Voice *voice, int32_t *acc, size_t n) {
+    SamplePlayer *player = &voice->player;
+    VoiceStream *stream = &voice->stream;
+    bool pitched = player->increment != PITCH_UNITY;
+    uint32_t guard = pitched ? interp_guard_after(player->interp) : 0;
+    if (player->length <= guard) return true;
+    uint32_t limit = (uint32_t)player->length - guard; // Igual que en mix_span()
+#if VOICE_STREAM_PREFETCH
+    voice_stream_prefetch_pump();
+#endif
+    size_t done = 0;
+    while (done < n) {
+        uint32_t pos = player->position;
+        if (pos >= limit) return true;
+        uint32_t end = (uint32_t)stream->wpos + stream->wlen;
+        if (pos + guard >= end) {
+            MIXER_PERF_BEGIN(stream_start);
+            voice_stream_refill(stream, pos > 0 ? pos - 1 : 0);
+            uint32_t refilled = (uint32_t)stream->wpos + stream->wlen;
+            MIXER_PERF_END(stream_perf, stream_start, refilled > end ? refilled - end : 0);
+            end = refilled;
+            if (pos + guard >= end) return true; // El tramo no tiene más muestras
+        }
+        uint32_t stop = end - guard < limit ? end - guard : limit; // Posiciones legibles: < stop
+        size_t run;
+        if (pitched) {
+            uint32_t phase = (pos << PITCH_FRAC_BITS) | player->frac;
+            run = pitch_steps((stop << PITCH_FRAC_BITS) - phase, player->increment);
+        } else {
+            run = stop - pos;
+        }
+        if (run > n - done) run = n - done;
+
+        player->position = (uint16_t)(pos - stream->wpos);
+        if (pitched) {
+            MIXER_PERF_BEGIN(interp_start);
+            mix_voice_run_pitched(voice, &acc[done * AUDIO_CHANNELS], run);
+            MIXER_PERF_END(interp_perf[player->interp], interp_start, run);
+        } else {
+            mix_voice_run(voice, &acc[done * AUDIO_CHANNELS], run);
+        }
+        player->position += stream->wpos;
+        done += run;
+    }
+    return player->position >= limit;
+}
+#endif
+
+/**
+ * @brief Mezcla todas las voces activas durante un tramo sin límites de paso.
+ * @param acc Acumulador de mezcla en la posición de inicio del tramo.
+ * @param n Número de cuadros del tramo.
+ */
+static void mix_span(int32_t *acc, size_t n) {
+    uint8_t i = 0;
+    while (i < voice_pool.num_active) {
+        Voice *voice = &voice_pool.voices[voice_pool.active[i]];
+        SamplePlayer *player = &voice->player;
+        bool finished;
+
+#if VOICE_STREAMS
+        if (voice->stream.bank) {
+            finished = mix_stream_voice(voice, acc, n);
+        } else
+#endif
+        if (player->increment == PITCH_UNITY) {
+            size_t remaining = player->length - player->position;
+            size_t run = remaining < n ? remaining : n;
+            if (player->stride > 0) {
+                mix_voice_run(voice, acc, run);
+            } else {
+                mix_voice_run_reverse(voice, acc, run);
+            }
+            finished = player->position >= player->length;
+        } else if (player->length <= interp_guard_after(player->interp)) {
+            finished = true; // Tramo más corto que los vecinos que lee el interpolador
+        } else {
+            // Muestras de salida hasta la última posición que el interpolador puede leer
+            uint32_t limit = (uint32_t)player->length - interp_guard_after(player->interp);
+            uint32_t phase = ((uint32_t)player->position << PITCH_FRAC_BITS) | player->frac;
+            uint32_t end = limit << PITCH_FRAC_BITS;
+            size_t avail = phase < end ? pitch_steps(end - phase, player->increment) : 0;
+            size_t run = avail < n ? avail : n;
+            MIXER_PERF_BEGIN(interp_start);
+            mix_voice_run_pitched(voice, acc, run);
+            MIXER_PERF_END(interp_perf[player->interp], interp_start, run);
+            finished = run == avail;
+        }
+
+        if (finished) {
+            voice_pool_release_at(&voice_pool, i); // La última voz ocupa esta posición
+        } else {
+            ++i;
+        }
+    }
+}
+
+/**
+ * @brief Mezcla las colas de desvanecimiento durante un tramo.
+ * @details Cada cola aplica la rampa tabulada encima de su ganancia y desaparece
+ * al terminar la rampa o la muestra.
+ * @param acc Acumulador de mezcla en la posición de inicio del tramo.
+ * @param n Número de muestras del tramo.
+ */
+static void mix_tails(int32_t *acc, size_t n) {
+    uint8_t t = 0;
+    while (t < voice_pool.num_tails) {
+        FadeTail *tail = &voice_pool.tails[t];
+        size_t run = tail->remaining < n ? tail->remaining : n;
+        const uint16_t *ramp = &fade_ramp[tail->ramp_pos];
+        uint8_t step = tail->ramp_step;
+        uint32_t phase = tail->phase;
+        int32_t d = tail->stride;
+        const uint16_t *src = tail->src;
+#if VOICE_STREAMS
+        if (!src) src = tail->window;
+#endif
+#if AUDIO_STEREO
+        int32_t tail_l = tail->gain_l, tail_r = tail->gain_r;
+#else
+        int32_t tail_gain = tail->gain;
+#endif
+        for (size_t i = 0; i < run; ++i) {
+#if AUDIO_STEREO
+            int32_t gain_l = (tail_l * *ramp) >> Q15_SHIFT;
+            int32_t gain_r = (tail_r * *ramp) >> Q15_SHIFT;
+#else
+            int32_t gain = (tail_gain * *ramp) >> Q15_SHIFT;
+#endif
+            MIX_ADD(acc, i, (int32_t)src[(int32_t)(phase >> PITCH_FRAC_BITS) * d] - SAMPLE_MIDPOINT);
+            ramp += step;
+            phase += tail->increment;
+        }
+        tail->phase = phase;
+        tail->ramp_pos += (uint8_t)(run * step);
+        tail->remaining -= (uint16_t)run;
+        if (tail->remaining == 0) {
+            voice_pool_drop_tail(&voice_pool, t); // La última cola ocupa esta posición
+        } else {
+            ++t;
+        }
+    }
+}
+
+/**
+ * @brief Escribe una caída corta a silencio para el audio que no llegue a tiempo.
+ * @details Cada canal baja en línea recta desde @p last (el cuadro que suena
+ * justo antes) hasta el centro del PWM en UNDERRUN_FADE_SAMPLES cuadros y se
+ * queda ahí. Ver mixer_prepare_fallback().
+ * @param dst Mitad del búfer a sobrescribir.
+ * @param n Cuadros de @p dst.
+ * @param last Cuadro que suena antes del primero de @p dst.
+ */
+static inline void mixer_write_fade(audio_frame_t *dst, size_t n, audio_frame_t last) {
+    const int32_t mid = ((int32_t)output_stage.wrap + 1) >> 1;
+    int32_t delta[AUDIO_CHANNELS];
+    for (uint8_t ch = 0; ch < AUDIO_CHANNELS; ++ch) {
+        delta[ch] = (int32_t)((last >> (16 * ch)) & 0xFFFF) - mid;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        int32_t left = i < UNDERRUN_FADE_SAMPLES ? (int32_t)(UNDERRUN_FADE_SAMPLES - 1 - i) : 0;
+        audio_frame_t frame = 0;
+        for (uint8_t ch = 0; ch < AUDIO_CHANNELS; ++ch) {
+            uint32_t level = (uint32_t)(mid + ((delta[ch] * left) >> UNDERRUN_FADE_SHIFT));
+            frame |= (audio_frame_t)(level << (16 * ch));
+        }
+        dst[i] = frame;
+    }
+}
+
+/**
+ * @brief Deja en la mitad que acaba de liberarse una caída a silencio por si su bloque no llega a tiempo.
+ * @details Se llama desde la interrupción del DMA cuando empieza a sonar el
+ * bloque @p playing: la otra mitad guardará el bloque siguiente. La caída
+ * sigue al último cuadro de @p playing, que ya no cambia (el relleno de un
+ * bloque que empezó a sonar se descarta). Si el bloque siguiente se rellena a
+ * tiempo la mezcla la sobrescribe; si no, el DMA encuentra la caída ya escrita
+ * y un vaciado nunca deja sonar cuadros de hace dos bloques. Tras un vaciado
+ * hay que poner output_fade_in para que el siguiente bloque mezclado entre
+ * con la rampa inversa.
+ * @param buffer Búfer de dos mitades de @p half_size cuadros.
+ * @param playing Bloque que empieza a sonar, en la mitad playing % 2.
+ * @param playing_n Cuadros de @p playing.
+ * @param next_n Cuadros del bloque siguiente si se lanza con la recarga actual.
+ * @return La mitad escrita.
+ */
+static inline audio_frame_t *mixer_prepare_fallback(audio_frame_t *buffer, size_t half_size, uint32_t playing,
+                                                    size_t playing_n, size_t next_n) {
+    const audio_frame_t *half = buffer + (playing & 1) * half_size;
+    audio_frame_t *next = buffer + ((playing + 1) & 1) * half_size;
+    mixer_write_fade(next, next_n, half[playing_n - 1]);
+    return next;
+}
+
+/**
+ * @brief Dispara un sonido en vivo, fuera del patrón.
+ * @param slot_index Sonido a disparar.
+ * @param semitones Transposición respecto a la altura original.
+ * @param slice Parte del sonido, si está dividido.
+ */
+static void mixer_trigger(uint8_t slot_index, int semitones, uint8_t slice) {
+    if (!(audible_tracks & (1u << slot_index))) return;
+    voice_pool_trigger(&voice_pool, slot_index, &slots[slot_index], Q15_ONE, master_gain,
+                       mixer_increment(semitones), slice);
+}
+
+#define LIVE_TRIGGER_SLOTS 8 ///< Disparos en vivo programados a la vez como máximo.
+
+typedef struct {
+    uint32_t offset;  ///< Cuadros desde el inicio del próximo bloque que se mezcle.
+    uint8_t slot;
+    int8_t semitones;
+    uint8_t slice;
+} LiveTrigger;
+
+static LiveTrigger live_triggers[LIVE_TRIGGER_SLOTS]; ///< Ordenados por 'offset'.
+static uint8_t num_live_triggers;
+
+/**
+ * @brief Programa un disparo en vivo en un cuadro concreto de los próximos bloques.
+ * @details fill_and_mix_buffer() corta la mezcla en ese cuadro igual que en los
+ * pasos del patrón, así que la voz empieza con precisión de muestra. Si el
+ * cuadro cae más allá del bloque que se mezcla, el disparo pasa al siguiente.
+ * @param offset Cuadros desde el inicio del próximo bloque.
+ * @return false si no quedaba sitio; entonces el sonido se dispara ya.
+ */
+static inline bool mixer_trigger_at(uint8_t slot_index, int semitones, uint8_t slice, uint32_t offset) {
+    if (num_live_triggers == LIVE_TRIGGER_SLOTS) {
+        mixer_trigger(slot_index, semitones, slice);
+        return false;
+    }
+    uint8_t i = num_live_triggers++;
+    while (i > 0 && live_triggers[i - 1].offset > offset) { // Los del mismo cuadro conservan su orden
+        live_triggers[i] = live_triggers[i - 1];
+        --i;
+    }
+    live_triggers[i] = (LiveTrigger){offset, slot_index, (int8_t)semitones, slice};
+    return true;
+}
+
+/**
+ * @brief Rellena un búfer con muestras de audio mezcladas según el patrón actual.
+ * @details Esta es la función principal del motor de audio. Divide el búfer en
+ * tramos delimitados por los pasos del patrón y por los disparos en vivo
+ * programados con mixer_trigger_at(), dispara los sonidos en el punto de corte,
+ * mezcla las voces activas tramo a tramo y finalmente
+ * limita y recuantiza el resultado al rango del PWM. Si MIXER_OUTPUT_CLAIM()
+ * rechaza el búfer, la mezcla se pierde pero las voces y el patrón avanzan
+ * igual, y la rampa de entrada queda para el bloque siguiente.
+ * @param buffer_ptr Puntero al búfer de audio que se va a rellenar.
+ * @param num_samples_to_fill Número de cuadros a generar (como máximo AUDIO_PERIOD_MAX).
+ * @return Falso si el búfer no se escribió.
+ */
+bool fill_and_mix_buffer(audio_frame_t *buffer_ptr, size_t num_samples_to_fill) {
+    size_t num_values = num_samples_to_fill * AUDIO_CHANNELS;
+    for (size_t i = 0; i < num_values; ++i) {
+        mix_accum[i] = 0;
+    }
+
+    // --- Silencio y Solo ---
+    uint16_t audible = tracks_audible(track_mute_solo);
+    if (audible != audible_tracks) {
+        voice_pool_silence_tracks(&voice_pool, audible);
+        audible_tracks = audible;
+    }
+
+    // --- Lógica del Secuenciador y Mezcla por Tramos ---
+    size_t done = 0;
+    uint8_t live = 0;
+    while (done < num_samples_to_fill) {
+        uint32_t samples_to_step = tempo_samples_to_step(&sequencer_clock);
+        if (samples_to_step == 0) {
+            sequencer_step();
+            tempo_consume_step(&sequencer_clock);
+            continue;
+        }
+        while (live < num_live_triggers && live_triggers[live].offset <= done) {
+            const LiveTrigger *t = &live_triggers[live++];
+            mixer_trigger(t->slot, t->semitones, t->slice);
+        }
+
+        size_t run = num_samples_to_fill - done;
+        if (run > samples_to_step) run = samples_to_step;
+        if (live < num_live_triggers && live_triggers[live].offset - done < run) run = live_triggers[live].offset - done;
+
+        mix_span(&mix_accum[done * AUDIO_CHANNELS], run);
+        mix_tails(&mix_accum[done * AUDIO_CHANNELS], run);
+        tempo_advance(&sequencer_clock, (uint32_t)run);
+        done += run;
+    }
+    // Los disparos que caen después de este bloque se guardan para el siguiente
+    uint8_t kept = 0;
+    for (uint8_t i = live; i < num_live_triggers; ++i) {
+        live_triggers[kept] = live_triggers[i];
+        live_triggers[kept++].offset -= (uint32_t)num_samples_to_fill;
+    }
+    num_live_triggers = kept;
+
+    // --- Limitador y Salida ---
+    for (size_t i = 0; i < num_values; ++i) {
+        mix_accum[i] >>= Q15_SHIFT - MIX_FRAC_BITS; // Unidades de 12 bits con signo y MIX_FRAC_BITS de fracción
+    }
+    MIXER_PERF_BEGIN(limiter_start);
+    limiter_process(&master_limiter, mix_accum, num_values);
+    MIXER_PERF_END(limiter_perf, limiter_start, (uint32_t)num_values);
+
+    if (!MIXER_OUTPUT_CLAIM()) return false; // El bloque ya suena con la caída de mixer_prepare_fallback()
+    if (output_fade_in) { // Tras un vaciado se vuelve desde el silencio de la caída
+        output_fade_in = false;
+        size_t ramp = num_samples_to_fill < UNDERRUN_FADE_SAMPLES ? num_samples_to_fill : UNDERRUN_FADE_SAMPLES;
+        for (size_t i = 0; i < ramp; ++i) {
+            for (uint8_t ch = 0; ch < AUDIO_CHANNELS; ++ch) {
+                mix_accum[i * AUDIO_CHANNELS + ch] = (mix_accum[i * AUDIO_CHANNELS + ch] * (int32_t)(i + 1)) >> UNDERRUN_FADE_SHIFT;
+            }
+        }
+    }
+
+    MIXER_PERF_BEGIN(requant_start);
+    requantize_block(&output_stage, mix_accum, (uint16_t *)buffer_ptr, num_samples_to_fill, AUDIO_CHANNELS);
+    MIXER_PERF_END(requant_perf, requant_start, (uint32_t)num_values);
+    return true;
+}
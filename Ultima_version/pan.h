@@ -0,0 +1,41 @@
+/**
+ * @file pan.h
+ * @brief Paneo de potencia constante para la salida estéreo.
+ * @details La posición va de -PAN_RANGE (izquierda) a +PAN_RANGE (derecha). Las
+ * ganancias de cada canal salen de una tabla de sin(θ) con θ en [0, π/2], de
+ * modo que L² + R² se mantiene constante y el centro queda a -3 dB. No depende
+ * del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define PAN_RANGE 64 ///< Posición extrema a cada lado; 0 es el centro.
+
+/// sin(k/(2·PAN_RANGE) · π/2) en Q15 para k = 0..2·PAN_RANGE.
+static const uint16_t pan_gain_table[2 * PAN_RANGE + 1] = {
+        0,   402,   804,  1206,  1608,  2009,  2411,  2811,  3212,
+     3612,  4011,  4410,  4808,  5205,  5602,  5998,  6393,  6787,
+     7180,  7571,  7962,  8351,  8740,  9127,  9512,  9896, 10279,
+    10660, 11039, 11417, 11793, 12167, 12540, 12910, 13279, 13646,
+    14010, 14373, 14733, 15091, 15447, 15800, 16151, 16500, 16846,
+    17190, 17531, 17869, 18205, 18538, 18868, 19195, 19520, 19841,
+    20160, 20475, 20788, 21097, 21403, 21706, 22006, 22302, 22595,
+    22884, 23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+    25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020, 27246,
+    27467, 27684, 27897, 28106, 28311, 28511, 28707, 28899, 29086,
+    29269, 29448, 29622, 29792, 29957, 30118, 30274, 30425, 30572,
+    30715, 30853, 30986, 31114, 31238, 31357, 31471, 31581, 31686,
+    31786, 31881, 31972, 32058, 32138, 32214, 32286, 32352, 32413,
+    32470, 32522, 32568, 32610, 32647, 32679, 32706, 32729, 32746,
+    32758, 32766, 32768,
+};
+
+/**
+ * @brief Ganancias Q15 de los canales izquierdo y derecho para la posición @p pan (se satura al rango).
+ */
+static inline void pan_gains(int8_t pan, uint16_t *left, uint16_t *right) {
+    int32_t p = pan < -PAN_RANGE ? -PAN_RANGE : (pan > PAN_RANGE ? PAN_RANGE : pan);
+    *left = pan_gain_table[PAN_RANGE - p];
+    *right = pan_gain_table[PAN_RANGE + p];
+}
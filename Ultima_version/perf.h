@@ -0,0 +1,70 @@
+/**
+ * @file perf.h
+ * @brief Contadores de ciclos de CPU basados en SysTick.
+ * @details SysTick se configura como contador descendente de 24 bits a la
+ * frecuencia del procesador, suficiente para medir bloques de audio de hasta
+ * ~130 ms a 125 MHz. Los resultados se consultan por la consola USB.
+ */
+#pragma once
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/structs/systick.h"
+
+#define PERF_SYSTICK_MASK 0x00FFFFFFu
+
+typedef struct {
+    uint32_t last;   ///< Ciclos de la última medición.
+    uint32_t max;    ///< Peor caso observado.
+    uint64_t total;  ///< Suma de ciclos para calcular el promedio.
+    uint32_t count;  ///< Número de mediciones.
+    uint64_t items;  ///< Elementos procesados (p. ej. muestras), si se registran.
+} PerfCounter;
+
+/**
+ * @brief Arranca SysTick libre, con reloj del procesador y sin interrupción.
+ */
+static inline void perf_init(void) {
+    systick_hw->rvr = PERF_SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // ENABLE | CLKSOURCE (reloj del procesador)
+}
+
+static inline uint32_t perf_now(void) {
+    return systick_hw->cvr;
+}
+
+/**
+ * @brief Registra los ciclos transcurridos desde @p start.
+ */
+static inline void perf_record(PerfCounter *pc, uint32_t start) {
+    uint32_t cycles = (start - systick_hw->cvr) & PERF_SYSTICK_MASK;
+    pc->last = cycles;
+    if (cycles > pc->max) pc->max = cycles;
+    pc->total += cycles;
+    pc->count++;
+}
+
+/**
+ * @brief Registra una medición que procesó @p items elementos, para reportar ciclos por elemento.
+ */
+static inline void perf_record_items(PerfCounter *pc, uint32_t start, uint32_t items) {
+    perf_record(pc, start);
+    pc->items += items;
+}
+
+static inline void perf_reset(PerfCounter *pc) {
+    *pc = (PerfCounter){0};
+}
+
+void perf_print(const char *name, const PerfCounter *pc) {
+    uint32_t avg = pc->count ? (uint32_t)(pc->total / pc->count) : 0;
+    printf("%s: avg=%lu max=%lu last=%lu ciclos (n=%lu)\n", name,
+           (unsigned long)avg, (unsigned long)pc->max,
+           (unsigned long)pc->last, (unsigned long)pc->count);
+    if (pc->items) {
+        uint32_t per_item_x10 = (uint32_t)(pc->total * 10 / pc->items);
+        printf("  %lu.%lu ciclos por muestra\n", (unsigned long)(per_item_x10 / 10),
+               (unsigned long)(per_item_x10 % 10));
+    }
+}
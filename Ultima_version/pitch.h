@@ -0,0 +1,67 @@
+/**
+ * @file pitch.h
+ * @brief Tabla de semitonos y modos de interpolación para la reproducción con altura variable.
+ * @details Cada voz avanza por su muestra con un incremento en punto fijo 16.16
+ * por muestra de salida. El incremento sale de una tabla precalculada de
+ * razones 2^(n/12) para ±PITCH_RANGE semitonos, sin calcular potencias en
+ * tiempo de ejecución. No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define PITCH_FRAC_BITS 16
+#define PITCH_UNITY (1u << PITCH_FRAC_BITS) ///< Incremento de la altura original.
+#define PITCH_RANGE 24                      ///< Semitonos de la tabla hacia arriba y hacia abajo.
+/// Incremento de la nota más aguda de la tabla: una octava duplica la velocidad.
+#define PITCH_INCREMENT_MAX (PITCH_UNITY << (PITCH_RANGE / 12))
+_Static_assert(PITCH_RANGE % 12 == 0, "PITCH_INCREMENT_MAX supone octavas completas");
+
+/**
+ * @brief Modo de interpolación entre muestras al reproducir con altura distinta de la original.
+ */
+typedef enum {
+    INTERP_DROP = 0, ///< Muestra más cercana por debajo (sin interpolar).
+    INTERP_LINEAR,   ///< Lineal entre dos muestras.
+    INTERP_CUBIC,    ///< Hermite de 4 puntos.
+    INTERP_MODE_COUNT
+} InterpMode;
+
+/// Razón de frecuencia 2^(n/12) en 16.16 para n = -PITCH_RANGE..PITCH_RANGE.
+static const uint32_t semitone_increment[2 * PITCH_RANGE + 1] = {
+     16384,  17358,  18390,  19484,  20643,  21870,  23170,
+     24548,  26008,  27554,  29193,  30929,  32768,  34716,
+     36781,  38968,  41285,  43740,  46341,  49097,  52016,
+     55109,  58386,  61858,  65536,  69433,  73562,  77936,
+     82570,  87480,  92682,  98193, 104032, 110218, 116772,
+    123715, 131072, 138866, 147123, 155872, 165140, 174960,
+    185364, 196386, 208064, 220436, 233544, 247431, 262144,
+};
+
+/**
+ * @brief Incremento 16.16 para transponer @p semitones semitonos (se satura al rango de la tabla).
+ */
+static inline uint32_t pitch_increment(int semitones) {
+    if (semitones < -PITCH_RANGE) semitones = -PITCH_RANGE;
+    if (semitones > PITCH_RANGE) semitones = PITCH_RANGE;
+    return semitone_increment[semitones + PITCH_RANGE];
+}
+
+/**
+ * @brief Muestras de salida que tarda una voz de avance @p increment en recorrer @p span (16.16).
+ * @details Redondea hacia arriba sin sumar increment - 1, que desborda cuando
+ * @p span se acerca a 2^32 (una muestra de SAMPLE_LENGTH_MAX); la división
+ * sigue siendo de 32 bits, la que hace el divisor de la RP2040.
+ */
+static inline uint32_t pitch_steps(uint32_t span, uint32_t increment) {
+    return span / increment + (span % increment != 0);
+}
+
+/**
+ * @brief Muestras posteriores a la actual que lee cada modo de interpolación.
+ * @details La voz termina cuando a su posición entera le faltan menos muestras
+ * que estas, así el interpolador nunca lee fuera de la muestra.
+ */
+static inline uint16_t interp_guard_after(uint8_t mode) {
+    return mode == INTERP_CUBIC ? 2 : (mode == INTERP_LINEAR ? 1 : 0);
+}
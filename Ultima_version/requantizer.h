@@ -0,0 +1,91 @@
+/**
+ * @file requantizer.h
+ * @brief Etapa de salida: lleva la mezcla limitada al rango [0, wrap] del PWM con modelado de ruido.
+ * @details La entrada está en unidades de 12 bits con signo y MIX_FRAC_BITS bits
+ * fraccionarios (±2047 a fondo de escala). Al escalarla al wrap del PWM se
+ * calcula el nivel ideal con 16 bits fraccionarios, exacto porque
+ * 12 + MIX_FRAC_BITS = 16, y se redondea al nivel entero. El error de
+ * redondeo se realimenta para empujar el ruido de cuantización hacia Nyquist:
+ *  - orden 0: redondeo simple (ruido blanco);
+ *  - orden 1: función de transferencia del ruido 1 - z^-1;
+ *  - orden 2: (1 - z^-1)², más silencio en graves a cambio de más ruido agudo.
+ * El error guardado se limita a ±1 nivel para que el lazo no se desboque
+ * cuando la salida satura. No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MIX_FRAC_BITS 4 ///< Bits fraccionarios de la mezcla a la entrada del limitador y de esta etapa.
+#define REQUANT_FRAC_BITS (12 + MIX_FRAC_BITS) ///< Bits fraccionarios del nivel ideal de salida.
+#define REQUANT_HALF (1 << (REQUANT_FRAC_BITS - 1))
+#define REQUANT_ERROR_MAX (1 << REQUANT_FRAC_BITS) ///< Error realimentado máximo: un nivel.
+#define REQUANT_MAX_CHANNELS 2
+#define REQUANT_CYCLES_PER_SAMPLE_BUDGET 16 ///< Presupuesto de CPU de esta etapa por muestra.
+
+typedef enum {
+    REQUANT_ROUND = 0,  ///< Sin modelado de ruido.
+    REQUANT_FIRST_ORDER,
+    REQUANT_SECOND_ORDER,
+    REQUANT_ORDER_COUNT
+} RequantOrder;
+
+typedef struct {
+    uint16_t wrap;                        ///< Nivel máximo del PWM.
+    uint8_t order;                        ///< RequantOrder en uso.
+    int32_t e1[REQUANT_MAX_CHANNELS];     ///< Error de la muestra anterior, por canal.
+    int32_t e2[REQUANT_MAX_CHANNELS];     ///< Error de hace dos muestras, por canal.
+} Requantizer;
+
+/// Deja @p rq sin error acumulado, con el wrap y el orden dados.
+static inline void requantizer_init(Requantizer *rq, uint16_t wrap, uint8_t order) {
+    *rq = (Requantizer){.wrap = wrap, .order = order};
+}
+
+/**
+ * @brief Recuantiza un canal de un bloque intercalado.
+ * @param in Primera muestra del canal; las siguientes están cada @p stride.
+ * @param out Primer nivel de salida del canal, con el mismo @p stride.
+ */
+static void requantize_channel(Requantizer *rq, uint8_t ch, const int32_t *in, uint16_t *out, size_t n,
+                               size_t stride) {
+    const int32_t mid = 2048 << MIX_FRAC_BITS;
+    const int32_t scale = (int32_t)rq->wrap + 1;
+    const int32_t top = rq->wrap;
+    // Coeficientes del filtro de error: orden 0 (0, 0), orden 1 (1, 0), orden 2 (2, 1)
+    const int32_t c1 = rq->order == REQUANT_SECOND_ORDER ? 2 : (rq->order == REQUANT_FIRST_ORDER ? 1 : 0);
+    const int32_t c2 = rq->order == REQUANT_SECOND_ORDER ? 1 : 0;
+    int32_t e1 = rq->e1[ch], e2 = rq->e2[ch];
+
+    for (size_t i = 0; i < n; ++i, in += stride, out += stride) {
+        int32_t x = *in + mid;
+        if (x < 0) x = 0;
+        else if (x > (4095 << MIX_FRAC_BITS)) x = 4095 << MIX_FRAC_BITS;
+        int32_t v = x * scale - (c1 * e1 - c2 * e2); // Nivel ideal (REQUANT_FRAC_BITS) menos el error filtrado
+        int32_t q = (v + REQUANT_HALF) >> REQUANT_FRAC_BITS;
+        if (q < 0) q = 0;
+        else if (q > top) q = top;
+
+        int32_t e = (q << REQUANT_FRAC_BITS) - v;
+        if (e > REQUANT_ERROR_MAX) e = REQUANT_ERROR_MAX;
+        else if (e < -REQUANT_ERROR_MAX) e = -REQUANT_ERROR_MAX;
+        e2 = e1;
+        e1 = e;
+        *out = (uint16_t)q;
+    }
+    rq->e1[ch] = e1;
+    rq->e2[ch] = e2;
+}
+
+/**
+ * @brief Recuantiza un bloque de @p frames cuadros de @p channels canales intercalados.
+ * @param out Niveles de salida intercalados igual que la entrada. En estéreo es
+ * el búfer de cuadros de 32 bits visto como pares de 16 bits (la RP2040 es
+ * little-endian, así que el izquierdo queda en la mitad baja).
+ */
+static void requantize_block(Requantizer *rq, const int32_t *in, uint16_t *out, size_t frames, uint8_t channels) {
+    for (uint8_t ch = 0; ch < channels; ++ch) {
+        requantize_channel(rq, ch, in + ch, out + ch, frames, channels);
+    }
+}
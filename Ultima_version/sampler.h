@@ -1,26 +1,120 @@
-#include "pico/stdlib.h"
+#pragma once
 
-#define BUFFER_SIZE 128
-#define HALF_BUFFER_SIZE (BUFFER_SIZE / 2)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "audio_config.h"
 
+// El periodo (cuadros por bloque de DMA) se elige en ejecución entre
+// AUDIO_PERIOD_MIN y AUDIO_PERIOD_MAX. Cada mitad del búfer tiene sitio para
+// el mayor: la mitad inferior empieza en 0 y la superior en HALF_BUFFER_SIZE,
+// sea cual sea el periodo, así que un bloque nuevo nunca pisa al que suena.
+#define AUDIO_PERIOD_MIN 32
+#define AUDIO_PERIOD_MAX 1024
+#define AUDIO_PERIOD_DEFAULT 64
+#define HALF_BUFFER_SIZE AUDIO_PERIOD_MAX
+#define BUFFER_SIZE (2 * HALF_BUFFER_SIZE)
+#define NUM_SOUNDS          3       ///< Número total de sonidos (kick, snare, hi-hat).
+/// Muestras de un sonido como máximo: posiciones y largos son de 16 bits, y la
+/// fase 16.16 de una voz transpuesta guarda la posición en la parte entera
+/// (unos 2,7 s a 24 kHz). Un sonido más largo se divide en varios.
+#define SAMPLE_LENGTH_MAX 65535u
+#define Q15_SHIFT 15
+#define Q15_ONE (1u << Q15_SHIFT)     ///< Ganancia unitaria en Q15.
+
+#ifndef AUDIO_STEREO
+#define AUDIO_STEREO 0 ///< 1: salida estéreo por los dos canales del slice PWM.
+#endif
+#define AUDIO_CHANNELS (AUDIO_STEREO ? 2 : 1)
+
+#if AUDIO_STEREO
+// Un cuadro por escritura DMA de 32 bits: izquierdo en los bits 0-15 (canal A del
+// registro CC del PWM) y derecho en los bits 16-31 (canal B)
+typedef uint32_t audio_frame_t;
+#else
+typedef uint16_t audio_frame_t;
+#endif
 
-volatile bool current_buffer_is_upper_half = false;
 
 uint16_t patterns[3]= {
     0, // Kick pattern
     0, // Snare pattern
     0  // Hi-hat pattern
 };
-volatile uint8_t beat_index = 0; // Current beat index    
+volatile uint8_t beat_index = 0; // Current beat index
 volatile uint8_t pattern_index = 0;
-volatile uint16_t pattern_samples_per_step = 1;
-uint16_t sampler_buffer[BUFFER_SIZE];
+audio_frame_t sampler_buffer[BUFFER_SIZE];
 volatile uint16_t current_bpm = 60; // Beats per minute
+// Bits 0-15: pistas silenciadas; bits 16-31: pistas en solo. Una sola palabra para
+// que el motor de audio siempre lea una combinación coherente de ambas máscaras.
+volatile uint32_t track_mute_solo = 0;
 
 typedef struct{
-    const uint16_t *data;
-    uint16_t length;
-    uint16_t position;
+    const uint16_t *data; // Primera muestra que se reproduce (la última del tramo si va al revés)
+    uint16_t length;      // Muestras del tramo (como mucho SAMPLE_LENGTH_MAX)
+    uint16_t position;  // Parte entera de la posición de lectura, contada en el sentido de reproducción
+    uint16_t frac;      // Parte fraccionaria de la posición (16 bits)
+    uint32_t increment; // Avance por muestra de salida en 16.16 (PITCH_UNITY = altura original)
+    uint8_t interp;     // Modo de interpolación (InterpMode)
+    int8_t stride;      // +1 hacia adelante, -1 al revés
     uint8_t active;
 } SamplePlayer;
 
+typedef struct{
+    const uint16_t *data;
+    const uint8_t *adpcm; // Bloques IMA-ADPCM (ver adpcm.h) en lugar de 'data'; NULL = PCM
+    const uint32_t *packed; // Muestras de 12 bits empaquetadas (ver packed12.h) en lugar de 'data'
+    const uint16_t *prefix; // Copia en SRAM de las AUDIO_PREFIX_CACHE primeras muestras de 'data'; NULL = sin caché
+    uint16_t length;  // Muestras de 'data' (como mucho SAMPLE_LENGTH_MAX)
+    uint8_t priority; // Mayor valor = más importante al robar voces
+    bool protect;     // Sus voces no pueden ser robadas por otros sonidos
+    bool mono;        // Un redisparo desvanece el golpe anterior en lugar de superponerse
+    uint8_t choke_group; // Los sonidos del mismo grupo se cortan entre sí (0 = ninguno)
+    uint8_t interp;   // Interpolación al reproducir con otra altura (InterpMode)
+    uint16_t volume;  // Volumen de la pista (Q15)
+    int8_t pan;       // Posición estéreo, -PAN_RANGE (izquierda) a PAN_RANGE (derecha)
+    uint16_t start;   // Primera muestra del tramo a reproducir
+    uint16_t end;     // Fin del tramo (exclusivo); 0 = hasta el final de la muestra
+    bool reverse;     // Reproduce el tramo de atrás hacia adelante
+    uint8_t num_slices; // Partes en que se divide el tramo (0 o 1 = sin dividir)
+    const uint16_t *slice_marks; // Inicio de cada parte (num_slices entradas); NULL = partes iguales
+} SampleSlot;
+
+// Pistas que deben sonar: las que están en solo si hay alguna, si no las no silenciadas
+static inline uint16_t tracks_audible(uint32_t mute_solo) {
+    uint16_t solo = (uint16_t)(mute_solo >> 16);
+    return solo ? solo : (uint16_t)~mute_solo;
+}
+
+/**
+ * Resuelve el tramo [*start, *end) de la muestra que suena al disparar la parte
+ * @p slice de un sonido. Las marcas, si las hay, son posiciones absolutas en la
+ * muestra; cada parte termina donde empieza la siguiente o al final del tramo.
+ */
+static inline void sample_slot_region(const SampleSlot *slot, uint8_t slice, uint16_t *start, uint16_t *end) {
+    uint16_t s = slot->start < slot->length ? slot->start : slot->length;
+    uint16_t e = (slot->end && slot->end < slot->length) ? slot->end : slot->length;
+    if (e < s) e = s;
+    if (slot->num_slices > 1) {
+        slice %= slot->num_slices;
+        if (slot->slice_marks) {
+            uint16_t a = slot->slice_marks[slice];
+            uint16_t b = slice + 1 < slot->num_slices ? slot->slice_marks[slice + 1] : e;
+            s = a < s ? s : (a > e ? e : a);
+            e = b > e ? e : (b < s ? s : b);
+        } else {
+            uint32_t span = (uint32_t)(e - s);
+            uint16_t base = s;
+            s = (uint16_t)(base + span * slice / slot->num_slices);
+            e = (uint16_t)(base + span * (slice + 1u) / slot->num_slices);
+        }
+    }
+    *start = s;
+    *end = e;
+}
+
+static inline uint16_t q15_mul(uint16_t a, uint16_t b) {
+    return (uint16_t)(((uint32_t)a * b) >> Q15_SHIFT);
+}
+
+SampleSlot slots[NUM_SOUNDS]; // Muestra y ajustes de cada sonido
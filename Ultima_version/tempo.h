@@ -0,0 +1,76 @@
+/**
+ * @file tempo.h
+ * @brief Reloj de tempo del secuenciador con acumulador de fase en punto fijo 32.32.
+ * @details La duración de un paso (semicorchea) se guarda en muestras con 32 bits
+ * de parte fraccionaria, y la distancia al próximo paso arrastra el resto
+ * sub-muestra de un paso al siguiente. Así cada paso arranca en la primera
+ * muestra igual o posterior a su instante ideal, con error menor a una muestra
+ * que no se acumula aunque el patrón suene durante horas. No depende del SDK.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define TEMPO_FRAC_BITS 32
+#define TEMPO_ONE ((int64_t)1 << TEMPO_FRAC_BITS) ///< Una muestra en formato 32.32.
+
+typedef struct {
+    int64_t step_len;   ///< Duración de un paso en muestras (32.32).
+    int64_t until_step; ///< Distancia desde la muestra actual al próximo paso (32.32).
+} TempoClock;
+
+/**
+ * @brief Duración exacta de una semicorchea en muestras, en formato 32.32.
+ * @param sample_rate Frecuencia de muestreo en Hz.
+ * @param bpm Tempo en pulsos por minuto (distinto de cero).
+ */
+static inline int64_t tempo_step_len(uint32_t sample_rate, uint32_t bpm) {
+    // sample_rate * 60 / (4 * bpm), con 4 semicorcheas por pulso
+    return (int64_t)((((uint64_t)sample_rate * 15u) << TEMPO_FRAC_BITS) / bpm);
+}
+
+/**
+ * @brief Cambia el tempo conservando la fracción del paso ya recorrida.
+ * @details La distancia pendiente se reescala en proporción a la nueva duración
+ * del paso, así el próximo paso no salta ni se retrasa al mover el potenciómetro.
+ * En el primer uso el paso se dispara en la siguiente muestra.
+ */
+static inline void tempo_set_bpm(TempoClock *clock, uint32_t sample_rate, uint32_t bpm) {
+    int64_t new_len = tempo_step_len(sample_rate, bpm);
+    if (clock->step_len > 0 && clock->until_step > 0) {
+        // Se descartan 16 bits fraccionarios para que el producto quepa en 64 bits
+        uint64_t until = (uint64_t)clock->until_step >> 16;
+        uint64_t ratio_num = (uint64_t)new_len >> 16;
+        uint64_t ratio_den = (uint64_t)clock->step_len >> 16;
+        clock->until_step = (int64_t)((until * ratio_num / ratio_den) << 16);
+    } else {
+        clock->until_step = 0;
+    }
+    clock->step_len = new_len;
+}
+
+/**
+ * @brief Muestras enteras que faltan antes de la muestra en la que cae el próximo paso.
+ * @return 0 si el paso cae en la muestra actual; UINT32_MAX si aún no hay tempo.
+ */
+static inline uint32_t tempo_samples_to_step(const TempoClock *clock) {
+    if (clock->step_len <= 0) return UINT32_MAX;
+    if (clock->until_step <= 0) return 0;
+    return (uint32_t)((clock->until_step + TEMPO_ONE - 1) >> TEMPO_FRAC_BITS);
+}
+
+/**
+ * @brief Avanza el reloj @p n muestras; no debe cruzar el próximo paso.
+ */
+static inline void tempo_advance(TempoClock *clock, uint32_t n) {
+    clock->until_step -= (int64_t)n << TEMPO_FRAC_BITS;
+}
+
+/**
+ * @brief Consume el paso que cae en la muestra actual y programa el siguiente.
+ * @details El resto fraccionario (entre -1 y 0 muestras) se arrastra al siguiente
+ * paso, por lo que la rejilla ideal nunca se pierde.
+ */
+static inline void tempo_consume_step(TempoClock *clock) {
+    clock->until_step += clock->step_len;
+}
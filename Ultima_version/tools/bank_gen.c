@@ -0,0 +1,187 @@
+/**
+ * @file bank_gen.c
+ * @brief Herramienta de host: genera los bancos ADPCM, empaquetados o LZ a partir de audio_table.h e informa del resultado.
+ * @details Codifica cada sonido del banco PCM en el formato pedido y escribe un
+ * banco con los mismos nombres de tamaños y frecuencia, más un arreglo
+ * <sonido>_adpcm (adpcm.h), <sonido>_packed (packed12.h) o <sonido>_lz
+ * (lz_bank.h) por sonido. Para cada uno informa:
+ *  - bytes en flash del PCM (uint16_t) y del formato, la razón de compresión
+ *    y las líneas de 8 bytes de la caché XIP que ocupa el sonido;
+ *  - SNR de la muestra decodificada frente a la original, en dB ("exacto" si
+ *    coincide bit a bit; el empaquetado que no coincida es un error);
+ *  - tiempo de decodificación por muestra en el host. Los ciclos por muestra
+ *    en la Pico se ven con la consola ('p', contador "ventanas"); el banco LZ
+ *    se descomprime al arrancar y main.c informa de ese tiempo.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/bank_gen.c -o bank_gen -lm
+ *     ./bank_gen adpcm audio_table_adpcm.h
+ *     ./bank_gen packed audio_table_packed.h
+ *     ./bank_gen lz audio_table_lz.h
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "audio_table.h"
+#include "adpcm.h"
+#include "packed12.h"
+#include "lz_bank.h"
+
+#define XIP_CACHE_LINE 8 ///< Bytes por línea de la caché XIP del RP2040.
+
+typedef struct {
+    const char *name;
+    const uint16_t *data;
+    size_t length;
+} Sound;
+
+static const Sound sounds[] = {
+    {"kick", kick_data, KICK_SIZE},
+    {"snare", snare_data, SNARE_SIZE},
+    {"hihat", hihat_data, HIHAT_SIZE},
+};
+
+// --- Formatos ---
+static size_t adpcm_bytes(size_t n) { return ADPCM_BANK_BYTES(n); }
+static size_t adpcm_enc(const uint16_t *in, size_t n, void *out) {
+    adpcm_encode(in, n, out);
+    return ADPCM_BANK_BYTES(n);
+}
+static void adpcm_dec(const void *bank, size_t bytes, size_t n, uint16_t *out) {
+    (void)bytes;
+    AdpcmDecoder dec;
+    adpcm_seek_block(&dec, bank, 0);
+    adpcm_decode(&dec, out, n);
+}
+static size_t packed_bytes(size_t n) { return PACKED12_WORDS(n) * sizeof(uint32_t); }
+static size_t packed_enc(const uint16_t *in, size_t n, void *out) {
+    packed12_pack(in, n, out);
+    return packed_bytes(n);
+}
+static void packed_dec(const void *bank, size_t bytes, size_t n, uint16_t *out) {
+    (void)bytes;
+    packed12_unpack(bank, 0, out, n);
+}
+static size_t lz_bytes(size_t n) { return LZ_BANK_BOUND(n); }
+static size_t lz_enc(const uint16_t *in, size_t n, void *out) { return lz_bank_encode(in, n, out); }
+static void lz_dec(const void *bank, size_t bytes, size_t n, uint16_t *out) {
+    static uint8_t scratch[LZ_SCRATCH_BYTES];
+    if (!lz_bank_decode(bank, bytes, out, n, scratch)) memset(out, 0, n * sizeof(uint16_t));
+}
+
+typedef struct {
+    const char *mode;        ///< Argumento de la línea de órdenes.
+    const char *description; ///< Comentario del encabezado generado.
+    const char *suffix;      ///< Sufijo de los arreglos.
+    const char *type;        ///< Tipo de los elementos de los arreglos.
+    size_t elem;             ///< Bytes por elemento.
+    bool lossless;
+    size_t scratch;          ///< Búfer temporal para descomprimir al arrancar (0 = se decodifica al sonar).
+    size_t (*bound)(size_t n); ///< Bytes que puede ocupar el sonido codificado.
+    size_t (*encode)(const uint16_t *in, size_t n, void *out); ///< Devuelve los bytes escritos.
+    void (*decode)(const void *bank, size_t bytes, size_t n, uint16_t *out);
+} Format;
+
+static const Format formats[] = {
+    {"adpcm", "Bloques IMA-ADPCM de 256 muestras (ver adpcm.h).", "adpcm", "uint8_t", 1, false, 0, adpcm_bytes,
+     adpcm_enc, adpcm_dec},
+    {"packed", "Muestras de 12 bits empaquetadas, 8 por cada 3 palabras (ver packed12.h).", "packed", "uint32_t", 4,
+     true, 0, packed_bytes, packed_enc, packed_dec},
+    {"lz", "Bloques LZ de 512 muestras, descomprimidos a SRAM al arrancar (ver lz_bank.h).", "lz", "uint8_t", 1,
+     true, LZ_SCRATCH_BYTES, lz_bytes, lz_enc, lz_dec},
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    const Format *fmt = NULL;
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+        if (argc > 1 && strcmp(argv[1], formats[f].mode) == 0) fmt = &formats[f];
+    }
+    if (!fmt || argc < 3) {
+        printf("Uso: %s adpcm|packed|lz <encabezado de salida>\n", argv[0]);
+        return 1;
+    }
+    FILE *out = fopen(argv[2], "w");
+    if (!out) {
+        perror(argv[2]);
+        return 1;
+    }
+    fprintf(out, "// Generado por tools/bank_gen.c a partir de audio_table.h; no editar.\n");
+    fprintf(out, "// %s\n\n", fmt->description);
+    fprintf(out, "#define AUDIO_SAMPLE_RATE %d\n", AUDIO_SAMPLE_RATE);
+    fprintf(out, "#define SNARE_SIZE %d\n#define KICK_SIZE %d\n#define HIHAT_SIZE %d\n", SNARE_SIZE, KICK_SIZE,
+            HIHAT_SIZE);
+    fprintf(out, "#define AUDIO_BITS_PER_SAMPLE %d\n", AUDIO_BITS_PER_SAMPLE);
+
+    size_t pcm_total = 0, bank_total = 0;
+    int errors = 0;
+    printf("sonido   muestras  PCM (B)  %6s (B)  razon  lineas XIP  SNR (dB)  ns/muestra\n", fmt->mode);
+    for (size_t s = 0; s < sizeof(sounds) / sizeof(sounds[0]); ++s) {
+        const Sound *snd = &sounds[s];
+        uint8_t *bank = calloc(1, fmt->bound(snd->length));
+        uint16_t *decoded = malloc(snd->length * sizeof(uint16_t));
+        size_t bytes = fmt->encode(snd->data, snd->length, bank);
+
+        // Decodificación repetida para medir un tiempo estable
+        int reps = 200;
+        uint64_t start = now_ns();
+        for (int r = 0; r < reps; ++r) {
+            fmt->decode(bank, bytes, snd->length, decoded);
+        }
+        double ns = (double)(now_ns() - start) / ((double)reps * snd->length);
+
+        double signal = 0, noise = 0;
+        for (size_t i = 0; i < snd->length; ++i) {
+            double x = (double)snd->data[i] - 2048.0;
+            double e = (double)decoded[i] - snd->data[i];
+            signal += x * x;
+            noise += e * e;
+        }
+        char snr[16];
+        if (noise > 0) {
+            snprintf(snr, sizeof(snr), "%.1f", 10.0 * log10(signal / noise));
+            if (fmt->lossless) {
+                snprintf(snr, sizeof(snr), "ERROR");
+                ++errors;
+            }
+        } else {
+            snprintf(snr, sizeof(snr), "exacto");
+        }
+        size_t pcm = snd->length * sizeof(uint16_t);
+        printf("%-7s  %8zu  %7zu  %11zu  %5.2f  %4zu/%-5zu  %8s  %10.2f\n", snd->name, snd->length, pcm, bytes,
+               (double)pcm / bytes, (bytes + XIP_CACHE_LINE - 1) / XIP_CACHE_LINE,
+               (pcm + XIP_CACHE_LINE - 1) / XIP_CACHE_LINE, snr, ns);
+        pcm_total += pcm;
+        bank_total += bytes;
+
+        size_t count = bytes / fmt->elem;
+        fprintf(out, "\nconst %s %s_%s[%zu] = {", fmt->type, snd->name, fmt->suffix, count);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t v = 0;
+            memcpy(&v, bank + i * fmt->elem, fmt->elem); // Little endian, como el RP2040
+            if (fmt->elem == 1) {
+                fprintf(out, "%s%u%s", i % 16 ? "" : "\n", v, i + 1 < count ? ", " : "");
+            } else {
+                fprintf(out, "%s0x%08x%s", i % 8 ? "" : "\n", v, i + 1 < count ? ", " : "");
+            }
+        }
+        fprintf(out, "\n};\n");
+        free(bank);
+        free(decoded);
+    }
+    printf("total    %8s  %7zu  %11zu  %5.2f\n", "", pcm_total, bank_total, (double)pcm_total / bank_total);
+    if (fmt->scratch) {
+        printf("SRAM al arrancar: %zu B de banco + %zu B de bloque temporal\n", pcm_total, fmt->scratch);
+    }
+    fclose(out);
+    return errors != 0;
+}
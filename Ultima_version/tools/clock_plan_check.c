@@ -0,0 +1,121 @@
+/**
+ * @file clock_plan_check.c
+ * @brief Herramienta de host: comprueba la tabla de planes de clock_planner.h para cada frecuencia soportada.
+ * @details Busca el plan de cada frecuencia de audio con los límites de main.c
+ * (reloj de 100 a 133 MHz, wrap de al menos 10 bits, tolerancia de 1 ppm),
+ * imprime la tabla y comprueba, para cada fila:
+ *  - que el reloj del sistema sale exacto del PLL (cristal de 12 MHz, VCO y
+ *    divisores posteriores en rango) y que wrap y divisor están en rango;
+ *  - que la frecuencia obtenida, el error y la resolución coinciden con los
+ *    recalculados en coma flotante;
+ *  - contra una búsqueda exhaustiva independiente (todos los relojes del PLL,
+ *    todos los divisores y los dos wraps más cercanos): que ningún candidato
+ *    tiene menos error si el plan no es exacto, y si lo es, que ningún
+ *    candidato exacto tiene divisor entero cuando el plan no, ni más wrap con
+ *    el mismo tipo de divisor.
+ * También comprueba que una frecuencia imposible no devuelve plan.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/clock_plan_check.c -o clock_plan_check -lm
+ *     ./clock_plan_check
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "clock_planner.h"
+
+#define MIN_SYS_KHZ 100000 // Como en main.c
+#define MAX_SYS_KHZ 133000
+#define MIN_WRAP 1023
+#define TOLERANCE_PPB 1000
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("  FALLA: " __VA_ARGS__); printf("\n"); \
+            ++failures; \
+        } \
+    } while (0)
+
+/// Devuelve true si el PLL del sistema genera exactamente @p sys_khz.
+static bool pll_reaches(uint32_t sys_khz) {
+    for (uint32_t fbdiv = PLANNER_FBDIV_MIN; fbdiv <= PLANNER_FBDIV_MAX; ++fbdiv) {
+        uint32_t vco = PLANNER_REF_KHZ * fbdiv;
+        if (vco < PLANNER_VCO_MIN_KHZ || vco > PLANNER_VCO_MAX_KHZ) continue;
+        for (uint32_t pd1 = 1; pd1 <= PLANNER_POSTDIV_MAX; ++pd1) {
+            for (uint32_t pd2 = 1; pd2 <= PLANNER_POSTDIV_MAX; ++pd2) {
+                if (vco % (pd1 * pd2) == 0 && vco / (pd1 * pd2) == sys_khz) return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// Error en ppb de sys_khz / (div16 / 16 · (wrap + 1)) frente a @p rate_hz.
+static double error_ppb(uint32_t sys_khz, uint32_t div16, uint32_t top, uint32_t rate_hz) {
+    double rate = sys_khz * 1000.0 * 16.0 / ((double)div16 * top);
+    return (rate - rate_hz) / rate_hz * 1e9;
+}
+
+static void check_rate(uint32_t rate_hz) {
+    ClockPlan plan;
+    if (!clock_plan_search(rate_hz, MIN_SYS_KHZ, MAX_SYS_KHZ, MIN_WRAP, TOLERANCE_PPB, &plan)) {
+        printf("  %6u  sin plan\n", rate_hz);
+        CHECK(false, "%u Hz no tiene plan", rate_hz);
+        return;
+    }
+    uint32_t div16 = ((uint32_t)plan.div_int << 4) | plan.div_frac;
+    uint32_t top = (uint32_t)plan.wrap + 1;
+    double rate = plan.sys_khz * 1000.0 * 16.0 / ((double)div16 * top);
+    double err = error_ppb(plan.sys_khz, div16, top, rate_hz);
+    uint32_t bits = clock_plan_bits_x10(&plan);
+    printf("  %6u  %8u  %5u  %3u+%2u/16  %13.3f  %+10.3f  %2u.%u\n", rate_hz, plan.sys_khz, plan.wrap, plan.div_int,
+           plan.div_frac, rate, err / 1000.0, bits / 10, bits % 10);
+
+    CHECK(plan.sys_khz >= MIN_SYS_KHZ && plan.sys_khz <= MAX_SYS_KHZ && pll_reaches(plan.sys_khz),
+          "%u Hz: el PLL no genera %u kHz", rate_hz, plan.sys_khz);
+    CHECK(plan.wrap >= MIN_WRAP && plan.wrap <= PLANNER_WRAP_MAX, "%u Hz: wrap %u fuera de rango", rate_hz, plan.wrap);
+    CHECK(div16 >= PLANNER_DIV16_MIN && div16 <= PLANNER_DIV16_MAX, "%u Hz: divisor fuera de rango", rate_hz);
+    CHECK(fabs(plan.rate_mhz - rate * 1000.0) <= 1.0, "%u Hz: frecuencia %llu mHz, recalculada %.3f", rate_hz,
+          (unsigned long long)plan.rate_mhz, rate * 1000.0);
+    CHECK(fabs(plan.error_ppb - err) <= 1.0, "%u Hz: error %d ppb, recalculado %.1f", rate_hz, plan.error_ppb, err);
+    CHECK(bits == (uint32_t)floor(log2((double)top) * 10 + 1e-9), "%u Hz: %u décimas de bit, esperadas %.2f", rate_hz,
+          bits, log2((double)top) * 10);
+
+    // Búsqueda exhaustiva independiente
+    bool exact = fabs(err) <= TOLERANCE_PPB;
+    for (uint32_t sys = MIN_SYS_KHZ; sys <= MAX_SYS_KHZ; ++sys) {
+        if (!pll_reaches(sys)) continue;
+        for (uint32_t d = PLANNER_DIV16_MIN; d <= PLANNER_DIV16_MAX; ++d) {
+            uint32_t t0 = (uint32_t)((uint64_t)sys * 16000u / ((uint64_t)d * rate_hz));
+            for (uint32_t t = t0; t <= t0 + 1; ++t) {
+                if (t < MIN_WRAP + 1u || t > PLANNER_WRAP_MAX + 1u) continue;
+                double e = fabs(error_ppb(sys, d, t, rate_hz));
+                if (!exact) {
+                    CHECK(e >= fabs(err) - 1.0, "%u Hz: %u kHz, divisor %u/16, wrap %u da menos error (%.1f ppb)",
+                          rate_hz, sys, d, t - 1, e);
+                } else if (e <= TOLERANCE_PPB) {
+                    CHECK(!((d & 0xF) == 0 && plan.div_frac != 0),
+                          "%u Hz: %u kHz, divisor %u, wrap %u es exacto con divisor entero", rate_hz, sys, d >> 4, t - 1);
+                    CHECK(!(((d & 0xF) == 0) == (plan.div_frac == 0) && t > top),
+                          "%u Hz: %u kHz, divisor %u/16 es exacto con más wrap (%u)", rate_hz, sys, d, t - 1);
+                }
+            }
+        }
+    }
+}
+
+int main(void) {
+    static const uint32_t rates[] = {16000, 24000, 32000, 44100, 48000};
+    printf("Planes con reloj de %u a %u kHz, wrap >= %u, tolerancia %u ppb:\n", MIN_SYS_KHZ, MAX_SYS_KHZ, MIN_WRAP,
+           TOLERANCE_PPB);
+    printf("  %6s  %8s  %5s  %9s  %13s  %10s  %4s\n", "Hz", "sis kHz", "wrap", "divisor", "obtenida Hz", "ppm", "bits");
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) check_rate(rates[r]);
+
+    ClockPlan plan;
+    CHECK(!clock_plan_search(200000, MIN_SYS_KHZ, MAX_SYS_KHZ, MIN_WRAP, TOLERANCE_PPB, &plan),
+          "200 kHz no cabe con wrap de 10 bits y debería quedar sin plan");
+    printf("%s\n", failures ? "FALLA" : "OK");
+    return failures != 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file long_sound_length.c
+ * @brief Herramienta de host: duración de un sonido de SAMPLE_LENGTH_MAX muestras a cualquier altura.
+ * @details Reproduce con mix_span() un sonido de SAMPLE_LENGTH_MAX muestras de
+ * valor constante, así el acumulador es distinto de cero exactamente en los
+ * cuadros que suena la voz, hacia adelante y al revés, con cada modo de
+ * interpolación y de -PITCH_RANGE a +PITCH_RANGE semitonos. Comprueba:
+ *  - que suena ceil((largo - guarda) · 2^16 / incremento) cuadros, calculado
+ *    en 64 bits (la guarda es la de interp_guard_after(), 0 a altura original);
+ *  - que una voz cortada al principio, en medio y cerca del final deja una cola
+ *    de min(FADE_SAMPLES, lo que le queda) muestras.
+ * Con el largo máximo la fase final ronda 2^32: un redondeo que desborde corta
+ * la voz o deja una cola de largo erróneo.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/long_sound_length.c -o long_sound_length -lm
+ *     ./long_sound_length
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mixer.h"
+
+#define BLOCK AUDIO_PERIOD_MAX
+#define SOUND_LEVEL 1000 // Sobre SAMPLE_MIDPOINT
+
+static uint16_t sound[SAMPLE_LENGTH_MAX];
+static uint32_t failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            if (failures < 10) { printf("  FALLA: " __VA_ARGS__); printf("\n"); } \
+            ++failures; \
+        } \
+    } while (0)
+
+/// Cuadros de salida de una voz de @p increment desde la fase @p phase hasta @p end muestras.
+static uint64_t expected_steps(uint64_t phase, uint64_t end, uint32_t increment) {
+    uint64_t span = (end << PITCH_FRAC_BITS) - phase;
+    return (span + increment - 1) / increment;
+}
+
+/// Dispara el sonido y cuenta los cuadros en que suena.
+static uint64_t played_frames(uint32_t increment) {
+    voice_pool_clear(&voice_pool);
+    voice_pool_trigger(&voice_pool, 0, &slots[0], Q15_ONE, Q15_ONE, increment, 0);
+    uint64_t frames = 0;
+    while (voice_pool.num_active > 0) {
+        for (size_t i = 0; i < BLOCK * AUDIO_CHANNELS; ++i) mix_accum[i] = 0;
+        mix_span(mix_accum, BLOCK);
+        for (size_t i = 0; i < BLOCK; ++i) frames += mix_accum[i * AUDIO_CHANNELS] != 0;
+    }
+    return frames;
+}
+
+/// Corta la voz en la fase @p phase y devuelve el largo de su cola (0 si no la dejó).
+static uint32_t tail_length(uint32_t increment, uint32_t phase) {
+    voice_pool_clear(&voice_pool);
+    Voice *voice = voice_pool_trigger(&voice_pool, 0, &slots[0], Q15_ONE, Q15_ONE, increment, 0);
+    voice->player.position = (uint16_t)(phase >> PITCH_FRAC_BITS);
+    voice->player.frac = (uint16_t)phase;
+    voice_pool_fade_at(&voice_pool, 0, 1);
+    return voice_pool.num_tails ? voice_pool.tails[0].remaining : 0;
+}
+
+int main(void) {
+    for (uint32_t i = 0; i < SAMPLE_LENGTH_MAX; ++i) sound[i] = SAMPLE_MIDPOINT + SOUND_LEVEL;
+    voice_pool_init(&voice_pool, STEAL_OLDEST);
+    mixer_init();
+
+    static const char *names[INTERP_MODE_COUNT] = {"sin interpolar", "lineal", "cubica"};
+    static const int semitones[] = {-PITCH_RANGE, -7, 0, 5, 12, 19, PITCH_RANGE};
+    printf("Sonido de %u muestras, cuadros que suena:\n", SAMPLE_LENGTH_MAX);
+    printf("  %-16s %6s", "", "");
+    for (size_t k = 0; k < sizeof(semitones) / sizeof(semitones[0]); ++k) printf("  %+7d", semitones[k]);
+    printf("\n");
+    for (int reverse = 0; reverse <= 1; ++reverse) {
+        for (uint8_t mode = 0; mode < INTERP_MODE_COUNT; ++mode) {
+            slots[0] = (SampleSlot){.data = sound, .length = SAMPLE_LENGTH_MAX, .volume = Q15_ONE,
+                                    .interp = mode, .reverse = reverse};
+            printf("  %-16s %6s", names[mode], reverse ? "reves" : "");
+            for (size_t k = 0; k < sizeof(semitones) / sizeof(semitones[0]); ++k) {
+                uint32_t inc = mixer_increment(semitones[k]);
+                uint32_t guard = inc == PITCH_UNITY ? 0 : interp_guard_after(mode);
+                uint64_t expected = expected_steps(0, SAMPLE_LENGTH_MAX - guard, inc);
+                uint64_t frames = played_frames(inc);
+                printf("  %7llu", (unsigned long long)frames);
+                CHECK(frames == expected, "%s%s a %+d semitonos: %llu cuadros, esperados %llu", names[mode],
+                      reverse ? " al reves" : "", semitones[k], (unsigned long long)frames,
+                      (unsigned long long)expected);
+
+                // La cola lee sin interpolar, hasta el final de la muestra
+                static const uint32_t cuts[] = {0, 0x12345678u,
+                                                ((SAMPLE_LENGTH_MAX - 3u) << PITCH_FRAC_BITS) | 0x8000u};
+                for (size_t c = 0; c < sizeof(cuts) / sizeof(cuts[0]); ++c) {
+                    uint32_t phase = inc == PITCH_UNITY ? cuts[c] & ~(PITCH_UNITY - 1) : cuts[c];
+                    uint64_t left = expected_steps(phase, SAMPLE_LENGTH_MAX, inc);
+                    uint32_t want = left < FADE_SAMPLES ? (uint32_t)left : FADE_SAMPLES;
+                    uint32_t got = tail_length(inc, phase);
+                    CHECK(got == want, "%s a %+d semitonos, corte en la fase 0x%08x: cola de %u, esperada %u",
+                          names[mode], semitones[k], phase, got, want);
+                }
+            }
+            printf("\n");
+        }
+    }
+    printf("%s (%u fallas)\n", failures ? "FALLA" : "OK", failures);
+    return failures != 0;
+}
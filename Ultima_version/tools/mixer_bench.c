@@ -0,0 +1,318 @@
+/**
+ * @file mixer_bench.c
+ * @brief Herramienta de host: coste del mezclador (mixer.h) frente al render anterior.
+ * @details Mide con el reloj monotónico del host, como el mejor de varios
+ * lotes de bloques, el tiempo por bloque de AUDIO_PERIOD_DEFAULT cuadros:
+ *  - con 0 a 3 voces, el render anterior (comprobación del secuenciador,
+ *    recorrido de los tres sonidos y división por muestra) frente al render
+ *    por tramos, que corta el bloque en los pasos y mezcla cada voz en su
+ *    propio bucle, solo y con la etapa de salida de fill_and_mix_buffer()
+ *    (limitador y recuantizador con modelado de ruido, que el anterior no
+ *    tenía).
+ *  - el núcleo de mezcla de 3 voces sin secuenciador: la suma dividida por las
+ *    voces activas en cada muestra (el anterior de main.c), el volumen
+ *    flotante por muestra (el de sampler_wave/main.c) y la ganancia Q15 de
+ *    mix_voice_run() con un solo desplazamiento y saturación al final.
+ *  - una voz transpuesta BENCH_SEMITONES semitonos con cada modo de
+ *    interpolación de pitch.h, frente a la misma voz a su altura original.
+ *  - fill_and_mix_buffer() completo con 8 y 16 voces (la mitad transpuestas,
+ *    repartidas entre los tres modos de interpolación), como fracción del
+ *    tiempo real del bloque a OUTPUT_SAMPLE_RATE y margen que queda.
+ * Las muestras duran más que un lote y los patrones están vacíos, así que las
+ * voces suenan todo el lote; el reloj del secuenciador avanza igual a 120 BPM.
+ * Los tiempos son del host: en el dispositivo el coste en ciclos se confirma con
+ * los contadores de perf.h.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/mixer_bench.c -o mixer_bench -lm
+ *     ./mixer_bench [lotes]
+ * El margen de cada frecuencia se obtiene recompilando con ella y con la del
+ * banco, para que incluya el remuestreo como en el dispositivo:
+ *     for r in 16000 24000 32000 44100 48000; do
+ *         gcc -O2 -I. -DOUTPUT_SAMPLE_RATE=$r -DAUDIO_SAMPLE_RATE=24000 tools/mixer_bench.c -o mixer_bench -lm
+ *         ./mixer_bench
+ *     done
+ * Resultado en un x86-64 (gcc -O2, bloques de AUDIO_PERIOD_DEFAULT cuadros):
+ *       Hz   tiempo real  8 voces  margen  16 voces  margen
+ *    16000    4000000 ns  2646 ns  99.93%   3248 ns  99.92%
+ *    24000    2666667 ns  1819 ns  99.93%   3471 ns  99.87%
+ *    32000    2000000 ns  2068 ns  99.90%   3323 ns  99.83%
+ *    44100    1451247 ns  2035 ns  99.86%   3285 ns  99.77%
+ *    48000    1333333 ns  1998 ns  99.85%   3294 ns  99.75%
+ * Son tiempos del host y solo comparan frecuencias entre sí; el margen del
+ * dispositivo a la frecuencia compilada lo muestra 'p' en la consola.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mixer.h"
+
+#define BLOCK AUDIO_PERIOD_DEFAULT
+#define BLOCKS_PER_BATCH 500
+#define SOUND_SAMPLES 65000     // Más que un lote de bloques a cualquier altura de las medidas
+#define BENCH_BPM 120
+#define CORE_VOICES 3
+#define BENCH_SEMITONES 3
+
+static uint16_t sounds[NUM_SOUNDS][SOUND_SAMPLES];
+static audio_frame_t out[BLOCK];
+static uint16_t legacy_out[BLOCK];
+static uint32_t batches = 20;
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/// Prepara un lote: deja sonando lo que haga falta antes de medir.
+typedef void (*BenchSetup)(uint32_t voices);
+/// Renderiza un bloque.
+typedef void (*BenchBlock)(void);
+
+/**
+ * @brief Mejor tiempo por bloque, en ns, de @p batches lotes de BLOCKS_PER_BATCH bloques.
+ */
+static double bench(BenchSetup setup, BenchBlock block, uint32_t voices) {
+    double best = 0;
+    for (uint32_t b = 0; b < batches; ++b) {
+        setup(voices);
+        double start = now_ns();
+        for (uint32_t k = 0; k < BLOCKS_PER_BATCH; ++k) block();
+        double per_block = (now_ns() - start) / BLOCKS_PER_BATCH;
+        if (b == 0 || per_block < best) best = per_block;
+    }
+    return best;
+}
+
+// --- Render anterior (main.c antes del mezclador por bloques) ---
+
+typedef struct {
+    const uint16_t *data;
+    uint16_t length;
+    uint16_t position;
+    bool active;
+} LegacyPlayer;
+
+static LegacyPlayer players[NUM_SOUNDS];
+static size_t pattern_samples_per_step;
+
+/// Copia del render anterior: secuenciador y mezcla muestra a muestra, con división por las voces activas.
+static void legacy_fill(uint16_t *buffer_ptr, size_t num_samples_to_fill) {
+    static size_t samples_since_last_pattern_step = 0;
+
+    for (size_t i = 0; i < num_samples_to_fill; ++i) {
+        int32_t mixed_sample_value = 0;
+        int active_samples_count = 0;
+
+        samples_since_last_pattern_step++;
+        if (samples_since_last_pattern_step >= pattern_samples_per_step) {
+            samples_since_last_pattern_step = 0;
+            pattern_index = (pattern_index + 1) % 16;
+
+            uint16_t current_step_bit_mask = (1u << (15 - pattern_index));
+            beat_index = 15 - pattern_index;
+
+            for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+                if (patterns[s] & current_step_bit_mask) {
+                    players[s].active = true;
+                    players[s].position = 0;
+                }
+            }
+        }
+
+        for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+            if (players[s].active) {
+                if (players[s].position >= players[s].length) {
+                    players[s].active = false;
+                } else {
+                    mixed_sample_value += players[s].data[players[s].position];
+                    players[s].position++;
+                    active_samples_count++;
+                }
+            }
+        }
+
+        uint16_t final_output;
+        if (active_samples_count > 0) {
+            final_output = (uint16_t)(mixed_sample_value / active_samples_count);
+            if (final_output > 4095) final_output = 4095;
+        } else {
+            final_output = SAMPLE_MIDPOINT;
+        }
+        buffer_ptr[i] = final_output;
+    }
+}
+
+static void legacy_setup(uint32_t voices) {
+    for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+        players[s] = (LegacyPlayer){.data = sounds[s], .length = SOUND_SAMPLES, .active = s < voices};
+    }
+}
+
+static void legacy_block(void) {
+    legacy_fill(legacy_out, BLOCK);
+}
+
+// --- Núcleos de mezcla ---
+
+static float float_volume[NUM_SOUNDS];
+
+/// Mezcla anterior de main.c: suma de las voces activas dividida por cuántas son, en cada muestra.
+static void division_block(void) {
+    for (size_t i = 0; i < BLOCK; ++i) {
+        int32_t sum = 0;
+        int count = 0;
+        for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+            if (players[s].active && players[s].position < players[s].length) {
+                sum += players[s].data[players[s].position++];
+                ++count;
+            }
+        }
+        int32_t y = count > 0 ? sum / count : SAMPLE_MIDPOINT;
+        legacy_out[i] = (uint16_t)(y > 4095 ? 4095 : y);
+    }
+}
+
+/// Mezcla de sampler_wave/main.c: cada voz multiplica por su volumen flotante en cada muestra.
+static void float_block(void) {
+    for (size_t i = 0; i < BLOCK; ++i) mix_accum[i] = 0;
+    for (uint8_t s = 0; s < NUM_SOUNDS; ++s) {
+        LegacyPlayer *p = &players[s];
+        if (!p->active) continue;
+        for (size_t i = 0; i < BLOCK; ++i) {
+            int32_t x = (int32_t)p->data[p->position + i] - SAMPLE_MIDPOINT;
+            if (float_volume[s] != 1.0f) x = (int32_t)(x * float_volume[s]);
+            mix_accum[i] += x;
+        }
+        p->position += BLOCK;
+    }
+    for (size_t i = 0; i < BLOCK; ++i) {
+        int32_t y = mix_accum[i] + SAMPLE_MIDPOINT;
+        legacy_out[i] = (uint16_t)(y < 0 ? 0 : y > 4095 ? 4095 : y);
+    }
+}
+
+/// Mezcla actual: ganancia Q15 por voz en int32 y una única saturación al final.
+static void q15_block(void) {
+    for (size_t i = 0; i < BLOCK * AUDIO_CHANNELS; ++i) mix_accum[i] = 0;
+    for (uint8_t a = 0; a < voice_pool.num_active; ++a) {
+        mix_voice_run(&voice_pool.voices[voice_pool.active[a]], mix_accum, BLOCK);
+    }
+    for (size_t i = 0; i < BLOCK * AUDIO_CHANNELS; ++i) {
+        int32_t y = (mix_accum[i] >> Q15_SHIFT) + SAMPLE_MIDPOINT;
+        legacy_out[i % BLOCK] = (uint16_t)(y < 0 ? 0 : y > 4095 ? 4095 : y);
+    }
+}
+
+// --- Mezclador actual ---
+
+static void mixer_setup(uint32_t voices) {
+    voice_pool_clear(&voice_pool);
+    for (uint8_t s = 0; s < voices; ++s) mixer_trigger(s % NUM_SOUNDS, 0, 0);
+}
+
+/// Igual que fill_and_mix_buffer() hasta el acumulador, sin limitador ni etapa de salida.
+static void spans_block(void) {
+    for (size_t i = 0; i < BLOCK * AUDIO_CHANNELS; ++i) mix_accum[i] = 0;
+    size_t done = 0;
+    while (done < BLOCK) {
+        uint32_t samples_to_step = tempo_samples_to_step(&sequencer_clock);
+        if (samples_to_step == 0) {
+            sequencer_step();
+            tempo_consume_step(&sequencer_clock);
+            continue;
+        }
+        size_t run = BLOCK - done < samples_to_step ? BLOCK - done : samples_to_step;
+        mix_span(&mix_accum[done * AUDIO_CHANNELS], run);
+        mix_tails(&mix_accum[done * AUDIO_CHANNELS], run);
+        tempo_advance(&sequencer_clock, (uint32_t)run);
+        done += run;
+    }
+}
+
+static int bench_interp; ///< Modo de la voz de interp_setup(); -1: altura original.
+
+static void interp_setup(uint32_t voices) {
+    voice_pool_clear(&voice_pool);
+    slots[0].interp = bench_interp < 0 ? INTERP_LINEAR : (uint8_t)bench_interp;
+    for (uint8_t v = 0; v < voices; ++v) {
+        mixer_trigger(0, bench_interp < 0 ? 0 : BENCH_SEMITONES, 0);
+    }
+}
+
+static void span_block(void) {
+    mix_span(mix_accum, BLOCK);
+}
+
+/// Voces de todos los sonidos; las impares transpuestas, con el modo de interpolación de su sonido.
+static void load_setup(uint32_t voices) {
+    voice_pool_clear(&voice_pool);
+    for (uint8_t s = 0; s < NUM_SOUNDS; ++s) slots[s].interp = s % INTERP_MODE_COUNT;
+    for (uint32_t v = 0; v < voices; ++v) mixer_trigger(v % NUM_SOUNDS, v % 2 ? BENCH_SEMITONES : 0, 0);
+}
+
+static void mixer_block(void) {
+    fill_and_mix_buffer(out, BLOCK);
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) batches = (uint32_t)strtoul(argv[1], NULL, 10);
+    if (batches == 0) batches = 1;
+    uint32_t seed = 5;
+    for (int s = 0; s < NUM_SOUNDS; ++s) {
+        for (int i = 0; i < SOUND_SAMPLES; ++i) sounds[s][i] = (uint16_t)(1048 + next_random(&seed) % 2001);
+        slots[s] = (SampleSlot){.data = sounds[s], .length = SOUND_SAMPLES, .volume = Q15_ONE / 2};
+        patterns[s] = 0; // Sin disparos del patrón: las voces del lote suenan hasta el final
+        float_volume[s] = 0.5f;
+    }
+    voice_pool_init(&voice_pool, STEAL_OLDEST);
+    mixer_init();
+    tempo_set_bpm(&sequencer_clock, OUTPUT_SAMPLE_RATE, BENCH_BPM);
+    pattern_samples_per_step = OUTPUT_SAMPLE_RATE * 15 / BENCH_BPM;
+
+    printf("Bloques de %u cuadros a %u Hz (%.1f us de audio), mejor de %u lotes de %u bloques:\n", BLOCK,
+           OUTPUT_SAMPLE_RATE, BLOCK * 1e6 / OUTPUT_SAMPLE_RATE, batches, BLOCKS_PER_BATCH);
+
+    printf("\nRender por bloque con 0 a 3 voces (ns por bloque):\n");
+    printf("  %5s  %10s  %10s  %8s  %10s\n", "voces", "anterior", "tramos", "relacion", "con salida");
+    for (uint32_t v = 0; v <= 3; ++v) {
+        double before = bench(legacy_setup, legacy_block, v);
+        double spans = bench(mixer_setup, spans_block, v);
+        double full = bench(mixer_setup, mixer_block, v);
+        printf("  %5u  %10.0f  %10.0f  %7.2fx  %10.0f\n", v, before, spans, before / spans, full);
+    }
+
+    printf("\nNucleo de mezcla con %u voces (ns por bloque):\n", CORE_VOICES);
+    double division = bench(legacy_setup, division_block, CORE_VOICES);
+    double floating = bench(legacy_setup, float_block, CORE_VOICES);
+    double q15 = bench(mixer_setup, q15_block, CORE_VOICES);
+    printf("  %-34s %8.0f\n", "division por muestra (anterior)", division);
+    printf("  %-34s %8.0f  %5.2fx\n", "volumen flotante por muestra", floating, division / floating);
+    printf("  %-34s %8.0f  %5.2fx\n", "ganancia Q15 y saturacion final", q15, division / q15);
+
+    static const char *interp_names[INTERP_MODE_COUNT] = {"sin interpolar", "lineal", "cubica"};
+    printf("\nUna voz transpuesta %d semitonos por modo de interpolacion:\n", BENCH_SEMITONES);
+    printf("  %-16s  %8s  %10s\n", "", "ns/bloque", "ns/muestra");
+    for (bench_interp = -1; bench_interp < INTERP_MODE_COUNT; ++bench_interp) {
+        double t = bench(interp_setup, span_block, 1);
+        printf("  %-16s  %8.0f  %10.2f\n", bench_interp < 0 ? "altura original" : interp_names[bench_interp], t,
+               t / BLOCK);
+    }
+
+    static const uint32_t load_voices[] = {8, 16};
+    double block_ns = BLOCK * 1e9 / OUTPUT_SAMPLE_RATE;
+    printf("\nMargen a %u Hz con fill_and_mix_buffer() (tiempo real del bloque: %.0f ns):\n", OUTPUT_SAMPLE_RATE,
+           block_ns);
+    printf("  %5s  %10s  %7s  %7s\n", "voces", "ns/bloque", "carga", "margen");
+    for (size_t i = 0; i < sizeof(load_voices) / sizeof(load_voices[0]); ++i) {
+        double t = bench(load_setup, mixer_block, load_voices[i]);
+        printf("  %5u  %10.0f  %6.2f%%  %6.2f%%\n", load_voices[i], t, 100 * t / block_ns, 100 * (1 - t / block_ns));
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file requant_snr.c
+ * @brief Herramienta de host: SNR en banda de la etapa de salida con y sin modelado de ruido.
+ * @details Genera un seno con la resolución de la mezcla (MIX_FRAC_BITS), lo
+ * pasa por la salida anterior (truncado a 12 bits y recortado en wrap = 4000)
+ * y por requantizer.h con orden 0, 1 y 2 sobre el wrap que elige el
+ * planificador de reloj, y compara el ciclo de trabajo obtenido con el ideal.
+ * El ruido se mide con una DFT con ventana de Hann sobre las frecuencias por
+ * debajo de la banda pedida.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/requant_snr.c -o requant_snr -lm
+ *     ./requant_snr [frecuencia_muestreo] [banda_hz] [tono_hz]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "requantizer.h"
+#include "clock_planner.h"
+
+#define N 8192
+#define LEGACY_WRAP 4000
+
+static double ideal[N];   // Ciclo de trabajo ideal, 0..1
+static double twiddle_cos[N], twiddle_sin[N], window[N];
+static double duty[N];    // Ciclo de trabajo obtenido
+static int32_t mix[N];
+static uint16_t levels[N];
+
+/**
+ * @brief SNR en banda (dB) de duty frente a ideal, con el tono de potencia @p signal_power.
+ */
+static double inband_snr(double rate, double band, double signal_power) {
+    static double err[N];
+    double wsum = 0;
+    for (int i = 0; i < N; ++i) {
+        err[i] = (duty[i] - ideal[i]) * window[i];
+        wsum += window[i] * window[i];
+    }
+    int last_bin = (int)(band / rate * N);
+    double noise = 0;
+    for (int k = 1; k <= last_bin; ++k) { // Sin la componente continua
+        double re = 0, im = 0;
+        for (int i = 0, t = 0; i < N; ++i, t = (t + k) % N) {
+            re += err[i] * twiddle_cos[t];
+            im -= err[i] * twiddle_sin[t];
+        }
+        noise += 2 * (re * re + im * im) / (N * wsum); // Espectro de un solo lado
+    }
+    return 10 * log10(signal_power / noise);
+}
+
+static void run(double rate, double band, double tone, double dbfs, uint16_t wrap) {
+    double amp = 2047.0 * pow(10, dbfs / 20); // Unidades de 12 bits
+    for (int i = 0; i < N; ++i) {
+        double x = amp * sin(2 * M_PI * tone * i / rate);
+        ideal[i] = (x + 2048) / 4096;
+        mix[i] = (int32_t)lrint(x * (1 << MIX_FRAC_BITS));
+    }
+    double signal_power = 0.5 * (amp / 4096) * (amp / 4096);
+    printf("Tono %.0f Hz a %.0f dBFS, banda 0-%.0f Hz:\n", tone, dbfs, band);
+
+    // Salida anterior: truncado a 12 bits y recorte en el wrap fijo de 4000. Se
+    // compara en su propia escala (nivel / 4096) para medir solo el error de
+    // cuantización y el recorte, no la diferencia de ganancia
+    for (int i = 0; i < N; ++i) {
+        int32_t v = (mix[i] >> MIX_FRAC_BITS) + 2048;
+        if (v > LEGACY_WRAP) v = LEGACY_WRAP;
+        duty[i] = (double)v / 4096;
+    }
+    printf("  anterior (wrap %u):  %6.1f dB\n", LEGACY_WRAP, inband_snr(rate, band, signal_power));
+
+    for (uint8_t order = 0; order < REQUANT_ORDER_COUNT; ++order) {
+        Requantizer rq;
+        requantizer_init(&rq, wrap, order);
+        requantize_block(&rq, mix, levels, N, 1);
+        for (int i = 0; i < N; ++i) duty[i] = (double)levels[i] / (wrap + 1);
+        printf("  orden %u (wrap %u):   %6.1f dB\n", order, wrap, inband_snr(rate, band, signal_power));
+    }
+}
+
+int main(int argc, char **argv) {
+    uint32_t rate = argc > 1 ? (uint32_t)atoi(argv[1]) : 24000;
+    double band = argc > 2 ? atof(argv[2]) : rate / 4.0;
+    double tone = argc > 3 ? atof(argv[3]) : 441.0;
+
+    for (int i = 0; i < N; ++i) {
+        twiddle_cos[i] = cos(2 * M_PI * i / N);
+        twiddle_sin[i] = sin(2 * M_PI * i / N);
+        window[i] = 0.5 - 0.5 * twiddle_cos[i];
+    }
+
+    ClockPlan plan = {0};
+    if (!clock_plan_search(rate, 100000, 133000, 1023, 1000, &plan)) {
+        fprintf(stderr, "Sin plan de reloj para %u Hz\n", rate);
+        return 1;
+    }
+    printf("Plan: sistema=%u kHz wrap=%u divisor=%u+%u/16\n", plan.sys_khz, plan.wrap, plan.div_int, plan.div_frac);
+    run(rate, band, tone, -6, plan.wrap);
+    run(rate, band, tone, 0, plan.wrap);
+    return 0;
+}
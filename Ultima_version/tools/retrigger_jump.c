@@ -0,0 +1,119 @@
+/**
+ * @file retrigger_jump.c
+ * @brief Herramienta de host: mayor salto entre muestras consecutivas en los redisparos.
+ * @details Renderiza con el mezclador real (mixer.h) un tono sostenido con un
+ * ataque corto, que se redispara cada ~1000 muestras en una fase distinta, y
+ * mide el mayor salto |y[n] - y[n-1]| de la salida en cada redisparo, desde la
+ * muestra anterior hasta el final de la rampa, y fuera de ellos (el salto
+ * propio de la mezcla sostenida). Compara:
+ *  - un golpe aislado, sin redisparos: el salto propio del sonido;
+ *  - el corte seco anterior (la voz se reinicia en la posición 0);
+ *  - el redisparo de un sonido monofónico, que pasa el golpe anterior a una
+ *    cola de FADE_SAMPLES muestras;
+ *  - el robo de la voz más antigua con el banco lleno de golpes polifónicos,
+ *    que también se desvanece.
+ * Falla si con cola el salto en un redisparo supera el de la mezcla sostenida
+ * más el de un golpe aislado, es decir, si el corte añade más que un ataque.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/retrigger_jump.c -o retrigger_jump -lm
+ *     ./retrigger_jump [redisparos]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "mixer.h"
+
+#define BLOCK 16                // Los redisparos caen al inicio de un bloque
+#define TONE_SAMPLES 40000      // Más que MAX_VOICES intervalos: siempre se corta o se roba un golpe que suena
+#define ATTACK_SAMPLES 24       // Entrada del tono desde el silencio
+#define RELEASE_SAMPLES 256     // Salida del tono hasta el silencio
+#define TONE_LEVEL 700          // Amplitud sobre SAMPLE_MIDPOINT
+#define TONE_HZ 220.0
+#define INTERVAL 1000           // Muestras entre redisparos, más una parte aleatoria
+
+static uint16_t tone[TONE_SAMPLES];
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+typedef enum { ISOLATED = 0, HARD_CUT, FADE_TAIL, STEAL } Scenario;
+
+/// Mayores saltos entre cuadros consecutivos, en niveles del PWM.
+typedef struct {
+    uint32_t retrigger; ///< Alrededor de los redisparos (en el golpe aislado, en todo el sonido).
+    uint32_t steady;    ///< Fuera de ellos.
+} Jumps;
+
+/**
+ * Redispara @p hits veces según @p scenario.
+ */
+static Jumps run(Scenario scenario, uint32_t hits) {
+    voice_pool_init(&voice_pool, STEAL_OLDEST);
+    mixer_init();
+    output_stage.order = REQUANT_ROUND; // Sin ruido de modelado que sume a los saltos
+    slots[0].mono = scenario != STEAL;
+    slots[0].volume = scenario == STEAL ? Q15_ONE / 4 : Q15_ONE; // Las 16 voces suman unas 4 a fase aleatoria
+
+    uint32_t seed = 7, watch = 0;
+    Jumps worst = {0, 0};
+    int32_t prev = -1;
+    audio_frame_t block[BLOCK];
+    uint32_t next = 0;
+    for (uint32_t hit = 0, now = 0; hit <= hits; now += BLOCK) {
+        if (now >= next) {
+            if (scenario == HARD_CUT) voice_pool_clear(&voice_pool);
+            if (scenario != ISOLATED || hit == 0) {
+                mixer_trigger(0, 0, 0); // Con el banco lleno, STEAL roba la voz más antigua
+            }
+            ++hit;
+            next = now + INTERVAL + (next_random(&seed) % 64) * BLOCK;
+            watch = FADE_SAMPLES + 1;
+        }
+        fill_and_mix_buffer(block, BLOCK);
+        for (uint32_t i = 0; i < BLOCK; ++i) {
+            int32_t y = (int32_t)(block[i] & 0xFFFF);
+            if (prev >= 0) {
+                uint32_t jump = (uint32_t)abs(y - prev);
+                uint32_t *w = watch > 0 || scenario == ISOLATED ? &worst.retrigger : &worst.steady;
+                if (jump > *w) *w = jump;
+            }
+            if (watch > 0) --watch;
+            prev = y;
+        }
+    }
+    return worst;
+}
+
+int main(int argc, char **argv) {
+    uint32_t hits = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 500;
+    for (int i = 0; i < TONE_SAMPLES; ++i) {
+        double env = i < ATTACK_SAMPLES ? (double)i / ATTACK_SAMPLES : 1.0;
+        if (TONE_SAMPLES - i < RELEASE_SAMPLES) env = (double)(TONE_SAMPLES - i) / RELEASE_SAMPLES;
+        tone[i] = (uint16_t)lrint(SAMPLE_MIDPOINT + TONE_LEVEL * env * sin(2 * M_PI * TONE_HZ * i / OUTPUT_SAMPLE_RATE));
+    }
+    slots[0] = (SampleSlot){.data = tone, .length = TONE_SAMPLES, .volume = Q15_ONE};
+
+    static const char *names[] = {"golpe aislado", "corte seco anterior", "redisparo con cola", "robo con cola"};
+    printf("%u redisparos de un tono de %.0f Hz, cola de %u muestras, mayor salto en niveles del PWM:\n", hits,
+           TONE_HZ, FADE_SAMPLES);
+    printf("  %-20s  redisparo  sostenido\n", "");
+    uint32_t isolated = 0;
+    bool ok = true;
+    for (int sc = ISOLATED; sc <= STEAL; ++sc) {
+        Jumps j = run((Scenario)sc, sc == ISOLATED ? 1 : hits);
+        if (sc == ISOLATED) isolated = j.retrigger;
+        bool smooth = j.retrigger <= j.steady + isolated;
+        if (sc == FADE_TAIL || sc == STEAL) ok = ok && smooth;
+        if (sc == ISOLATED) {
+            printf("  %-20s  %9u  %9s\n", names[sc], j.retrigger, "--");
+        } else {
+            printf("  %-20s  %9u  %9u%s\n", names[sc], j.retrigger, j.steady, smooth ? "" : "  salto");
+        }
+    }
+    printf("  (robo: %u voces a 1/4 de volumen)\n", MAX_VOICES);
+    printf("%s\n", ok ? "OK" : "FALLA: la cola no suaviza el redisparo");
+    return !ok;
+}
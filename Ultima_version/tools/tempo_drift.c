@@ -0,0 +1,89 @@
+/**
+ * @file tempo_drift.c
+ * @brief Herramienta de host: deriva acumulada del reloj del secuenciador (tempo.h) en 10.000 compases.
+ * @details Recorre el reloj igual que fill_and_mix_buffer(), en bloques de
+ * largo aleatorio cortados en cada paso, y anota la muestra en que arranca
+ * cada semicorchea. El instante ideal del paso k es k · frecuencia · 15 / bpm
+ * muestras, un racional exacto; el reloj debe arrancarlo en la primera muestra
+ * igual o posterior, así que el error queda en [0, 1) muestras y no crece.
+ * Para comparar, también se cuenta el reloj anterior, que truncaba la duración
+ * del paso a muestras enteras, y se imprime cuánto se habría desviado al final.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/tempo_drift.c -o tempo_drift
+ *     ./tempo_drift [compases]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "tempo.h"
+
+#define STEPS_PER_BAR 16
+#define MAX_BLOCK 1024 // Como AUDIO_PERIOD_MAX
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+/**
+ * Recorre @p bars compases a @p rate Hz y @p bpm pulsos por minuto.
+ * @return Pasos que no arrancaron en la muestra esperada.
+ */
+static uint32_t run(uint32_t rate, uint32_t bpm, uint32_t bars) {
+    TempoClock clock = {0};
+    tempo_set_bpm(&clock, rate, bpm); // El primer paso cae en la muestra 0
+    uint64_t steps = (uint64_t)bars * STEPS_PER_BAR;
+    uint64_t num = (uint64_t)rate * 15u; // Duración ideal de un paso: num / bpm muestras
+
+    uint64_t now = 0, k = 0;
+    uint32_t errors = 0, seed = rate ^ (bpm << 16);
+    double worst = 0;
+    while (k < steps) {
+        uint32_t block = 1 + next_random(&seed) % MAX_BLOCK;
+        uint32_t done = 0;
+        while (done < block && k < steps) {
+            uint32_t to_step = tempo_samples_to_step(&clock);
+            if (to_step == 0) {
+                uint64_t expected = (k * num + bpm - 1) / bpm; // Primera muestra >= instante ideal
+                double error = (double)(now + done) - (double)(k * num) / bpm;
+                if (error > worst) worst = error;
+                if (now + done != expected) {
+                    if (errors < 5) {
+                        printf("  paso %llu: muestra %llu, esperada %llu\n", (unsigned long long)k,
+                               (unsigned long long)(now + done), (unsigned long long)expected);
+                    }
+                    ++errors;
+                }
+                tempo_consume_step(&clock);
+                ++k;
+                continue;
+            }
+            uint32_t run_len = block - done < to_step ? block - done : to_step;
+            tempo_advance(&clock, run_len);
+            done += run_len;
+        }
+        now += done;
+    }
+
+    // Reloj anterior: pasos de floor(num / bpm) muestras
+    double legacy_ms = (double)(steps * (num % bpm)) / bpm * 1000.0 / rate;
+    printf("  %6u Hz %4u BPM: peor error %.4f muestras, anterior %9.1f ms de deriva%s\n", rate, bpm, worst,
+           legacy_ms, errors ? "  FALLA" : "");
+    return errors;
+}
+
+int main(int argc, char **argv) {
+    uint32_t bars = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 10000;
+    static const uint32_t rates[] = {16000, 24000, 32000, 44100, 48000};
+    static const uint32_t bpms[] = {60, 97, 112, 137, 220};
+
+    printf("%u compases (%u pasos) por combinacion:\n", bars, bars * STEPS_PER_BAR);
+    uint32_t errors = 0;
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) {
+        for (size_t b = 0; b < sizeof(bpms) / sizeof(bpms[0]); ++b) {
+            errors += run(rates[r], bpms[b], bars);
+        }
+    }
+    printf("%s\n", errors ? "FALLA" : "OK: cada paso arranca en la primera muestra tras su instante ideal");
+    return errors != 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file trigger_jitter.c
+ * @brief Herramienta de host: latencia y jitter de los disparos en vivo, de la pulsación al sonido.
+ * @details Reproduce una serie de pulsaciones en instantes aleatorios a través
+ * del mezclador real (mixer.h) y busca en la salida la muestra en que empieza
+ * cada golpe. El motor se modela como en audio_core_main(): al terminar cada
+ * bloque lee los eventos que el núcleo 0 ya envió (con una demora aleatoria de
+ * hasta LIVE_TRIGGER_SLACK / 2 muestras tras la pulsación) y mezcla el bloque
+ * siguiente al que está sonando. Compara dos formas de disparar:
+ *  - al inicio del bloque, como antes, con mixer_trigger();
+ *  - en el cuadro pulsación + anticipación, con mixer_trigger_at() y la misma
+ *    regla que apply_engine_events() en main.c.
+ * Para cada una imprime la latencia mínima, media y máxima y el jitter (máxima
+ * menos mínima), en muestras.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/trigger_jitter.c -o trigger_jitter -lm
+ *     ./trigger_jitter [periodo] [pulsaciones]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mixer.h"
+
+#define LIVE_TRIGGER_SLACK (OUTPUT_SAMPLE_RATE / 1000) // Como en main.c
+#define HIT_SAMPLES 48                           // Duración del golpe de prueba
+#define HIT_LEVEL 1000                           // Amplitud sobre SAMPLE_MIDPOINT
+#define ONSET_THRESHOLD 100                      // Distancia al silencio que cuenta como sonido
+#define QUIET_SAMPLES 200                        // Silencio previo exigido antes de un golpe
+
+static uint16_t hit[HIT_SAMPLES];
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static uint32_t live_lookahead(uint16_t period) {
+    return 2u * period + LIVE_TRIGGER_SLACK; // Como en main.c
+}
+
+typedef struct {
+    uint32_t min, max, count, late;
+    uint64_t sum;
+} latency_stats_t;
+
+static void stats_add(latency_stats_t *st, uint32_t latency) {
+    if (st->count == 0 || latency < st->min) st->min = latency;
+    if (latency > st->max) st->max = latency;
+    st->sum += latency;
+    st->count++;
+}
+
+/**
+ * Reproduce @p presses pulsaciones con el periodo @p period.
+ * @param scheduled false: disparo al inicio del bloque; true: con anticipación.
+ */
+static latency_stats_t replay(uint16_t period, uint32_t presses, bool scheduled) {
+    uint32_t *press_time = malloc(presses * sizeof(uint32_t));
+    uint32_t *post_time = malloc(presses * sizeof(uint32_t));
+    uint32_t seed = 12345, t = 4u * period;
+    for (uint32_t i = 0; i < presses; ++i) { // Separadas lo bastante para que cada golpe termine
+        t += 1500u + next_random(&seed) % 3000u;
+        press_time[i] = t;
+        post_time[i] = t + next_random(&seed) % (LIVE_TRIGGER_SLACK / 2 + 1);
+    }
+
+    voice_pool_init(&voice_pool, STEAL_OLDEST);
+    mixer_init();
+    output_stage.order = REQUANT_ROUND;
+    num_live_triggers = 0;
+    const int32_t mid = ((int32_t)output_stage.wrap + 1) >> 1;
+
+    latency_stats_t st = {0};
+    audio_frame_t block[AUDIO_PERIOD_MAX];
+    uint32_t next_event = 0, next_onset = 0, quiet = QUIET_SAMPLES;
+    // El bloque que empieza en 'start' se mezcla cuando termina el anterior
+    for (uint32_t start = period; next_onset < presses; start += period) {
+        uint32_t now = start - period;
+        while (next_event < presses && post_time[next_event] <= now) {
+            if (!scheduled) {
+                mixer_trigger(0, 0, 0);
+            } else {
+                int32_t offset = (int32_t)(press_time[next_event] + live_lookahead(period) - start);
+                if (offset >= (int32_t)period) break; // Suena en un bloque posterior
+                if (offset < 0) {
+                    ++st.late;
+                    offset = 0;
+                }
+                mixer_trigger_at(0, 0, 0, (uint32_t)offset);
+            }
+            ++next_event;
+        }
+        fill_and_mix_buffer(block, period);
+        for (uint32_t i = 0; i < period && next_onset < presses; ++i) {
+            int32_t level = (int32_t)(block[i] & 0xFFFF) - mid;
+            if (level < ONSET_THRESHOLD && level > -ONSET_THRESHOLD) {
+                ++quiet;
+                continue;
+            }
+            if (quiet >= QUIET_SAMPLES) {
+                stats_add(&st, start + i - press_time[next_onset]);
+                ++next_onset;
+            }
+            quiet = 0;
+        }
+    }
+    free(press_time);
+    free(post_time);
+    return st;
+}
+
+static void print_stats(const char *name, const latency_stats_t *st) {
+    printf("  %-22s min %5u  media %8.1f  max %5u  jitter %4u muestras (%.3f ms)", name, st->min,
+           (double)st->sum / st->count, st->max, st->max - st->min, (st->max - st->min) * 1000.0 / OUTPUT_SAMPLE_RATE);
+    if (st->late) printf("  %u tarde", st->late);
+    printf("\n");
+}
+
+int main(int argc, char **argv) {
+    uint16_t period = argc > 1 ? (uint16_t)strtoul(argv[1], NULL, 10) : AUDIO_PERIOD_DEFAULT;
+    uint32_t presses = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 2000;
+    if (period < AUDIO_PERIOD_MIN || period > AUDIO_PERIOD_MAX) {
+        printf("El periodo debe estar entre %u y %u\n", AUDIO_PERIOD_MIN, AUDIO_PERIOD_MAX);
+        return 1;
+    }
+    for (int i = 0; i < HIT_SAMPLES; ++i) hit[i] = SAMPLE_MIDPOINT + HIT_LEVEL;
+    slots[0] = (SampleSlot){.data = hit, .length = HIT_SAMPLES, .volume = Q15_ONE};
+
+    printf("%u pulsaciones, periodo %u cuadros a %u Hz, anticipacion %u muestras\n", presses, period,
+           OUTPUT_SAMPLE_RATE, live_lookahead(period));
+    latency_stats_t block_start = replay(period, presses, false);
+    latency_stats_t scheduled = replay(period, presses, true);
+    print_stats("al inicio del bloque:", &block_start);
+    print_stats("con anticipacion:", &scheduled);
+    return scheduled.max - scheduled.min >= 1 || scheduled.count != presses;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file underrun_fade.c
+ * @brief Herramienta de host: ningún cuadro viejo suena cuando un bloque no llega a tiempo.
+ * @details Simula cuadro a cuadro el búfer de dos mitades de main.c: el DMA
+ * pasa a la otra mitad en cuanto termina un bloque, la interrupción llega
+ * hasta un cuarto de bloque después y recién entonces el núcleo 1 empieza a
+ * rellenar la mitad libre. Algunos rellenos tardan más de un bloque y se
+ * descartan, como en claim_output_block(). Cada bloque rellenado lleva un
+ * contenido propio, así que se sabe qué bloque escribió cada mitad. Compara:
+ *  - la sustitución anterior: la interrupción escribe la caída en la mitad que
+ *    ya empezó a sonar, después de que el DMA envió algunos cuadros viejos;
+ *  - mixer_prepare_fallback(), que deja la caída en la mitad que se libera.
+ * Falla si con mixer_prepare_fallback() suena un cuadro de otro bloque, si un
+ * bloque rellenado suena con otro contenido, o si una caída no sigue al cuadro
+ * que sonó antes.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/underrun_fade.c -o underrun_fade -lm
+ *     ./underrun_fade [bloques]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mixer.h"
+
+#define BLOCK AUDIO_PERIOD_DEFAULT
+#define LATE_ONE_IN 16 // Un relleno de cada tantos tarda más de un bloque
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            if (failures < 10) { printf("  FALLA: " __VA_ARGS__); printf("\n"); } \
+            ++failures; \
+        } \
+    } while (0)
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+/// Quién escribió una mitad: el bloque y si es su mezcla o una caída.
+typedef struct {
+    uint32_t block;
+    bool fade;
+} Origin;
+
+/// Cuadro @p i de la mezcla del bloque @p block, distinto en cada bloque.
+static audio_frame_t block_frame(uint32_t block, uint32_t i) {
+    int32_t mid = ((int32_t)output_stage.wrap + 1) >> 1;
+    audio_frame_t frame = 0;
+    for (uint8_t ch = 0; ch < AUDIO_CHANNELS; ++ch) {
+        uint32_t level = (uint32_t)(mid + (int32_t)((block * 97u + i * 13u + ch * 5u) % 801u) - 400);
+        frame |= (audio_frame_t)(level << (16 * ch));
+    }
+    return frame;
+}
+
+/// Devuelve true si @p frame es el primer cuadro de una caída que sigue a @p prev.
+static bool fade_follows(audio_frame_t frame, audio_frame_t prev, int32_t mid) {
+    for (uint8_t ch = 0; ch < AUDIO_CHANNELS; ++ch) {
+        int32_t last = (int32_t)((prev >> (16 * ch)) & 0xFFFF);
+        int32_t d = (int32_t)((frame >> (16 * ch)) & 0xFFFF) - last;
+        int32_t step = ((last > mid ? last - mid : mid - last) >> UNDERRUN_FADE_SHIFT) + 1;
+        if (d < -step || d > step) return false;
+    }
+    return true;
+}
+
+typedef struct {
+    uint32_t underruns;
+    uint32_t stale;  ///< Cuadros de otro bloque que sonaron.
+    uint32_t jumps;  ///< Caídas que no siguen al cuadro anterior.
+} Result;
+
+static Result run(bool prepare, uint32_t blocks) {
+    mixer_init();
+    const int32_t mid = ((int32_t)output_stage.wrap + 1) >> 1;
+    Origin origin[2];
+    for (uint32_t k = 0; k < 2; ++k) { // Prellenado, con el DMA parado
+        for (uint32_t i = 0; i < BLOCK; ++i) sampler_buffer[k * HALF_BUFFER_SIZE + i] = block_frame(k, i);
+        origin[k] = (Origin){k, false};
+    }
+    uint32_t seed = 11;
+    uint32_t playing = 0, pos = 0;      // Bloque que envía el DMA y su cuadro
+    uint32_t blocks_done = 0;           // dma_blocks_done: lo avanza la interrupción
+    uint32_t blocks_ready = 2;          // audio_blocks_ready
+    bool irq_pending = false, dma_flag = false;
+    uint64_t irq_at = 0;
+    bool filling = false;
+    uint32_t fill_block = 0;
+    uint64_t fill_done_at = 0;
+    audio_frame_t prev = sampler_buffer[0];
+    Result r = {0, 0, 0};
+
+    for (uint64_t t = 0; playing < blocks; ++t) {
+        if (irq_pending && t == irq_at) { // dma_handler()
+            irq_pending = false;
+            uint32_t finished = blocks_done;
+            uint32_t now = finished + 1;
+            blocks_done = now;
+            bool underrun = (int32_t)(blocks_ready - now) <= 0;
+            r.underruns += underrun;
+            if (prepare) {
+                audio_frame_t *half = mixer_prepare_fallback(sampler_buffer, HALF_BUFFER_SIZE, now, BLOCK, BLOCK);
+                origin[(half - sampler_buffer) / HALF_BUFFER_SIZE] = (Origin){now + 1, true};
+            } else if (underrun) {
+                audio_frame_t *half = sampler_buffer + (now & 1) * HALF_BUFFER_SIZE;
+                mixer_write_fade(half, BLOCK, sampler_buffer[(finished & 1) * HALF_BUFFER_SIZE + BLOCK - 1]);
+                origin[now & 1] = (Origin){now, true};
+            }
+            dma_flag = true;
+        }
+        if (filling && t == fill_done_at) { // claim_output_block() y la escritura
+            filling = false;
+            if ((int32_t)(playing - fill_block) < 0) {
+                blocks_ready = fill_block + 1;
+                for (uint32_t i = 0; i < BLOCK; ++i) {
+                    sampler_buffer[(fill_block & 1) * HALF_BUFFER_SIZE + i] = block_frame(fill_block, i);
+                }
+                origin[fill_block & 1] = (Origin){fill_block, false};
+            }
+        }
+        if (!filling && dma_flag) { // audio_core_main(): rellena el bloque siguiente al que suena
+            dma_flag = false;
+            filling = true;
+            fill_block = blocks_done + 1;
+            uint32_t d = next_random(&seed) % LATE_ONE_IN == 0 ? BLOCK + next_random(&seed) % (2 * BLOCK)
+                                                               : BLOCK / 4 + next_random(&seed) % (BLOCK / 2);
+            fill_done_at = t + 1 + d;
+        }
+
+        // El DMA envía un cuadro
+        uint32_t h = playing & 1;
+        audio_frame_t frame = sampler_buffer[h * HALF_BUFFER_SIZE + pos];
+        if (origin[h].block != playing) {
+            r.stale++;
+        } else if (!origin[h].fade) {
+            CHECK(frame == block_frame(playing, pos), "bloque %u, cuadro %u: no es su mezcla", playing, pos);
+        } else if (pos == 0) {
+            r.jumps += !fade_follows(frame, prev, mid);
+        }
+        prev = frame;
+        if (++pos == BLOCK) {
+            pos = 0;
+            playing++;
+            irq_pending = true;
+            irq_at = t + 1 + next_random(&seed) % (BLOCK / 4);
+        }
+    }
+    return r;
+}
+
+int main(int argc, char **argv) {
+    uint32_t blocks = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 200000;
+    printf("%u bloques de %u cuadros, un relleno de cada %u tarde:\n", blocks, BLOCK, LATE_ONE_IN);
+    printf("  %-26s %9s %12s %7s\n", "", "vaciados", "cuadros viejos", "saltos");
+    static const char *names[2] = {"sustitucion al sonar", "caida preescrita"};
+    for (int prepare = 0; prepare <= 1; ++prepare) {
+        Result r = run(prepare, blocks);
+        printf("  %-26s %9u %12u %7u\n", names[prepare], r.underruns, r.stale, r.jumps);
+        if (prepare) {
+            CHECK(r.underruns > 0, "la simulación no produjo vaciados");
+            CHECK(r.stale == 0, "sonaron %u cuadros de otro bloque", r.stale);
+            CHECK(r.jumps == 0, "%u caídas no siguen al cuadro anterior", r.jumps);
+        }
+    }
+    printf("%s\n", failures ? "FALLA" : "OK");
+    return failures != 0;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file voice_pool_stress.c
+ * @brief Herramienta de host: prueba de estrés del banco de voces (voice_pool.h) a 1.000 disparos por segundo.
+ * @details Dispara los tres sonidos en instantes aleatorios (en promedio mil
+ * por segundo de audio, a alturas aleatorias) entre bloques que mezcla el
+ * mezclador real (mixer.h), con cada modo de robo. Las muestras duran unos
+ * 200 ms, así que el banco pasa casi todo el tiempo lleno y roba en casi cada
+ * disparo. Como en main.c el kick es protegido y monofónico y el hi-hat está en
+ * un grupo de corte. Tras cada disparo y cada bloque comprueba:
+ *  - que las listas de voces activas y libres cubren cada voz una sola vez y
+ *    que el estado de cada voz coincide con la lista en que está;
+ *  - que las colas no pasan de MAX_TAILS ni de su rampa, y que con todas
+ *    ocupadas solo se reemplazan las que suenan menos (ver tail_level());
+ *  - que solo se cortan las voces del mismo sonido monofónico o del mismo
+ *    grupo, más como mucho una robada, y que un sonido no protegido nunca
+ *    roba una voz protegida;
+ *  - que la voz robada es la que pide el modo (la más antigua, la más
+ *    silenciosa o la de menor prioridad) y que solo se descarta un disparo si
+ *    no había candidata.
+ *
+ * Compilar y ejecutar desde Ultima_version/:
+ *     gcc -O2 -I. tools/voice_pool_stress.c -o voice_pool_stress -lm
+ *     ./voice_pool_stress [segundos]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "mixer.h"
+
+#define TRIGGERS_PER_SECOND 1000
+#define BLOCK AUDIO_PERIOD_DEFAULT
+#define SOUND_SAMPLES (OUTPUT_SAMPLE_RATE / 5)
+
+static uint16_t sounds[NUM_SOUNDS][SOUND_SAMPLES];
+static uint32_t failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            if (failures < 10) { printf("  FALLA: " __VA_ARGS__); printf("\n"); } \
+            ++failures; \
+        } \
+    } while (0)
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+/// Comprueba la coherencia de las listas de voces y de las colas.
+static void check_pool(const VoicePool *pool) {
+    uint8_t seen[MAX_VOICES] = {0};
+    CHECK(pool->num_active + pool->num_free == MAX_VOICES, "activas %u + libres %u", pool->num_active, pool->num_free);
+    for (uint8_t i = 0; i < pool->num_active; ++i) {
+        uint8_t v = pool->active[i];
+        CHECK(v < MAX_VOICES && !seen[v]++, "voz %u repetida en la lista activa", v);
+        CHECK(pool->voices[v].player.active, "voz activa %u marcada libre", v);
+    }
+    for (uint8_t i = 0; i < pool->num_free; ++i) {
+        uint8_t v = pool->free_list[i];
+        CHECK(v < MAX_VOICES && !seen[v]++, "voz %u repetida en las listas", v);
+        CHECK(!pool->voices[v].player.active, "voz libre %u marcada activa", v);
+    }
+    CHECK(pool->num_tails <= MAX_TAILS, "%u colas", pool->num_tails);
+    for (uint8_t t = 0; t < pool->num_tails; ++t) {
+        const FadeTail *tail = &pool->tails[t];
+        CHECK(tail->remaining > 0 && tail->ramp_pos + (uint32_t)tail->remaining * tail->ramp_step <= FADE_SAMPLES,
+              "cola %u fuera de su rampa (pos %u, quedan %u)", t, tail->ramp_pos, tail->remaining);
+    }
+}
+
+static bool same_tail(const FadeTail *a, const FadeTail *b) {
+    return a->src == b->src && a->phase == b->phase && a->remaining == b->remaining && a->gain == b->gain &&
+           a->ramp_pos == b->ramp_pos && a->increment == b->increment && a->stride == b->stride;
+}
+
+/// Dispara @p slot_index comprobando qué voces se cortan y cuál se roba.
+static void checked_trigger(VoicePool *pool, uint8_t slot_index, uint32_t increment) {
+    const SampleSlot *slot = &slots[slot_index];
+    Voice before[MAX_VOICES];
+    uint8_t n = pool->num_active;
+    for (uint8_t i = 0; i < n; ++i) before[i] = pool->voices[pool->active[i]];
+
+    // Las voces que corta el propio disparo (mismo sonido monofónico o mismo grupo)
+    bool cut[MAX_VOICES] = {false};
+    uint8_t left = n;
+    for (uint8_t i = 0; i < n; ++i) {
+        cut[i] = (slot->choke_group && before[i].choke_group == slot->choke_group) ||
+                 (slot->mono && before[i].slot == slot_index);
+        left -= cut[i];
+    }
+    // Candidata que debería robarse si no queda voz libre
+    int expected = -1;
+    for (int pass = 0; pass < 2 && expected < 0 && left == MAX_VOICES; ++pass) {
+        if (pass == 1 && !slot->protect) break;
+        for (uint8_t i = 0; i < n; ++i) {
+            if (cut[i] || (before[i].protect && pass == 0)) continue;
+            if (expected < 0) {
+                expected = i;
+                continue;
+            }
+            const Voice *c = &before[i], *b = &before[expected];
+            bool better;
+            switch (pool->steal_mode) {
+                case STEAL_QUIETEST: better = voice_is_quieter(c, b); break;
+                case STEAL_LOWEST_PRIORITY:
+                    better = c->priority < b->priority || (c->priority == b->priority && c->serial < b->serial);
+                    break;
+                default: better = c->serial < b->serial; break;
+            }
+            if (better) expected = i;
+        }
+    }
+
+    uint8_t num_tails = pool->num_tails;
+    FadeTail tails[MAX_TAILS];
+    for (uint8_t t = 0; t < num_tails; ++t) tails[t] = pool->tails[t];
+
+    uint32_t drops = pool->drops;
+    Voice *voice = voice_pool_trigger(pool, slot_index, slot, Q15_ONE, Q15_ONE, increment, 0);
+    check_pool(pool);
+
+    bool still[MAX_VOICES] = {false};
+    for (uint8_t i = 0; i < pool->num_active; ++i) {
+        const Voice *v = &pool->voices[pool->active[i]];
+        for (uint8_t j = 0; j < n; ++j) {
+            if (before[j].serial == v->serial) still[j] = true;
+        }
+    }
+    for (uint8_t i = 0; i < n; ++i) {
+        if (cut[i]) {
+            CHECK(!still[i], "sigue sonando la voz %u, que debía cortarse", before[i].serial);
+        } else if ((int)i == expected) {
+            CHECK(!still[i], "no se robó la voz %u (modo %d)", before[i].serial, pool->steal_mode);
+        } else {
+            CHECK(still[i], "se cortó la voz %u del sonido %u (modo %d, disparo del sonido %u)", before[i].serial,
+                  before[i].slot, pool->steal_mode, slot_index);
+        }
+    }
+    // Una cola reemplazada no puede sonar más que ninguna de las que siguen
+    bool kept[MAX_TAILS] = {false};
+    for (uint8_t t = 0; t < num_tails; ++t) {
+        for (uint8_t u = 0; u < pool->num_tails; ++u) kept[t] = kept[t] || same_tail(&tails[t], &pool->tails[u]);
+    }
+    for (uint8_t t = 0; t < num_tails; ++t) {
+        for (uint8_t u = 0; u < num_tails && !kept[t]; ++u) {
+            CHECK(!kept[u] || tail_level(&tails[t]) <= tail_level(&tails[u]),
+                  "se reemplazó una cola de nivel %u y sigue una de %u", tail_level(&tails[t]), tail_level(&tails[u]));
+        }
+    }
+
+    bool must_drop = left == MAX_VOICES && expected < 0;
+    CHECK(must_drop == (voice == NULL) && must_drop == (pool->drops != drops), "descarte inesperado del sonido %u",
+          slot_index);
+}
+
+/// Mezcla @p seconds segundos con @p mode disparando TRIGGERS_PER_SECOND veces por segundo.
+static void run(StealMode mode, uint32_t seconds) {
+    static const char *names[STEAL_MODE_COUNT] = {"mas antigua", "mas silenciosa", "menor prioridad"};
+    voice_pool_init(&voice_pool, mode);
+    mixer_init();
+    uint32_t seed = 1234 + mode, triggers = 0, max_active = 0, max_tails = 0;
+    uint32_t next = 0, total = seconds * OUTPUT_SAMPLE_RATE;
+    audio_frame_t block[BLOCK];
+    for (uint32_t now = 0; now < total; now += BLOCK) {
+        for (; next < now + BLOCK; next += 1 + next_random(&seed) % (2 * OUTPUT_SAMPLE_RATE / TRIGGERS_PER_SECOND - 1)) {
+            uint32_t r = next_random(&seed); // El kick, uno de cada 8: su voz envejece y sería víctima si no estuviera protegida
+            uint8_t s = (uint8_t)(r % 8 == 0 ? 0 : 1 + (r >> 3) % 2);
+            int semitones = (int)(next_random(&seed) % 25) - 12;
+            checked_trigger(&voice_pool, s, mixer_increment(next_random(&seed) % 4 ? semitones : 0));
+            ++triggers;
+            if (voice_pool.num_active > max_active) max_active = voice_pool.num_active;
+            if (voice_pool.num_tails > max_tails) max_tails = voice_pool.num_tails;
+        }
+        fill_and_mix_buffer(block, BLOCK);
+        check_pool(&voice_pool);
+    }
+    printf("  %-16s %6u disparos (%u/s): robadas %6u descartadas %4u desvanecidas %6u cortadas %5u, "
+           "max %u voces y %u colas\n", names[mode], triggers, triggers / seconds, voice_pool.steals,
+           voice_pool.drops, voice_pool.fades, voice_pool.chokes, max_active, max_tails);
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 60;
+    if (seconds == 0) seconds = 1;
+    uint32_t seed = 99;
+    for (int s = 0; s < NUM_SOUNDS; ++s) { // Ruido que decae, para que la estimación de nivel tenga sentido
+        for (int i = 0; i < SOUND_SAMPLES; ++i) {
+            double env = exp(-4.0 * i / SOUND_SAMPLES);
+            int32_t noise = (int32_t)(next_random(&seed) % 2001) - 1000;
+            sounds[s][i] = (uint16_t)(SAMPLE_MIDPOINT + (int32_t)(noise * env));
+        }
+    }
+    slots[0] = (SampleSlot){.data = sounds[0], .length = SOUND_SAMPLES, .priority = 2, .protect = true, .mono = true,
+                            .interp = INTERP_LINEAR, .volume = Q15_ONE / 2};
+    slots[1] = (SampleSlot){.data = sounds[1], .length = SOUND_SAMPLES, .priority = 1, .interp = INTERP_CUBIC,
+                            .volume = Q15_ONE / 4};
+    slots[2] = (SampleSlot){.data = sounds[2], .length = SOUND_SAMPLES * 3 / 4, .priority = 0, .choke_group = 1,
+                            .interp = INTERP_DROP, .volume = Q15_ONE / 8};
+
+    printf("%u s de audio a %u Hz, %u voces, %u colas:\n", seconds, OUTPUT_SAMPLE_RATE, MAX_VOICES, MAX_TAILS);
+    for (int mode = 0; mode < STEAL_MODE_COUNT; ++mode) run((StealMode)mode, seconds);
+    printf("%s (%u fallas)\n", failures ? "FALLA" : "OK", failures);
+    return failures != 0;
+}
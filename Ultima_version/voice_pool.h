@@ -0,0 +1,384 @@
+/**
+ * @file voice_pool.h
+ * @brief Banco fijo de voces polifónicas con lista compacta de voces activas.
+ * @details Cada disparo ocupa una voz propia, de modo que un redisparo no corta
+ * la cola del golpe anterior. Las voces activas se guardan como una lista densa
+ * de índices, así el mezclador recorre solo las que suenan (coste O(activas)).
+ * Cuando no quedan voces libres se roba una según el modo configurado; las voces
+ * de sonidos protegidos (p. ej. el kick) nunca son víctimas de otro sonido.
+ *
+ * Una voz que se corta antes de terminar (robada, o redisparada en un sonido
+ * monofónico) no se silencia de golpe: su reproducción pasa a una cola de
+ * desvanecimiento de FADE_SAMPLES muestras y la voz queda libre enseguida para
+ * el nuevo golpe. El coste añadido por corte está acotado a FADE_SAMPLES muestras.
+ * Los sonidos de un mismo grupo de corte (p. ej. hi-hat abierto y cerrado) se
+ * silencian entre sí con una rampa CHOKE_RAMP_STEP veces más rápida.
+ *
+ * Con VOICE_STREAMS, las voces de sonidos ADPCM, empaquetados o PCM con caché
+ * de prefijo leen de su ventana (ver voice_stream.h) y avanzan siempre hacia
+ * adelante dentro de ella; al cortarse, su cola copia las TAIL_STREAM_SAMPLES
+ * muestras siguientes, porque la ventana se reutiliza enseguida. Alcanzan para
+ * la rampa entera a la voz más aguda (+PITCH_RANGE semitonos y el remuestreo
+ * del banco): 257 muestras por cola sin remuestreo, hasta 513 con un banco al
+ * doble de la salida. No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sampler.h"
+#include "pitch.h"
+#include "pan.h"
+#if VOICE_STREAMS
+#include "voice_stream.h"
+#endif
+
+#define MAX_VOICES 16 ///< Número de voces simultáneas del banco.
+/**
+ * Colas de desvanecimiento simultáneas. Cada una cuesta hasta FADE_SAMPLES
+ * muestras de mezcla (y su copia de la ventana con VOICE_STREAMS). Si se
+ * llenan, la cola nueva reemplaza a la que suena menos (ver tail_level()), que
+ * se corta en seco: es el único escalón que queda en un corte y el menor
+ * posible, pero con muchos redisparos seguidos puede oírse.
+ */
+#define MAX_TAILS 8
+#define FADE_SAMPLES 64 ///< Duración de una cola de desvanecimiento en muestras.
+#define CHOKE_RAMP_STEP 4 ///< Paso por la rampa en los cortes por grupo (16 muestras).
+#if BANK_RESAMPLE
+#define VOICE_INCREMENT_MAX ((uint32_t)(((uint64_t)PITCH_INCREMENT_MAX * BANK_INCREMENT) >> PITCH_FRAC_BITS))
+#else
+#define VOICE_INCREMENT_MAX PITCH_INCREMENT_MAX ///< Avance más rápido de una voz (16.16).
+#endif
+// La posición de una voz transpuesta es la parte entera de una fase 16.16 de 32 bits
+_Static_assert(((uint64_t)SAMPLE_LENGTH_MAX << PITCH_FRAC_BITS) <= UINT32_MAX,
+               "SAMPLE_LENGTH_MAX no cabe en la fase 16.16 de las voces");
+/// Muestras que copia la cola de una voz con ventana: las que lee la rampa entera a la voz más aguda.
+#define TAIL_STREAM_SAMPLES ((uint32_t)(((uint64_t)FADE_SAMPLES * VOICE_INCREMENT_MAX) >> PITCH_FRAC_BITS) + 1)
+
+/**
+ * @brief Criterio para elegir la voz a robar cuando el banco está lleno.
+ */
+typedef enum {
+    STEAL_OLDEST = 0,       ///< La voz que lleva más tiempo sonando.
+    STEAL_QUIETEST,         ///< La voz con menor nivel estimado.
+    STEAL_LOWEST_PRIORITY,  ///< La voz de menor prioridad (empate: la más antigua).
+    STEAL_MODE_COUNT
+} StealMode;
+
+typedef struct {
+    SamplePlayer player; ///< Estado de reproducción de la muestra.
+    uint8_t slot;        ///< Sonido que está reproduciendo.
+    uint8_t priority;    ///< Prioridad copiada del sonido al dispararse.
+    bool protect;        ///< Si es verdadero, solo otro sonido protegido puede robarla.
+    uint16_t gain;       ///< Ganancia final de la voz (Q15): velocidad × pista × maestro.
+#if AUDIO_STEREO
+    uint16_t gain_l;     ///< gain con el paneo del canal izquierdo aplicado (Q15).
+    uint16_t gain_r;     ///< gain con el paneo del canal derecho aplicado (Q15).
+#endif
+    uint8_t choke_group; ///< Grupo de corte copiado del sonido (0 = ninguno).
+    uint32_t serial;     ///< Número de disparo, para ordenar por antigüedad.
+#if VOICE_STREAMS
+    VoiceStream stream;  ///< Ventana decodificada; stream.bank == NULL en las voces PCM.
+#endif
+} Voice;
+
+/**
+ * @brief Resto de una voz cortada que se reproduce mientras se desvanece.
+ */
+typedef struct {
+    const uint16_t *src; ///< Muestra en la que estaba la voz al cortarse (NULL: en 'window').
+    uint32_t phase;      ///< Posición relativa a src en 16.16, en el sentido de la voz.
+    int8_t stride;       ///< Sentido de lectura de la voz original (+1 o -1).
+    uint32_t increment;  ///< Avance por muestra de salida (16.16), el de la voz original.
+    uint16_t remaining;  ///< Muestras pendientes (nunca más que lo que queda de rampa).
+    uint16_t gain;       ///< Ganancia de la voz original (Q15).
+#if AUDIO_STEREO
+    uint16_t gain_l;     ///< Ganancias por canal de la voz original (Q15).
+    uint16_t gain_r;
+#endif
+    uint8_t ramp_pos;    ///< Posición dentro de la rampa de desvanecimiento.
+    uint8_t ramp_step;   ///< Entradas de la rampa que avanza por muestra.
+#if VOICE_STREAMS
+    uint16_t window[TAIL_STREAM_SAMPLES]; ///< Copia de lo que le quedaba a una voz con ventana.
+#endif
+} FadeTail;
+
+typedef struct {
+    Voice voices[MAX_VOICES];
+    uint8_t active[MAX_VOICES];    ///< Índices de las voces que suenan, sin huecos.
+    uint8_t num_active;
+    uint8_t free_list[MAX_VOICES]; ///< Pila de voces libres.
+    uint8_t num_free;
+    FadeTail tails[MAX_TAILS];     ///< Colas de desvanecimiento en curso, sin huecos.
+    uint8_t num_tails;
+    uint32_t serial;               ///< Contador de disparos.
+    StealMode steal_mode;
+    uint32_t steals;               ///< Voces robadas desde el arranque.
+    uint32_t drops;                ///< Disparos descartados por no encontrar víctima.
+    uint32_t fades;                ///< Voces cortadas con desvanecimiento.
+    uint32_t chokes;               ///< Voces silenciadas por su grupo de corte.
+} VoicePool;
+
+/**
+ * @brief Deja todas las voces libres.
+ */
+static inline void voice_pool_init(VoicePool *pool, StealMode mode) {
+    pool->num_active = 0;
+    pool->num_free = MAX_VOICES;
+    pool->num_tails = 0;
+    for (uint8_t i = 0; i < MAX_VOICES; ++i) {
+        pool->voices[i].player.active = false;
+        pool->free_list[i] = MAX_VOICES - 1 - i;
+    }
+    pool->serial = 0;
+    pool->steal_mode = mode;
+    pool->steals = 0;
+    pool->drops = 0;
+    pool->fades = 0;
+    pool->chokes = 0;
+}
+
+/**
+ * @brief Saca de la lista activa la voz que ocupa la posición @p list_pos.
+ * @details Rellena el hueco con la última entrada, por lo que quien recorra la
+ * lista debe volver a examinar la misma posición.
+ */
+static inline void voice_pool_release_at(VoicePool *pool, uint8_t list_pos) {
+    uint8_t v = pool->active[list_pos];
+    pool->voices[v].player.active = false;
+#if VOICE_STREAM_PREFETCH
+    voice_stream_prefetch_cancel(&pool->voices[v].stream); // Que el DMA no cargue trozos de una voz libre
+#endif
+    pool->active[list_pos] = pool->active[--pool->num_active];
+    pool->free_list[pool->num_free++] = v;
+}
+
+/**
+ * @brief Nivel estimado de una cola: la ganancia de su voz por la rampa que le queda.
+ * @details La rampa tabulada está en el mezclador; aquí basta con que decrezca,
+ * así que se usa la parte pendiente como fracción lineal.
+ */
+static inline uint32_t tail_level(const FadeTail *tail) {
+    return (uint32_t)tail->gain * (FADE_SAMPLES - tail->ramp_pos);
+}
+
+/**
+ * @brief Corta la voz de la posición @p list_pos pasando su resto a una cola de desvanecimiento.
+ * @details La voz queda libre de inmediato, así que deja de costar tiempo de
+ * mezcla salvo por la cola. Si todas las colas están ocupadas se reutiliza la
+ * que suena menos (ver tail_level()). La cola conserva la altura de la voz pero
+ * lee sin interpolar.
+ * @param ramp_step Entradas de la rampa por muestra: 1 para un corte normal,
+ * CHOKE_RAMP_STEP para un corte por grupo.
+ */
+static void voice_pool_fade_at(VoicePool *pool, uint8_t list_pos, uint8_t ramp_step) {
+    Voice *voice = &pool->voices[pool->active[list_pos]];
+    const SamplePlayer *player = &voice->player;
+    uint32_t left = (uint32_t)(player->length - player->position);
+    if (player->increment != PITCH_UNITY && left > 0) {
+        // Muestras de salida hasta agotar la muestra a la velocidad de la voz
+        left = pitch_steps((left << PITCH_FRAC_BITS) - player->frac, player->increment);
+    }
+
+    if (left > 0) {
+        FadeTail *tail;
+        if (pool->num_tails < MAX_TAILS) {
+            tail = &pool->tails[pool->num_tails++];
+        } else {
+            tail = &pool->tails[0];
+            for (uint8_t t = 1; t < MAX_TAILS; ++t) {
+                if (tail_level(&pool->tails[t]) < tail_level(tail)) tail = &pool->tails[t];
+            }
+        }
+        uint32_t ramp_len = FADE_SAMPLES / ramp_step;
+        tail->src = player->data + (int32_t)player->position * player->stride;
+        tail->phase = player->frac;
+        tail->stride = player->stride;
+        tail->increment = player->increment;
+        tail->remaining = (uint16_t)(left < ramp_len ? left : ramp_len);
+#if VOICE_STREAMS
+        if (voice->stream.bank) {
+            uint16_t got = voice_stream_read(&voice->stream, player->position, tail->window, TAIL_STREAM_SAMPLES);
+            uint32_t end = (uint32_t)got << PITCH_FRAC_BITS;
+            uint32_t avail = end > player->frac ? pitch_steps(end - player->frac, player->increment) : 0;
+            if (avail < tail->remaining) tail->remaining = (uint16_t)avail; // Solo si la muestra se acaba antes
+            tail->src = NULL; // Lee de tail->window, que se mueve con la cola al compactar la lista
+        }
+#endif
+        tail->gain = voice->gain;
+#if AUDIO_STEREO
+        tail->gain_l = voice->gain_l;
+        tail->gain_r = voice->gain_r;
+#endif
+        tail->ramp_pos = 0;
+        tail->ramp_step = ramp_step;
+        pool->fades++;
+    }
+    voice_pool_release_at(pool, list_pos);
+}
+
+/**
+ * @brief Libera todas las voces y colas de golpe, sin desvanecer ni contar cortes.
+ * @details Solo para mediciones que necesitan partir del silencio.
+ */
+static inline void voice_pool_clear(VoicePool *pool) {
+    while (pool->num_active > 0) voice_pool_release_at(pool, 0);
+    pool->num_tails = 0;
+}
+
+/**
+ * @brief Desvanece rápidamente las voces cuyos sonidos no están en @p audible.
+ * @param audible Máscara de sonidos que pueden seguir sonando (bit = índice del sonido).
+ */
+static void voice_pool_silence_tracks(VoicePool *pool, uint16_t audible) {
+    uint8_t i = 0;
+    while (i < pool->num_active) {
+        if (audible & (1u << pool->voices[pool->active[i]].slot)) {
+            ++i;
+        } else {
+            voice_pool_fade_at(pool, i, CHOKE_RAMP_STEP); // La última voz ocupa esta posición
+        }
+    }
+}
+
+/**
+ * @brief Saca de la lista la cola de la posición @p t, rellenando el hueco con la última.
+ */
+static inline void voice_pool_drop_tail(VoicePool *pool, uint8_t t) {
+    pool->tails[t] = pool->tails[--pool->num_tails];
+}
+
+/**
+ * @brief Indica si la voz @p a suena menos que la voz @p b.
+ * @details Las muestras son golpes que decaen, así que la fracción pendiente de
+ * reproducir, ponderada por la ganancia de la voz, se usa como estimación barata
+ * del nivel.
+ */
+static inline bool voice_is_quieter(const Voice *a, const Voice *b) {
+    uint64_t rem_a = (uint64_t)(a->player.length - a->player.position) * a->gain;
+    uint64_t rem_b = (uint64_t)(b->player.length - b->player.position) * b->gain;
+    return rem_a * b->player.length < rem_b * a->player.length;
+}
+
+/**
+ * @brief Elige la posición en la lista activa de la voz a robar.
+ * @param protected_ok Si es verdadero, también se consideran voces protegidas.
+ * @return Posición en pool->active, o -1 si no hay candidata.
+ */
+static int voice_pool_pick_victim(const VoicePool *pool, bool protected_ok) {
+    int best = -1;
+    for (uint8_t i = 0; i < pool->num_active; ++i) {
+        const Voice *cand = &pool->voices[pool->active[i]];
+        if (cand->protect && !protected_ok) continue;
+        if (best < 0) {
+            best = i;
+            continue;
+        }
+
+        const Voice *cur = &pool->voices[pool->active[best]];
+        uint32_t age_cand = pool->serial - cand->serial;
+        uint32_t age_cur = pool->serial - cur->serial;
+        bool better;
+        switch (pool->steal_mode) {
+            case STEAL_QUIETEST:
+                better = voice_is_quieter(cand, cur);
+                break;
+            case STEAL_LOWEST_PRIORITY:
+                better = cand->priority < cur->priority ||
+                         (cand->priority == cur->priority && age_cand > age_cur);
+                break;
+            case STEAL_OLDEST:
+            default:
+                better = age_cand > age_cur;
+                break;
+        }
+        if (better) best = i;
+    }
+    return best;
+}
+
+/**
+ * @brief Arranca el sonido @p slot_index en una voz libre o robada.
+ * @details En los sonidos monofónicos el golpe anterior del mismo sonido pasa a
+ * una cola de desvanecimiento, y si el sonido tiene grupo de corte se silencian
+ * rápidamente todas las voces de ese grupo. La voz robada también se desvanece
+ * en vez de cortarse. El tramo, la parte y el sentido se resuelven aquí, de modo
+ * que la mezcla solo recorre un puntero y una cuenta.
+ * @param velocity Intensidad del golpe (Q15).
+ * @param master Volumen maestro (Q15).
+ * @param increment Avance por muestra de salida en 16.16 (PITCH_UNITY = altura original).
+ * @param slice Parte del sonido a reproducir si está dividido (ver sample_slot_region()).
+ * @return La voz asignada, o NULL si el disparo se descartó.
+ */
+static Voice *voice_pool_trigger(VoicePool *pool, uint8_t slot_index, const SampleSlot *slot,
+                                 uint16_t velocity, uint16_t master, uint32_t increment, uint8_t slice) {
+    uint16_t first, last;
+    sample_slot_region(slot, slice, &first, &last);
+    if (last == first) return NULL; // Tramo vacío: no hay nada que sonar
+
+    if (slot->mono || slot->choke_group) {
+        uint8_t i = 0;
+        while (i < pool->num_active) {
+            const Voice *other = &pool->voices[pool->active[i]];
+            if (slot->choke_group && other->choke_group == slot->choke_group) {
+                voice_pool_fade_at(pool, i, CHOKE_RAMP_STEP); // La última voz ocupa esta posición
+                pool->chokes++;
+            } else if (slot->mono && other->slot == slot_index) {
+                voice_pool_fade_at(pool, i, 1);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    if (pool->num_free == 0) {
+        int victim = voice_pool_pick_victim(pool, false);
+        if (victim < 0 && slot->protect) {
+            victim = voice_pool_pick_victim(pool, true);
+        }
+        if (victim < 0) {
+            pool->drops++;
+            return NULL;
+        }
+        voice_pool_fade_at(pool, (uint8_t)victim, 1);
+        pool->steals++;
+    }
+
+    uint8_t v = pool->free_list[--pool->num_free];
+    Voice *voice = &pool->voices[v];
+    voice->player = (SamplePlayer){.data = slot->reverse ? slot->data + last - 1 : slot->data + first,
+                                   .length = (uint16_t)(last - first), .position = 0, .frac = 0,
+                                   .increment = increment, .interp = slot->interp,
+                                   .stride = slot->reverse ? -1 : 1, .active = true};
+    voice->slot = slot_index;
+    voice->priority = slot->priority;
+    voice->protect = slot->protect;
+    voice->gain = q15_mul(q15_mul(velocity, slot->volume), master);
+#if AUDIO_STEREO
+    uint16_t pan_l, pan_r;
+    pan_gains(slot->pan, &pan_l, &pan_r);
+    voice->gain_l = q15_mul(voice->gain, pan_l);
+    voice->gain_r = q15_mul(voice->gain, pan_r);
+#endif
+    voice->choke_group = slot->choke_group;
+#if VOICE_STREAMS
+    voice->stream.bank = NULL;
+    if (slot->adpcm || slot->packed || slot->prefix) { // La ventana ya está en el orden de reproducción
+        if (slot->adpcm) {
+            voice_stream_start(&voice->stream, STREAM_ADPCM, slot->adpcm, first, last, slot->reverse);
+        } else if (slot->packed) {
+            voice_stream_start(&voice->stream, STREAM_PACKED12, slot->packed, first, last, slot->reverse);
+        } else {
+#if VOICE_STREAM_PREFETCH
+            uint32_t prefix_len = slot->length < AUDIO_PREFIX_CACHE ? slot->length : AUDIO_PREFIX_CACHE;
+            voice_stream_start_pcm(&voice->stream, slot->data, slot->prefix, prefix_len, first, last, slot->reverse);
+#endif
+        }
+        voice->player.data = voice->stream.window;
+        voice->player.stride = 1;
+    }
+#endif
+    voice->serial = ++pool->serial;
+    pool->active[pool->num_active++] = v;
+    return voice;
+}
@@ -0,0 +1,403 @@
+/**
+ * @file voice_stream.h
+ * @brief Ventana en SRAM por voz para los sonidos que no se leen directamente del banco PCM.
+ * @details Un sonido IMA-ADPCM (ver adpcm.h) o empaquetado a 12 bits (ver
+ * packed12.h) no se puede leer como un arreglo de uint16_t, y un sonido PCM con
+ * caché de prefijo (AUDIO_PREFIX_CACHE) no debe leerse de la flash en el
+ * ataque, así que cada voz que lo reproduce guarda en 'window' un trozo ya
+ * decodificado o copiado, en el
+ * orden de reproducción: window[k] es la muestra de la posición wpos + k de la
+ * voz, también cuando el sonido va al revés. El mezclador lee de la ventana con
+ * los mismos bucles que las voces PCM y pide más con voice_stream_refill()
+ * cuando la lectura llega al final; cada relleno conserva las últimas muestras
+ * que la interpolación todavía necesita y decodifica hasta VOICE_STREAM_RUN
+ * muestras nuevas.
+ *
+ * En ADPCM, hacia adelante el decodificador avanza de forma continua; al revés
+ * cada relleno decodifica desde el punto de búsqueda anterior hasta la muestra
+ * ya entregada y la copia invertida. Las muestras empaquetadas se desempaquetan
+ * directamente en cualquiera de los dos sentidos.
+ *
+ * En PCM con caché de prefijo, las primeras muestras del sonido salen de su
+ * copia en SRAM y el resto de 'chunk', un trozo por voz que un canal DMA
+ * compartido carga desde la flash mientras la voz suena el anterior: cada
+ * relleno pide el trozo siguiente y voice_stream_prefetch_pump() atiende la
+ * cola de pedidos de todas las voces de uno en uno. Si el trozo no llegó a
+ * tiempo se espera al DMA, y si ni siquiera empezó (cola llena o pedido
+ * anulado) se carga en ese momento por el mismo canal y el mezclador espera:
+ * las colas nunca se leen de la flash a través de la caché XIP. Esas cargas
+ * tardías se cuentan en 'stalls' como un vaciado de la precarga. El DMA se maneja con STREAM_DMA_START() y STREAM_DMA_BUSY(), que en
+ * el host son una copia inmediata. Cada carga empieza en la palabra de 32 bits
+ * que contiene su primera muestra y puede escribir una muestra de más al
+ * final, para que el DMA copie palabras enteras (el flujo XIP solo entrega
+ * palabras). No depende del SDK de la Pico.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "audio_config.h"
+#include "adpcm.h"
+#include "packed12.h"
+
+#define VOICE_STREAM_HISTORY 3                   ///< Muestras conservadas al rellenar (vecinos de la cúbica).
+#define VOICE_STREAM_RUN ADPCM_BLOCK_SAMPLES     ///< Muestras nuevas por relleno como máximo.
+#define VOICE_STREAM_WINDOW (VOICE_STREAM_HISTORY + VOICE_STREAM_RUN)
+
+/// Formato de los datos que lee una ventana.
+typedef enum {
+    STREAM_ADPCM = 0,  ///< Bloques IMA-ADPCM (const uint8_t *).
+    STREAM_PACKED12,   ///< Muestras de 12 bits empaquetadas (const uint32_t *).
+    STREAM_PCM,        ///< Banco PCM en flash con su prefijo en SRAM (const uint16_t *).
+} StreamFormat;
+
+#if VOICE_STREAM_PREFETCH
+#ifndef STREAM_DMA_START
+#define STREAM_DMA_START(dst, src, n) memcpy((dst), (src), (n) * sizeof(uint16_t))
+#define STREAM_DMA_BUSY() false
+#endif
+
+/// Estado del trozo precargado de una voz.
+typedef enum {
+    CHUNK_EMPTY = 0, ///< Sin datos útiles.
+    CHUNK_QUEUED,    ///< Pedido, esperando al canal DMA.
+    CHUNK_LOADING,   ///< El canal DMA lo está cargando.
+    CHUNK_READY,     ///< Cargado.
+} ChunkState;
+#endif
+
+typedef struct VoiceStream {
+    const void *bank;    ///< Datos del sonido; NULL si la voz lee PCM.
+    uint8_t format;      ///< StreamFormat.
+    AdpcmDecoder dec;    ///< Lectura secuencial (solo hacia adelante).
+    uint32_t next;       ///< Adelante: próxima muestra a entregar. Atrás: la última entregada (exclusiva).
+    uint32_t bound;      ///< Adelante: fin del tramo (exclusivo). Atrás: inicio del tramo.
+    bool reverse;
+    uint16_t wpos;       ///< Posición de reproducción de window[0].
+    uint16_t wlen;       ///< Muestras válidas en la ventana.
+    uint16_t window[VOICE_STREAM_WINDOW];
+#if VOICE_STREAM_PREFETCH
+    const uint16_t *prefix; ///< Copia en SRAM de las primeras 'prefix_len' muestras de 'bank' (PCM).
+    uint32_t prefix_len;
+    uint32_t chunk_start;   ///< Muestra del banco que corresponde a chunk[chunk_lead].
+    uint16_t chunk_len;
+    uint8_t chunk_lead;     ///< 1 si la carga empezó una muestra antes para leer palabras alineadas.
+    volatile uint8_t chunk_state; ///< ChunkState.
+    uint16_t chunk[VOICE_STREAM_RUN + 2] __attribute__((aligned(4))); ///< Con sitio para la alineación.
+#endif
+} VoiceStream;
+
+#if VOICE_STREAM_PREFETCH
+#define STREAM_PREFETCH_QUEUE 32 ///< Pedidos de trozos en espera; potencia de dos.
+
+/// Cola de trozos por cargar, compartida por todas las voces.
+typedef struct {
+    VoiceStream *loading;                       ///< Trozo que carga el canal DMA; NULL si está libre.
+    VoiceStream *queue[STREAM_PREFETCH_QUEUE];
+    uint8_t head;
+    uint8_t count;
+    uint32_t prefix_samples;  ///< Muestras leídas del prefijo en SRAM.
+    uint32_t chunk_samples;   ///< Muestras leídas de un trozo precargado.
+    uint32_t stall_samples;   ///< Muestras cargadas al leerlas porque su trozo no llegó a empezar.
+    uint32_t stalls;          ///< Cargas tardías: el mezclador esperó al DMA un trozo entero.
+    uint32_t waits;           ///< Lecturas que tuvieron que esperar a que el DMA terminara su trozo.
+} StreamPrefetcher;
+
+static StreamPrefetcher stream_prefetch;
+
+/// Lanza la carga del trozo de @p next por el canal, que debe estar libre.
+static void voice_stream_prefetch_launch(VoiceStream *next) {
+    next->chunk_state = CHUNK_LOADING;
+    stream_prefetch.loading = next;
+    const uint16_t *src = (const uint16_t *)next->bank + next->chunk_start;
+    next->chunk_lead = (uint8_t)(((uintptr_t)src & 2) >> 1);
+    STREAM_DMA_START(next->chunk, src - next->chunk_lead, next->chunk_len + next->chunk_lead);
+}
+
+/**
+ * @brief Da por cargado el trozo en curso si el DMA terminó y arranca el siguiente pedido.
+ * @details Es barata si el canal está ocupado; el mezclador la llama antes de cada voz con ventana.
+ */
+static void voice_stream_prefetch_pump(void) {
+    StreamPrefetcher *pf = &stream_prefetch;
+    for (;;) {
+        if (pf->loading) {
+            if (STREAM_DMA_BUSY()) return;
+            pf->loading->chunk_state = CHUNK_READY;
+            pf->loading = NULL;
+        }
+        VoiceStream *next = NULL;
+        while (pf->count > 0 && !next) {
+            VoiceStream *s = pf->queue[pf->head];
+            pf->head = (uint8_t)((pf->head + 1) & (STREAM_PREFETCH_QUEUE - 1));
+            pf->count--;
+            if (s->chunk_state == CHUNK_QUEUED) next = s; // Si no, el pedido se canceló
+        }
+        if (!next) return;
+        voice_stream_prefetch_launch(next);
+    }
+}
+
+/// Espera a que termine la carga del trozo de @p stream, si la hay.
+static void voice_stream_prefetch_wait(VoiceStream *stream) {
+    if (stream->chunk_state != CHUNK_LOADING) return;
+    stream_prefetch.waits++;
+    while (stream->chunk_state == CHUNK_LOADING) voice_stream_prefetch_pump();
+}
+
+/**
+ * @brief Carga ya las muestras [@p lo, @p hi) en el trozo de @p stream y espera al DMA.
+ * @details Termina antes la carga en curso de otra voz; los pedidos de la cola
+ * siguen esperando y el próximo voice_stream_prefetch_pump() los retoma.
+ */
+static void voice_stream_load_now(VoiceStream *stream, uint32_t lo, uint32_t hi) {
+    StreamPrefetcher *pf = &stream_prefetch;
+    if (pf->loading) {
+        while (STREAM_DMA_BUSY()) {}
+        pf->loading->chunk_state = CHUNK_READY;
+    }
+    stream->chunk_start = lo;
+    stream->chunk_len = (uint16_t)(hi - lo);
+    voice_stream_prefetch_launch(stream);
+    while (STREAM_DMA_BUSY()) {}
+    stream->chunk_state = CHUNK_READY;
+    pf->loading = NULL;
+}
+
+/// Anula el pedido de @p stream si todavía no empezó a cargarse.
+static inline void voice_stream_prefetch_cancel(VoiceStream *stream) {
+    if (stream->chunk_state == CHUNK_QUEUED) stream->chunk_state = CHUNK_EMPTY;
+}
+
+/**
+ * @brief Pide cargar las muestras [@p lo, @p hi) del banco en el trozo de @p stream.
+ * @details Solo se pide lo que no cubre el prefijo. Si la cola está llena el
+ * pedido se pierde y esas muestras se cargarán al leerlas (ver voice_stream_load_now()).
+ */
+static void voice_stream_prefetch(VoiceStream *stream, uint32_t lo, uint32_t hi) {
+    if (lo < stream->prefix_len) lo = stream->prefix_len;
+    if (lo >= hi || stream->chunk_state == CHUNK_LOADING) return;
+    if (stream->chunk_state != CHUNK_EMPTY && stream->chunk_start == lo) return; // Ya pedido
+    if (hi - lo > VOICE_STREAM_RUN) hi = lo + VOICE_STREAM_RUN;
+    stream->chunk_start = lo;
+    stream->chunk_len = (uint16_t)(hi - lo);
+    if (stream->chunk_state != CHUNK_QUEUED) {
+        StreamPrefetcher *pf = &stream_prefetch;
+        if (pf->count == STREAM_PREFETCH_QUEUE) {
+            stream->chunk_state = CHUNK_EMPTY;
+            return;
+        }
+        pf->queue[(pf->head + pf->count++) & (STREAM_PREFETCH_QUEUE - 1)] = stream;
+        stream->chunk_state = CHUNK_QUEUED;
+    }
+    voice_stream_prefetch_pump();
+}
+
+/**
+ * @brief Copia las muestras [@p lo, @p hi) del banco PCM en @p out, en orden ascendente.
+ * @details Lee del prefijo lo que cubre y el resto del trozo precargado,
+ * esperando al DMA si hace falta. Lo que el trozo no cubre se carga en ese
+ * momento, de a VOICE_STREAM_RUN muestras, y se cuenta como carga tardía. El
+ * trozo queda consumido.
+ */
+static void voice_stream_fetch_pcm(VoiceStream *stream, uint32_t lo, uint32_t hi, uint16_t *out) {
+    StreamPrefetcher *pf = &stream_prefetch;
+    uint32_t p = lo;
+    uint32_t e = hi < stream->prefix_len ? hi : stream->prefix_len;
+    if (p < e) {
+        memcpy(out, stream->prefix + p, (e - p) * sizeof(uint16_t));
+        pf->prefix_samples += e - p;
+        out += e - p;
+        p = e;
+    }
+    if (p >= hi) return;
+    voice_stream_prefetch_cancel(stream);
+    voice_stream_prefetch_wait(stream);
+    while (p < hi) {
+        bool late = stream->chunk_state != CHUNK_READY || p < stream->chunk_start ||
+                    p >= stream->chunk_start + stream->chunk_len;
+        if (late) {
+            voice_stream_load_now(stream, p, hi - p > VOICE_STREAM_RUN ? p + VOICE_STREAM_RUN : hi);
+            pf->stalls++;
+        }
+        uint32_t cs = stream->chunk_start, ce = cs + stream->chunk_len;
+        e = hi < ce ? hi : ce;
+        memcpy(out, stream->chunk + stream->chunk_lead + (p - cs), (e - p) * sizeof(uint16_t));
+        if (late) {
+            pf->stall_samples += e - p;
+        } else {
+            pf->chunk_samples += e - p;
+        }
+        out += e - p;
+        p = e;
+    }
+    stream->chunk_state = CHUNK_EMPTY;
+}
+#endif
+
+/**
+ * @brief Prepara la lectura del tramo [@p first, @p last) de @p bank; la ventana queda vacía.
+ */
+static void voice_stream_start(VoiceStream *stream, uint8_t format, const void *bank, uint16_t first, uint16_t last,
+                               bool reverse) {
+#if VOICE_STREAM_PREFETCH
+    voice_stream_prefetch_cancel(stream);
+    voice_stream_prefetch_wait(stream); // El DMA no puede seguir escribiendo en el trozo de otra voz
+    stream->chunk_state = CHUNK_EMPTY;
+    stream->prefix = NULL;
+    stream->prefix_len = 0;
+#endif
+    stream->bank = bank;
+    stream->format = format;
+    stream->reverse = reverse;
+    stream->wpos = 0;
+    stream->wlen = 0;
+    if (reverse) {
+        stream->next = last;
+        stream->bound = first;
+    } else {
+        stream->next = first;
+        stream->bound = last;
+        if (format == STREAM_ADPCM) adpcm_seek(&stream->dec, bank, first);
+    }
+}
+
+#if VOICE_STREAM_PREFETCH
+/**
+ * @brief Prepara la lectura PCM del tramo [@p first, @p last) de @p data con su prefijo en SRAM.
+ * @details Pide enseguida el primer trozo que no cubre el prefijo, para que
+ * llegue mientras la voz suena su ataque.
+ */
+static void voice_stream_start_pcm(VoiceStream *stream, const uint16_t *data, const uint16_t *prefix,
+                                   uint32_t prefix_len, uint16_t first, uint16_t last, bool reverse) {
+    voice_stream_start(stream, STREAM_PCM, data, first, last, reverse);
+    stream->prefix = prefix;
+    stream->prefix_len = prefix_len;
+    if (reverse) {
+        voice_stream_prefetch(stream, last - first > VOICE_STREAM_RUN ? last - VOICE_STREAM_RUN : first, last);
+    } else {
+        voice_stream_prefetch(stream, first, last);
+    }
+}
+#endif
+
+/**
+ * @brief Entrega en @p out hasta @p max muestras siguientes en el orden de reproducción.
+ * @return Muestras entregadas; 0 al final del tramo.
+ */
+static uint16_t voice_stream_produce(VoiceStream *stream, uint16_t *out, uint16_t max) {
+#if VOICE_STREAM_PREFETCH
+    if (stream->format == STREAM_PCM && max > VOICE_STREAM_RUN) max = VOICE_STREAM_RUN; // Lo que cabe en un trozo
+#endif
+    if (!stream->reverse) {
+        uint32_t n = stream->bound - stream->next;
+        if (n > max) n = max;
+        if (stream->format == STREAM_PACKED12) {
+            packed12_unpack(stream->bank, stream->next, out, n);
+#if VOICE_STREAM_PREFETCH
+        } else if (stream->format == STREAM_PCM) {
+            // Un relleno no pasa del prefijo al trozo: el trozo tiene todo el ataque para llegar.
+            // Si quedan pocas muestras del prefijo se cruza, para que la ventana cubra la interpolación.
+            uint32_t in_prefix = stream->next < stream->prefix_len ? stream->prefix_len - stream->next : 0;
+            if (in_prefix > VOICE_STREAM_HISTORY && n > in_prefix) n = in_prefix;
+            voice_stream_fetch_pcm(stream, stream->next, stream->next + n, out);
+            voice_stream_prefetch(stream, stream->next + n, stream->bound);
+#endif
+        } else {
+            adpcm_decode(&stream->dec, out, n);
+        }
+        stream->next += n;
+        return (uint16_t)n;
+    }
+    if (stream->next <= stream->bound) return 0;
+    uint32_t lo = stream->next - stream->bound > max ? stream->next - max : stream->bound;
+    if (stream->format == STREAM_PACKED12) {
+        packed12_unpack(stream->bank, lo, out, stream->next - lo);
+#if VOICE_STREAM_PREFETCH
+    } else if (stream->format == STREAM_PCM) {
+        voice_stream_fetch_pcm(stream, lo, stream->next, out);
+        voice_stream_prefetch(stream, lo - stream->bound > VOICE_STREAM_RUN ? lo - VOICE_STREAM_RUN : stream->bound, lo);
+#endif
+    } else {
+        // Desde el punto de búsqueda que contiene la muestra anterior a la ya entregada
+        uint32_t block = (stream->next - 1) / ADPCM_BLOCK_SAMPLES * ADPCM_BLOCK_SAMPLES;
+        if (lo < block) lo = block;
+        AdpcmDecoder dec;
+        adpcm_seek(&dec, stream->bank, lo);
+        adpcm_decode(&dec, out, stream->next - lo);
+    }
+    uint16_t n = (uint16_t)(stream->next - lo);
+    for (uint16_t a = 0, b = n - 1; a < b; ++a, --b) {
+        uint16_t t = out[a];
+        out[a] = out[b];
+        out[b] = t;
+    }
+    stream->next = lo;
+    return n;
+}
+
+/**
+ * @brief Descarta las @p n muestras siguientes sin guardarlas.
+ */
+static void voice_stream_skip(VoiceStream *stream, uint32_t n) {
+    if (stream->reverse) {
+        uint32_t left = stream->next - stream->bound;
+        stream->next -= n < left ? n : left;
+        return;
+    }
+    uint32_t left = stream->bound - stream->next;
+    if (n > left) n = left;
+    if (stream->format != STREAM_ADPCM) {
+        // Acceso directo: no hay estado que avanzar
+    } else if (n >= ADPCM_BLOCK_SAMPLES) {
+        adpcm_seek(&stream->dec, stream->bank, stream->next + n);
+    } else {
+        adpcm_decode(&stream->dec, NULL, n);
+    }
+    stream->next += n;
+}
+
+/**
+ * @brief Hace que la ventana empiece en la posición @p from y la llena con lo que sigue.
+ * @details Las muestras que ya estaban desde @p from se conservan; si @p from
+ * queda más allá de la ventana (una voz transpuesta hacia arriba puede saltar
+ * muestras), las intermedias se descartan. Con la ventana vacía el tramo terminó.
+ */
+static void voice_stream_refill(VoiceStream *stream, uint32_t from) {
+    if (from < stream->wpos) from = stream->wpos;
+    uint32_t end = (uint32_t)stream->wpos + stream->wlen;
+    uint16_t keep = 0;
+    if (end > from) {
+        keep = (uint16_t)(end - from);
+        const uint16_t *src = &stream->window[from - stream->wpos];
+        for (uint16_t i = 0; i < keep; ++i) stream->window[i] = src[i];
+    } else if (from > end) {
+        voice_stream_skip(stream, from - end);
+    }
+    stream->wpos = (uint16_t)from;
+    stream->wlen = keep + voice_stream_produce(stream, &stream->window[keep], VOICE_STREAM_WINDOW - keep);
+}
+
+/**
+ * @brief Copia en @p dst hasta @p n muestras desde la posición @p from, rellenando lo necesario.
+ * @details @p from no puede ser anterior a la ventana. Lo usan las colas de
+ * desvanecimiento, que necesitan su propia copia porque la voz queda libre.
+ * @return Muestras copiadas; menos de @p n si el tramo termina antes.
+ */
+static uint16_t voice_stream_read(VoiceStream *stream, uint32_t from, uint16_t *dst, uint16_t n) {
+    uint16_t got = 0;
+    while (got < n) {
+        uint32_t p = from + got;
+        if (p >= (uint32_t)stream->wpos + stream->wlen) {
+            voice_stream_refill(stream, p);
+            if (stream->wlen == 0) break;
+        }
+        uint32_t avail = (uint32_t)stream->wpos + stream->wlen - p;
+        uint16_t take = avail < (uint32_t)(n - got) ? (uint16_t)avail : (uint16_t)(n - got);
+        const uint16_t *src = &stream->window[p - stream->wpos];
+        for (uint16_t i = 0; i < take; ++i) dst[got + i] = src[i];
+        got += take;
+    }
+    return got;
+}
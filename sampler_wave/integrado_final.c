@@ -9,6 +9,7 @@
 #include "hardware/pio.h"
 #include "hardware/clocks.h"
 #include "pico/sync.h"
+#include "sample_ring.h"
 
 // --- Definiciones ---
 #define AUDIO_PIN 0
@@ -21,7 +22,6 @@
 #define PWM_WRAP_VALUE 255
 #define IS_RGBW false
 #define NUM_PIXELS 16
-#define SAMPLE_QUEUE_SIZE 8
 #define BUFFER_SIZE 256        // Reducido para mejor rendimiento
 #define SILENCE_LEVEL 128
 #define DEBOUNCE_DELAY_US 50000
@@ -78,13 +78,6 @@ typedef struct {
     uint8_t sound_type;
 } audio_voice_t;
 
-typedef struct { 
-    uint8_t queue[SAMPLE_QUEUE_SIZE]; 
-    volatile uint8_t head; 
-    volatile uint8_t tail; 
-    volatile uint8_t count; 
-} sample_queue_t;
-
 // --- Variables Globales ---
 static bool sequence_grid[NUM_SAMPLES][NUM_STEPS];
 static volatile uint8_t current_step = 0;
@@ -96,7 +89,7 @@ static int dma_chan;
 static audio_voice_t voices[MAX_VOICES];
 static volatile bool button_states[NUM_SAMPLES];
 static volatile absolute_time_t last_press_time[NUM_SAMPLES];
-static sample_queue_t sample_queue = {.head = 0, .tail = 0, .count = 0};
+static sample_ring_t sample_queue = SAMPLE_RING_INIT; // Disparos de los botones (ver sample_ring.h)
 static uint slice_num;
 static uint sm = 0;
 static uint offset;
@@ -202,26 +195,15 @@ static uint8_t generate_clap(uint32_t pos) {
 }
 
 // --- Cola de samples ---
+// Solo la interrupción de los botones encola; el bucle principal, que es el
+// consumidor, llama a play_sample() directamente
 static bool queue_sample(uint8_t sample_index) {
-    uint32_t interrupts = save_and_disable_interrupts();
-    if (sample_queue.count >= SAMPLE_QUEUE_SIZE) {
-        restore_interrupts(interrupts);
-        return false;
-    }
-    sample_queue.queue[sample_queue.head] = sample_index;
-    sample_queue.head = (sample_queue.head + 1) % SAMPLE_QUEUE_SIZE;
-    sample_queue.count++;
-    restore_interrupts(interrupts);
-    return true;
+    return sample_ring_push(&sample_queue, sample_index);
 }
 
 static void process_sample_queue(void) {
-    while (sample_queue.count > 0) {
-        uint32_t interrupts = save_and_disable_interrupts();
-        uint8_t sample_index = sample_queue.queue[sample_queue.tail];
-        sample_queue.tail = (sample_queue.tail + 1) % SAMPLE_QUEUE_SIZE;
-        sample_queue.count--;
-        restore_interrupts(interrupts);
+    uint8_t sample_index;
+    while (sample_ring_pop(&sample_queue, &sample_index)) {
         play_sample(sample_index);
     }
 }
@@ -468,7 +450,7 @@ static void check_and_advance_sequencer(uint32_t* step_delay_us, absolute_time_t
         // Tocar samples del step actual
         for (int i = 0; i < NUM_SAMPLES; i++) {
             if (sequence_grid[i][current_step]) {
-                queue_sample(i);
+                play_sample(i);
             }
         }
         
@@ -517,7 +499,7 @@ int main() {
     // Prueba de sonidos
     printf("Testing sounds...\n");
     for (int i = 0; i < NUM_SAMPLES; i++) {
-        queue_sample(i);
+        play_sample(i);
         sleep_ms(400);
     }
     
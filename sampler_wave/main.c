@@ -9,6 +9,7 @@
 #include "hardware/pio.h"
 #include "hardware/clocks.h"
 #include "pico/sync.h"
+#include "sample_ring.h"
 #include "ws2812.pio.h"
 #include "audio_samples.h"
 
@@ -24,8 +25,8 @@ static const uint BUTTON_PINS[] = {10, 11, 12, 13};
 #define PWM_WRAP_VALUE 255
 #define IS_RGBW false
 #define NUM_PIXELS 16
-#define SAMPLE_QUEUE_SIZE 16
 #define BUFFER_SIZE 512    // Aumentado para mejor rendimiento
+#define GAIN_ONE 32768     // Ganancia unitaria en Q15
 static const uint32_t DEBOUNCE_DELAY_US = 50000;  // 50ms debounce
 
 // --- Estructuras y Variables Globales ---
@@ -34,16 +35,9 @@ typedef struct {
     uint32_t len; 
     uint32_t pos; 
     bool active;
-    float volume;  // Agregado para control de volumen
+    uint16_t gain;  // Volumen de la voz en Q15 (32768 = 1.0)
 } audio_voice_t;
 
-typedef struct { 
-    uint8_t queue[SAMPLE_QUEUE_SIZE]; 
-    volatile uint8_t head; 
-    volatile uint8_t tail; 
-    volatile uint8_t count; 
-} sample_queue_t;
-
 // Definir los samples usando la estructura sample_t
 static const sample_t samples[NUM_SAMPLES] = {
     {kick_sample_data, kick_sample_len},    // Botón 0: Kick
@@ -57,12 +51,13 @@ static volatile uint8_t current_step = 0;
 static volatile uint bpm = 120;
 static volatile bool step_changed = true;
 static uint8_t dma_buffer[2][BUFFER_SIZE];
+static int32_t mix_accum[BUFFER_SIZE];
 static volatile uint8_t active_buffer = 0;
 static int dma_chan;
 static audio_voice_t voices[MAX_VOICES];
 static volatile bool button_states[NUM_SAMPLES] = {false};
 static volatile absolute_time_t last_press_time[NUM_SAMPLES];
-static sample_queue_t sample_queue = {.head = 0, .tail = 0, .count = 0};
+static sample_ring_t sample_queue = SAMPLE_RING_INIT; // Disparos de los botones (ver sample_ring.h)
 static volatile uint32_t led_blink_counter = 0;
 static volatile uint32_t audio_sample_counter = 0;
 
@@ -79,26 +74,15 @@ static void check_and_advance_sequencer(uint32_t* step_delay_us, absolute_time_t
 static void fill_audio_buffer(uint8_t *buffer);
 
 // --- Lógica de la Cola de Samples ---
+// Solo la interrupción de los botones encola; el bucle principal, que es el
+// consumidor, llama a play_sample() directamente
 static bool queue_sample(uint8_t sample_index) {
-    uint32_t interrupts = save_and_disable_interrupts();
-    if (sample_queue.count >= SAMPLE_QUEUE_SIZE) {
-        restore_interrupts(interrupts);
-        return false;
-    }
-    sample_queue.queue[sample_queue.head] = sample_index;
-    sample_queue.head = (sample_queue.head + 1) % SAMPLE_QUEUE_SIZE;
-    sample_queue.count++;
-    restore_interrupts(interrupts);
-    return true;
+    return sample_ring_push(&sample_queue, sample_index);
 }
 
 static void process_sample_queue(void) {
-    while (sample_queue.count > 0) {
-        uint32_t interrupts = save_and_disable_interrupts();
-        uint8_t sample_index = sample_queue.queue[sample_queue.tail];
-        sample_queue.tail = (sample_queue.tail + 1) % SAMPLE_QUEUE_SIZE;
-        sample_queue.count--;
-        restore_interrupts(interrupts);
+    uint8_t sample_index;
+    while (sample_ring_pop(&sample_queue, &sample_index)) {
         play_sample(sample_index);
     }
 }
@@ -116,7 +100,7 @@ static void play_sample(uint sample_index) {
             voices[i].len = samples[sample_index].len;
             voices[i].pos = 0;
             voices[i].active = true;
-            voices[i].volume = 1.0f;  // Volumen completo
+            voices[i].gain = GAIN_ONE;  // Volumen completo
             printf("Voice %d activated\n", i);
             return;
         }
@@ -127,51 +111,44 @@ static void play_sample(uint sample_index) {
     voices[0].len = samples[sample_index].len;
     voices[0].pos = 0;
     voices[0].active = true;
-    voices[0].volume = 1.0f;
+    voices[0].gain = GAIN_ONE;
     printf("Voice 0 replaced\n");
 }
 
 static void fill_audio_buffer(uint8_t *buffer) {
-    // Inicializar buffer con silencio (128 es el punto medio para audio de 8 bits sin signo)
+    // Acumulador en silencio (0 con signo)
     for (int i = 0; i < BUFFER_SIZE; i++) {
-        buffer[i] = 128;
+        mix_accum[i] = 0;
     }
     
-    // Mezclar todas las voces activas
+    // Mezclar todas las voces activas en Q15, sin flotantes ni saturación intermedia
     for (int voice_idx = 0; voice_idx < MAX_VOICES; ++voice_idx) {
-        if (voices[voice_idx].active) {
-            for (int sample_idx = 0; sample_idx < BUFFER_SIZE; ++sample_idx) {
-                if (voices[voice_idx].pos < voices[voice_idx].len) {
-                    // Tomar el sample directamente (ya está en formato correcto 0-255)
-                    int sample_value = voices[voice_idx].data[voices[voice_idx].pos];
-                    
-                    // Aplicar volumen si es necesario
-                    if (voices[voice_idx].volume != 1.0f) {
-                        sample_value = (int)(sample_value * voices[voice_idx].volume);
-                        if (sample_value > 255) sample_value = 255;
-                        if (sample_value < 0) sample_value = 0;
-                    }
-                    
-                    // Para mezclar, convertir a signed, mezclar y volver a unsigned
-                    int buffer_signed = (int)buffer[sample_idx] - 128;
-                    int sample_signed = sample_value - 128;
-                    int mixed = buffer_signed + sample_signed;
-                    
-                    // Clamp
-                    if (mixed > 127) mixed = 127;
-                    else if (mixed < -128) mixed = -128;
-                    
-                    buffer[sample_idx] = (uint8_t)(mixed + 128);
-                    voices[voice_idx].pos++;
-                } else {
-                    // Sample terminado, marcar voz como inactiva
-                    voices[voice_idx].active = false;
-                    break;
-                }
-            }
+        audio_voice_t *voice = &voices[voice_idx];
+        if (!voice->active) continue;
+
+        uint32_t remaining = voice->len - voice->pos;
+        uint32_t run = remaining < BUFFER_SIZE ? remaining : BUFFER_SIZE;
+        const uint8_t *src = voice->data + voice->pos;
+        int32_t gain = voice->gain;
+        for (uint32_t sample_idx = 0; sample_idx < run; ++sample_idx) {
+            // Convertir a signed (128 es el punto medio) y aplicar volumen
+            mix_accum[sample_idx] += ((int32_t)src[sample_idx] - 128) * gain;
+        }
+        voice->pos += run;
+        if (voice->pos >= voice->len) {
+            // Sample terminado, marcar voz como inactiva
+            voice->active = false;
         }
     }
     
+    // Volver a unsigned con una única saturación al final
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        int32_t mixed = (mix_accum[i] >> 15) + 128;
+        if (mixed > 255) mixed = 255;
+        else if (mixed < 0) mixed = 0;
+        buffer[i] = (uint8_t)mixed;
+    }
+    
     // Incrementar contador para debugging
     audio_sample_counter++;
 }
@@ -195,7 +172,7 @@ static void init_audio(void) {
     for (int i = 0; i < MAX_VOICES; i++) {
         voices[i].active = false;
         voices[i].pos = 0;
-        voices[i].volume = 1.0f;  // Volumen completo inicialmente
+        voices[i].gain = GAIN_ONE;  // Volumen completo inicialmente
     }
     
     // Configurar PWM para audio
@@ -351,7 +328,7 @@ static void check_and_advance_sequencer(uint32_t* step_delay_us, absolute_time_t
         // Reproducir samples programados para este step
         for (int i = 0; i < NUM_SAMPLES; ++i) {
             if (sequence_grid[i][current_step]) {
-                queue_sample(i);
+                play_sample(i);
             }
         }
         
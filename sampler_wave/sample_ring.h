@@ -0,0 +1,50 @@
+/**
+ * @file sample_ring.h
+ * @brief Cola de disparos sin espera: la interrupción de los botones escribe y el bucle principal lee.
+ * @details Es una cola de un productor y un consumidor con índices separados.
+ * 'head' solo lo escribe el productor y 'tail' solo el consumidor, así que
+ * ninguno de los dos lados necesita deshabilitar interrupciones ni compartir
+ * un contador. El productor guarda el disparo y después publica 'head' con
+ * semántica release; el consumidor lee 'head' con acquire antes de leer el
+ * disparo y publica 'tail' con release al liberarlo (en Cortex-M0+ cada una
+ * se traduce en una barrera DMB). Los índices cuentan sin límite y se
+ * enmascaran al acceder, por eso el tamaño es potencia de dos y la cola puede
+ * llenarse por completo. Push y pop terminan siempre en un número fijo de
+ * instrucciones. Usa solo C11, así que también compila en el host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#define SAMPLE_RING_SIZE 16 ///< Disparos pendientes como máximo; potencia de dos.
+_Static_assert((SAMPLE_RING_SIZE & (SAMPLE_RING_SIZE - 1)) == 0, "SAMPLE_RING_SIZE debe ser potencia de dos");
+
+typedef struct {
+    uint8_t items[SAMPLE_RING_SIZE];
+    _Atomic uint32_t head; // Disparos escritos (productor)
+    _Atomic uint32_t tail; // Disparos leídos (consumidor)
+} sample_ring_t;
+
+#define SAMPLE_RING_INIT {.head = 0, .tail = 0}
+
+/// Encola un disparo. Solo desde el productor; devuelve false si la cola está llena.
+static inline bool sample_ring_push(sample_ring_t *ring, uint8_t item) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail >= SAMPLE_RING_SIZE) return false;
+    ring->items[head & (SAMPLE_RING_SIZE - 1)] = item;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+/// Saca el disparo más antiguo. Solo desde el consumidor; devuelve false si la cola está vacía.
+static inline bool sample_ring_pop(sample_ring_t *ring, uint8_t *item) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (head == tail) return false;
+    *item = ring->items[tail & (SAMPLE_RING_SIZE - 1)];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
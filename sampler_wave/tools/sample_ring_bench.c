@@ -0,0 +1,219 @@
+/**
+ * @file sample_ring_bench.c
+ * @brief Herramienta de host: rendimiento y latencia de sample_ring.h frente a la cola con bloqueo.
+ * @details Mide tres cosas:
+ *  - throughput de pares push/pop en un solo hilo;
+ *  - promedio, percentil 99.9 y peor caso de cada push y cada pop, medidos
+ *    uno a uno (se descuenta el costo mínimo de leer el reloj). El peor caso
+ *    incluye las expropiaciones del sistema operativo; el percentil no;
+ *  - con dos hilos, disparos por segundo y latencia de extremo a extremo
+ *    (del push al pop) con un productor y un consumidor concurrentes.
+ * Como referencia, repite las mismas mediciones con la cola anterior, que
+ * protegía cada operación con save_and_disable_interrupts() y compartía un
+ * contador; en el host la sección crítica se emula con un spinlock.
+ *
+ * Compilar y ejecutar desde sampler_wave/:
+ *     gcc -O2 -pthread -I. tools/sample_ring_bench.c -o sample_ring_bench
+ *     ./sample_ring_bench [operaciones]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "sample_ring.h"
+
+// --- Cola anterior, con sección crítica ---
+typedef struct {
+    uint8_t queue[SAMPLE_RING_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint8_t count;
+    atomic_flag lock; // Hace las veces de save_and_disable_interrupts()
+} locked_queue_t;
+
+static bool locked_push(locked_queue_t *q, uint8_t item) {
+    while (atomic_flag_test_and_set_explicit(&q->lock, memory_order_acquire)) {}
+    bool ok = q->count < SAMPLE_RING_SIZE;
+    if (ok) {
+        q->queue[q->head] = item;
+        q->head = (q->head + 1) % SAMPLE_RING_SIZE;
+        q->count++;
+    }
+    atomic_flag_clear_explicit(&q->lock, memory_order_release);
+    return ok;
+}
+
+static bool locked_pop(locked_queue_t *q, uint8_t *item) {
+    while (atomic_flag_test_and_set_explicit(&q->lock, memory_order_acquire)) {}
+    bool ok = q->count > 0;
+    if (ok) {
+        *item = q->queue[q->tail];
+        q->tail = (q->tail + 1) % SAMPLE_RING_SIZE;
+        q->count--;
+    }
+    atomic_flag_clear_explicit(&q->lock, memory_order_release);
+    return ok;
+}
+
+// --- Interfaz común ---
+typedef struct {
+    const char *name;
+    bool (*push)(void *queue, uint8_t item);
+    bool (*pop)(void *queue, uint8_t *item);
+    void *(*create)(void);
+} queue_ops_t;
+
+static bool ring_push(void *q, uint8_t item) { return sample_ring_push(q, item); }
+static bool ring_pop(void *q, uint8_t *item) { return sample_ring_pop(q, item); }
+static void *ring_create(void) {
+    sample_ring_t *ring = malloc(sizeof(*ring));
+    *ring = (sample_ring_t)SAMPLE_RING_INIT;
+    return ring;
+}
+static bool lock_push(void *q, uint8_t item) { return locked_push(q, item); }
+static bool lock_pop(void *q, uint8_t *item) { return locked_pop(q, item); }
+static void *lock_create(void) {
+    locked_queue_t *q = calloc(1, sizeof(*q));
+    atomic_flag_clear(&q->lock);
+    return q;
+}
+
+static const queue_ops_t queues[] = {
+    {"sin espera (sample_ring.h)", ring_push, ring_pop, ring_create},
+    {"con seccion critica", lock_push, lock_pop, lock_create},
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t total = 20000000;
+
+/// Histograma en potencias de dos de nanosegundos, para estimar percentiles.
+typedef struct {
+    uint32_t buckets[64];
+    uint64_t sum, worst;
+    uint32_t count;
+} latency_hist_t;
+
+static void hist_add(latency_hist_t *h, uint64_t ns) {
+    int b = 0;
+    while (b < 63 && (1ull << b) < ns) ++b;
+    h->buckets[b]++;
+    h->sum += ns;
+    if (ns > h->worst) h->worst = ns;
+    h->count++;
+}
+
+/// Cota superior del percentil @p per_mille (en milésimas).
+static uint64_t hist_percentile(const latency_hist_t *h, uint32_t per_mille) {
+    uint64_t target = (uint64_t)h->count * per_mille / 1000, seen = 0;
+    for (int b = 0; b < 64; ++b) {
+        seen += h->buckets[b];
+        if (seen >= target) return 1ull << b;
+    }
+    return h->worst;
+}
+
+static void hist_print(const char *name, const latency_hist_t *h) {
+    printf("  %s: promedio %.1f ns, p99.9 <= %llu ns, peor %.1f us\n", name, (double)h->sum / h->count,
+           (unsigned long long)hist_percentile(h, 999), h->worst / 1e3);
+}
+
+// --- Un hilo ---
+static void bench_single(const queue_ops_t *ops) {
+    void *q = ops->create();
+    uint8_t item;
+    uint64_t start = now_ns();
+    for (uint32_t n = 0; n < total; ++n) {
+        ops->push(q, (uint8_t)n);
+        ops->pop(q, &item);
+    }
+    uint64_t elapsed = now_ns() - start;
+    printf("  un hilo: %.1f M pares push/pop por segundo\n", total * 1e3 / (double)elapsed);
+
+    // Cada operación medida por separado; el reloj cuesta lo mismo en ambas colas
+    uint64_t overhead = UINT64_MAX;
+    for (int k = 0; k < 100000; ++k) {
+        uint64_t a = now_ns();
+        uint64_t b = now_ns();
+        if (b - a < overhead) overhead = b - a;
+    }
+    latency_hist_t push_hist = {0}, pop_hist = {0};
+    for (uint32_t n = 0; n < total / 20; ++n) {
+        uint64_t a = now_ns();
+        ops->push(q, (uint8_t)n);
+        uint64_t b = now_ns();
+        ops->pop(q, &item);
+        uint64_t c = now_ns();
+        hist_add(&push_hist, b - a > overhead ? b - a - overhead : 0);
+        hist_add(&pop_hist, c - b > overhead ? c - b - overhead : 0);
+    }
+    hist_print("push", &push_hist);
+    hist_print("pop", &pop_hist);
+    free(q);
+}
+
+// --- Dos hilos ---
+typedef struct {
+    const queue_ops_t *ops;
+    void *queue;
+    uint64_t stamps[256]; // Hora del push de cada disparo, indexada por su valor
+    latency_hist_t latency;
+    uint32_t received;
+} pair_t;
+
+static void *producer(void *arg) {
+    pair_t *p = arg;
+    for (uint32_t n = 0; n < total / 10; ++n) {
+        uint8_t item = (uint8_t)n;
+        __atomic_store_n(&p->stamps[item], now_ns(), __ATOMIC_RELAXED);
+        while (!p->ops->push(p->queue, item)) sched_yield();
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    pair_t *p = arg;
+    uint8_t item;
+    while (p->received < total / 10) {
+        if (!p->ops->pop(p->queue, &item)) {
+            sched_yield();
+            continue;
+        }
+        hist_add(&p->latency, now_ns() - __atomic_load_n(&p->stamps[item], __ATOMIC_RELAXED));
+        if (item != (uint8_t)p->received) {
+            printf("  orden incorrecto en el disparo %u\n", p->received);
+            exit(1);
+        }
+        p->received++;
+    }
+    return NULL;
+}
+
+static void bench_pair(const queue_ops_t *ops) {
+    pair_t pair = {.ops = ops, .queue = ops->create()};
+    pthread_t prod, cons;
+    uint64_t start = now_ns();
+    pthread_create(&cons, NULL, consumer, &pair);
+    pthread_create(&prod, NULL, producer, &pair);
+    pthread_join(prod, NULL);
+    pthread_join(cons, NULL);
+    uint64_t elapsed = now_ns() - start;
+    printf("  dos hilos: %.1f M disparos por segundo\n", pair.received * 1e3 / (double)elapsed);
+    hist_print("del push al pop", &pair.latency);
+    free(pair.queue);
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) total = (uint32_t)strtoul(argv[1], NULL, 10);
+    for (size_t i = 0; i < sizeof(queues) / sizeof(queues[0]); ++i) {
+        printf("Cola %s:\n", queues[i].name);
+        bench_single(&queues[i]);
+        bench_pair(&queues[i]);
+    }
+    return 0;
+}